@@ -0,0 +1,376 @@
+#include "../include/memory/ContiguousAllocator.h"
+#include "../include/memory/BuddyAllocator.h"
+#include "../include/memory/TlsfAllocator.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+/**
+ * @file memory_benchmark.cpp
+ * @brief 内存分配算法延迟与碎片基准测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ *
+ * 生成几条确定性的分配/释放请求序列，让首次、最佳、最坏、循环首次适应、TLSF和伙伴系统
+ * 依次回放同一条序列（关闭跟踪输出），逐次计时每个allocateMemory/deallocateMemory调用，
+ * 报告分配和释放延迟的p50/p99/p99.9/最大值、分配失败次数以及平均/最终外部碎片。
+ *
+ * 用法：
+ *   memory_benchmark [--ops N] [--heap KB] [--seed N] [--json 输出文件]
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+// 请求序列中的一次操作：size为0表示释放进程process_id的内存
+struct TraceOp {
+    int process_id;
+    size_t size;
+};
+
+// 一条命名的请求序列
+struct Trace {
+    std::string name;
+    std::vector<TraceOp> ops;
+};
+
+// 延迟分布（纳秒）
+struct LatencySummary {
+    double p50;
+    double p99;
+    double p999;
+    double max;
+};
+
+// 单个用例的测量结果
+struct BenchmarkCase {
+    std::string trace;
+    std::string allocator;
+    size_t allocations;
+    size_t frees;
+    size_t failures;
+    LatencySummary alloc_latency;
+    LatencySummary free_latency;
+    double average_fragmentation;
+    double final_fragmentation;
+};
+
+// 命令行参数
+struct BenchmarkOptions {
+    size_t ops;
+    size_t heap;
+    unsigned int seed;
+    std::string json_path;
+
+    BenchmarkOptions() : ops(200000), heap(65536), seed(20250101u) {}
+};
+
+/// 每隔多少次操作采样一次碎片程度
+constexpr size_t kFragmentationSampleInterval = 256;
+
+// 以目标占用率为中心随机分配/释放，size_of决定请求大小的分布
+template <typename SizeFn>
+Trace generateSteadyTrace(const std::string& name, size_t ops, size_t heap,
+                          unsigned int seed, SizeFn size_of) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+
+    Trace trace;
+    trace.name = name;
+    trace.ops.reserve(ops);
+    std::vector<std::pair<int, size_t>> live;
+    size_t live_size = 0;
+    int next_pid = 1;
+    const double target = 0.7 * static_cast<double>(heap);
+
+    while (trace.ops.size() < ops) {
+        // 占用越接近目标，释放的概率越大
+        double fill = static_cast<double>(live_size) / target;
+        if (live.empty() || coin(rng) > 0.5 * fill) {
+            size_t size = size_of(rng);
+            trace.ops.push_back({next_pid, size});
+            live.push_back({next_pid, size});
+            live_size += size;
+            next_pid++;
+        } else {
+            size_t victim = std::uniform_int_distribution<size_t>(0, live.size() - 1)(rng);
+            trace.ops.push_back({live[victim].first, 0});
+            live_size -= live[victim].second;
+            live[victim] = live.back();
+            live.pop_back();
+        }
+    }
+    return trace;
+}
+
+// 突发负载：一批分配把堆填到接近满，再随机释放其中大部分
+Trace generateBurstyTrace(size_t ops, size_t heap, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<size_t> size(1, std::max<size_t>(heap / 512, 2));
+
+    Trace trace;
+    trace.name = "bursty";
+    trace.ops.reserve(ops);
+    std::vector<std::pair<int, size_t>> live;
+    size_t live_size = 0;
+    int next_pid = 1;
+
+    while (trace.ops.size() < ops) {
+        while (live_size < heap * 9 / 10 && trace.ops.size() < ops) {
+            size_t request = size(rng);
+            trace.ops.push_back({next_pid, request});
+            live.push_back({next_pid++, request});
+            live_size += request;
+        }
+        std::shuffle(live.begin(), live.end(), rng);
+        size_t keep = live.size() / 5;
+        while (live.size() > keep && trace.ops.size() < ops) {
+            trace.ops.push_back({live.back().first, 0});
+            live_size -= live.back().second;
+            live.pop_back();
+        }
+    }
+    return trace;
+}
+
+// 生成全部请求序列
+std::vector<Trace> generateTraces(const BenchmarkOptions& options) {
+    std::vector<Trace> traces;
+    size_t small_max = std::max<size_t>(options.heap / 1024, 2);
+    traces.push_back(generateSteadyTrace("uniform", options.ops, options.heap, options.seed,
+        [small_max](std::mt19937& rng) {
+            return std::uniform_int_distribution<size_t>(1, small_max)(rng);
+        }));
+    traces.push_back(generateSteadyTrace("bimodal", options.ops, options.heap, options.seed + 1,
+        [small_max](std::mt19937& rng) {
+            // 九成小块、一成大块，容易把大块夹在小块之间形成碎片
+            if (std::uniform_int_distribution<int>(0, 9)(rng) == 0) {
+                return std::uniform_int_distribution<size_t>(small_max * 4, small_max * 16)(rng);
+            }
+            return std::uniform_int_distribution<size_t>(1, std::max<size_t>(small_max / 8, 1))(rng);
+        }));
+    traces.push_back(generateBurstyTrace(options.ops, options.heap, options.seed + 2));
+    return traces;
+}
+
+// 计算延迟分布
+LatencySummary summarize(std::vector<double>& samples) {
+    LatencySummary summary = {0.0, 0.0, 0.0, 0.0};
+    if (samples.empty()) {
+        return summary;
+    }
+    std::sort(samples.begin(), samples.end());
+    auto at = [&samples](double quantile) {
+        size_t index = static_cast<size_t>(quantile * static_cast<double>(samples.size() - 1));
+        return samples[index];
+    };
+    summary.p50 = at(0.5);
+    summary.p99 = at(0.99);
+    summary.p999 = at(0.999);
+    summary.max = samples.back();
+    return summary;
+}
+
+// 在一个分配器上回放请求序列
+BenchmarkCase runCase(MemoryManager& manager, const std::string& name, const Trace& trace) {
+    BenchmarkCase bench = BenchmarkCase();
+    bench.trace = trace.name;
+    bench.allocator = name;
+
+    std::vector<double> alloc_samples;
+    std::vector<double> free_samples;
+    alloc_samples.reserve(trace.ops.size());
+    free_samples.reserve(trace.ops.size());
+    std::vector<bool> allocated;
+    double fragmentation_sum = 0.0;
+    size_t fragmentation_samples = 0;
+
+    for (size_t i = 0; i < trace.ops.size(); ++i) {
+        const TraceOp& op = trace.ops[i];
+        if (op.process_id >= static_cast<int>(allocated.size())) {
+            allocated.resize(op.process_id + 1, false);
+        }
+
+        if (op.size > 0) {
+            auto begin = std::chrono::steady_clock::now();
+            int address = manager.allocateMemory(op.size, op.process_id);
+            auto end = std::chrono::steady_clock::now();
+            alloc_samples.push_back(std::chrono::duration<double, std::nano>(end - begin).count());
+            bench.allocations++;
+            if (address < 0) {
+                bench.failures++;
+            } else {
+                allocated[op.process_id] = true;
+            }
+        } else if (allocated[op.process_id]) {
+            // 分配失败的进程没有可释放的内存，跳过对应的释放
+            auto begin = std::chrono::steady_clock::now();
+            manager.deallocateMemory(op.process_id);
+            auto end = std::chrono::steady_clock::now();
+            free_samples.push_back(std::chrono::duration<double, std::nano>(end - begin).count());
+            bench.frees++;
+            allocated[op.process_id] = false;
+        }
+
+        if (i % kFragmentationSampleInterval == 0) {
+            fragmentation_sum += manager.getFragmentation();
+            fragmentation_samples++;
+        }
+    }
+
+    bench.alloc_latency = summarize(alloc_samples);
+    bench.free_latency = summarize(free_samples);
+    bench.average_fragmentation = fragmentation_samples == 0 ? 0.0
+        : fragmentation_sum / static_cast<double>(fragmentation_samples);
+    bench.final_fragmentation = manager.getFragmentation();
+    return bench;
+}
+
+// 解析命令行参数
+BenchmarkOptions parseOptions(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("参数缺少取值: " + arg);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--ops") {
+            options.ops = static_cast<size_t>(std::stod(next()));  // 允许1e6这样的写法
+        } else if (arg == "--heap") {
+            options.heap = static_cast<size_t>(std::stod(next()));
+        } else if (arg == "--seed") {
+            options.seed = static_cast<unsigned int>(std::stoul(next()));
+        } else if (arg == "--json") {
+            options.json_path = next();
+        } else {
+            throw std::invalid_argument("未知参数: " + arg);
+        }
+    }
+    if (options.ops == 0 || options.heap < 1024) {
+        throw std::invalid_argument("操作数必须大于0，堆大小不能小于1024KB");
+    }
+    return options;
+}
+
+// 将延迟分布写成JSON对象
+void writeLatency(const LatencySummary& latency, std::ostream& out) {
+    out << "{\"p50\": " << latency.p50 << ", \"p99\": " << latency.p99
+        << ", \"p999\": " << latency.p999 << ", \"max\": " << latency.max << "}";
+}
+
+// 将结果写成JSON，每个用例占一行
+void writeJson(const std::vector<BenchmarkCase>& cases, const BenchmarkOptions& options,
+               std::ostream& out) {
+    out << "{\n";
+    out << "  \"benchmark\": \"memory\",\n";
+    out << "  \"seed\": " << options.seed << ",\n";
+    out << "  \"ops\": " << options.ops << ",\n";
+    out << "  \"heap_kb\": " << options.heap << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < cases.size(); ++i) {
+        const BenchmarkCase& c = cases[i];
+        out << std::fixed << std::setprecision(1)
+            << "    {\"trace\": \"" << c.trace << "\", \"allocator\": \"" << c.allocator << "\""
+            << ", \"allocations\": " << c.allocations
+            << ", \"frees\": " << c.frees
+            << ", \"failures\": " << c.failures
+            << ", \"alloc_ns\": ";
+        writeLatency(c.alloc_latency, out);
+        out << ", \"free_ns\": ";
+        writeLatency(c.free_latency, out);
+        out << ", \"average_fragmentation\": " << c.average_fragmentation
+            << ", \"final_fragmentation\": " << c.final_fragmentation << "}"
+            << (i + 1 < cases.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+// 打印一行结果
+void printCase(const BenchmarkCase& c) {
+    std::cout << std::left << std::setw(10) << c.trace << std::setw(12) << c.allocator << std::right
+              << std::fixed << std::setprecision(0)
+              << std::setw(9) << c.alloc_latency.p50
+              << std::setw(9) << c.alloc_latency.p99
+              << std::setw(10) << c.alloc_latency.p999
+              << std::setw(10) << c.alloc_latency.max
+              << std::setw(9) << c.free_latency.p50
+              << std::setw(9) << c.free_latency.p99
+              << std::setw(10) << c.free_latency.p999
+              << std::setw(10) << c.free_latency.max
+              << std::setw(8) << c.failures
+              << std::setprecision(1)
+              << std::setw(9) << c.average_fragmentation << "%"
+              << std::setw(9) << c.final_fragmentation << "%" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        BenchmarkOptions options = parseOptions(argc, argv);
+        std::vector<Trace> traces = generateTraces(options);
+        std::vector<BenchmarkCase> cases;
+
+        std::cout << "操作数 " << options.ops << "，堆大小 " << options.heap
+                  << " KB，延迟单位为纳秒" << std::endl;
+        std::cout << std::left << std::setw(10) << "序列" << std::setw(12) << "分配器" << std::right
+                  << std::setw(11) << "分配p50" << std::setw(9) << "p99" << std::setw(10) << "p99.9"
+                  << std::setw(10) << "max"
+                  << std::setw(11) << "释放p50" << std::setw(9) << "p99" << std::setw(10) << "p99.9"
+                  << std::setw(10) << "max"
+                  << std::setw(8) << "失败" << std::setw(10) << "平均碎片" << std::setw(10) << "最终碎片"
+                  << std::endl;
+
+        const std::vector<std::pair<std::string, MemoryAllocationStrategy>> strategies = {
+            {"first-fit", MemoryAllocationStrategy::FIRST_FIT},
+            {"best-fit", MemoryAllocationStrategy::BEST_FIT},
+            {"worst-fit", MemoryAllocationStrategy::WORST_FIT},
+            {"next-fit", MemoryAllocationStrategy::NEXT_FIT},
+        };
+
+        for (const auto& trace : traces) {
+            for (const auto& strategy : strategies) {
+                ContiguousAllocator allocator(options.heap);
+                allocator.setTraceEnabled(false);
+                allocator.setAllocationStrategy(strategy.second);
+                cases.push_back(runCase(allocator, strategy.first, trace));
+                printCase(cases.back());
+            }
+
+            TlsfAllocator tlsf(options.heap);
+            tlsf.setTraceEnabled(false);
+            cases.push_back(runCase(tlsf, "tlsf", trace));
+            printCase(cases.back());
+
+            BuddyAllocator buddy(options.heap);
+            buddy.setTraceEnabled(false);
+            cases.push_back(runCase(buddy, "buddy", trace));
+            printCase(cases.back());
+        }
+
+        if (!options.json_path.empty()) {
+            std::ofstream out(options.json_path);
+            if (!out) {
+                throw std::runtime_error("无法写入JSON文件: " + options.json_path);
+            }
+            writeJson(cases, options, out);
+            std::cout << "\n结果已写入 " << options.json_path << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return 2;
+    }
+    return 0;
+}
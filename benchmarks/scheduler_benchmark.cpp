@@ -0,0 +1,437 @@
+#include "../include/algorithms/Scheduler.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+/**
+ * @file scheduler_benchmark.cpp
+ * @brief 进程调度算法性能基准测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ *
+ * 对SchedulerFactory中的每种调度算法，在1e3到1e7个进程的生成负载上运行（关闭跟踪输出），
+ * 报告每秒模拟的进程数、每秒调度决策数以及峰值内存。
+ * 峰值内存是进程级的历史最高值，因此每个用例都在新启动的子进程中运行（以--run-case调用自身），
+ * 子进程把结果按JSON行格式写到标准输出。
+ *
+ * 用法：
+ *   scheduler_benchmark [--sizes 1000,10000,...] [--budget 秒] [--seed N]
+ *                       [--json 输出文件] [--compare 基线文件] [--tolerance 0.25]
+ *
+ * --json 把结果写成JSON基线；--compare 读取先前的基线，
+ * 任一用例的吞吐量低于基线的(1 - tolerance)倍时以非0状态退出。
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+// 单个用例的测量结果
+struct BenchmarkCase {
+    std::string scheduler;
+    size_t size;
+    bool skipped;
+    double seconds;
+    double processes_per_sec;
+    double decisions_per_sec;
+    long long decisions;
+    long long peak_rss_kb;
+};
+
+// 命令行参数
+struct BenchmarkOptions {
+    std::vector<size_t> sizes;
+    double budget;
+    unsigned int seed;
+    std::string json_path;
+    std::string compare_path;
+    double tolerance;
+    int run_case_type;      ///< 子进程模式：要运行的算法在getAvailableTypes()中的下标，-1表示主进程
+    size_t run_case_size;   ///< 子进程模式：进程规模
+
+    BenchmarkOptions()
+        : sizes({1000, 10000, 100000, 1000000, 10000000}),
+          budget(30.0), seed(20250101u), tolerance(0.25),
+          run_case_type(-1), run_case_size(0) {}
+};
+
+// 生成确定性的负载：到达间隔略小于平均执行时间，使就绪队列保持一定长度
+ProcessList generateWorkload(size_t size, unsigned int seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> burst(1, 20);
+    std::uniform_int_distribution<int> gap(0, 18);
+    std::uniform_int_distribution<int> priority(1, 5);
+
+    ProcessList processes;
+    processes.reserve(size);
+    int arrival = 0;
+    for (size_t i = 0; i < size; ++i) {
+        processes.emplace_back(static_cast<int>(i + 1), "P", arrival, burst(rng),
+                               static_cast<ProcessPriority>(priority(rng)));
+        arrival += gap(rng);
+    }
+    return processes;
+}
+
+// 获取进程的峰值常驻内存（KB）
+long long peakRssKb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return static_cast<long long>(counters.PeakWorkingSetSize / 1024);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return static_cast<long long>(usage.ru_maxrss / 1024);
+#else
+    return static_cast<long long>(usage.ru_maxrss);
+#endif
+#endif
+}
+
+// 解析逗号分隔的规模列表
+std::vector<size_t> parseSizes(const std::string& text) {
+    std::vector<size_t> sizes;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        double value = std::stod(item);  // 允许1e6这样的写法
+        if (value < 1) {
+            throw std::invalid_argument("进程规模必须大于0: " + item);
+        }
+        sizes.push_back(static_cast<size_t>(value));
+    }
+    if (sizes.empty()) {
+        throw std::invalid_argument("进程规模列表不能为空");
+    }
+    return sizes;
+}
+
+// 解析命令行参数
+BenchmarkOptions parseOptions(int argc, char* argv[]) {
+    BenchmarkOptions options;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                throw std::invalid_argument("参数缺少取值: " + arg);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--sizes") {
+            options.sizes = parseSizes(next());
+        } else if (arg == "--budget") {
+            options.budget = std::stod(next());
+        } else if (arg == "--seed") {
+            options.seed = static_cast<unsigned int>(std::stoul(next()));
+        } else if (arg == "--json") {
+            options.json_path = next();
+        } else if (arg == "--compare") {
+            options.compare_path = next();
+        } else if (arg == "--tolerance") {
+            options.tolerance = std::stod(next());
+        } else if (arg == "--run-case") {
+            options.run_case_type = std::stoi(next());
+            options.run_case_size = static_cast<size_t>(std::stod(next()));
+        } else {
+            throw std::invalid_argument("未知参数: " + arg);
+        }
+    }
+    std::sort(options.sizes.begin(), options.sizes.end());
+    return options;
+}
+
+// 运行一个用例
+BenchmarkCase runCase(Scheduler& scheduler, const std::string& name, const ProcessList& processes) {
+    auto begin = std::chrono::steady_clock::now();
+    SchedulingResult result = scheduler.schedule(processes);
+    auto end = std::chrono::steady_clock::now();
+
+    BenchmarkCase bench;
+    bench.scheduler = name;
+    bench.size = processes.size();
+    bench.skipped = false;
+    bench.seconds = std::max(std::chrono::duration<double>(end - begin).count(), 1e-9);
+    bench.decisions = result.scheduling_decisions;
+    bench.processes_per_sec = static_cast<double>(result.processes.size()) / bench.seconds;
+    bench.decisions_per_sec = static_cast<double>(result.scheduling_decisions) / bench.seconds;
+    bench.peak_rss_kb = peakRssKb();
+    return bench;
+}
+
+// 把一个用例写成一行JSON对象
+void writeCaseJson(const BenchmarkCase& c, std::ostream& out) {
+    out << "{\"scheduler\": \"" << c.scheduler << "\", \"size\": " << c.size
+        << ", \"skipped\": " << (c.skipped ? "true" : "false")
+        << std::fixed << std::setprecision(6)
+        << ", \"seconds\": " << c.seconds
+        << std::setprecision(1)
+        << ", \"processes_per_sec\": " << c.processes_per_sec
+        << ", \"decisions_per_sec\": " << c.decisions_per_sec
+        << ", \"decisions\": " << c.decisions
+        << ", \"peak_rss_kb\": " << c.peak_rss_kb << "}";
+}
+
+// 将结果写成JSON，每个用例占一行，便于比较时逐行解析
+void writeJson(const std::vector<BenchmarkCase>& cases, const BenchmarkOptions& options,
+               std::ostream& out) {
+    out << "{\n";
+    out << "  \"benchmark\": \"scheduler\",\n";
+    out << "  \"seed\": " << options.seed << ",\n";
+    out << "  \"results\": [\n";
+    for (size_t i = 0; i < cases.size(); ++i) {
+        out << "    ";
+        writeCaseJson(cases[i], out);
+        out << (i + 1 < cases.size() ? "," : "") << "\n";
+    }
+    out << "  ]\n";
+    out << "}\n";
+}
+
+// 从JSON行中取出字符串字段
+std::string jsonString(const std::string& line, const std::string& key) {
+    std::string pattern = "\"" + key + "\": \"";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos) {
+        return "";
+    }
+    pos += pattern.size();
+    return line.substr(pos, line.find('"', pos) - pos);
+}
+
+// 从JSON行中取出数值字段
+double jsonNumber(const std::string& line, const std::string& key) {
+    std::string pattern = "\"" + key + "\": ";
+    size_t pos = line.find(pattern);
+    if (pos == std::string::npos) {
+        return 0.0;
+    }
+    return std::strtod(line.c_str() + pos + pattern.size(), nullptr);
+}
+
+// 解析writeCaseJson写出的一行，没有scheduler字段时返回false
+bool parseCaseJson(const std::string& line, BenchmarkCase& c) {
+    std::string scheduler = jsonString(line, "scheduler");
+    if (scheduler.empty()) {
+        return false;
+    }
+    c = BenchmarkCase();
+    c.scheduler = scheduler;
+    c.size = static_cast<size_t>(jsonNumber(line, "size"));
+    c.skipped = line.find("\"skipped\": true") != std::string::npos;
+    c.seconds = jsonNumber(line, "seconds");
+    c.processes_per_sec = jsonNumber(line, "processes_per_sec");
+    c.decisions_per_sec = jsonNumber(line, "decisions_per_sec");
+    c.decisions = static_cast<long long>(jsonNumber(line, "decisions"));
+    c.peak_rss_kb = static_cast<long long>(jsonNumber(line, "peak_rss_kb"));
+    return true;
+}
+
+// 读取由writeJson生成的基线文件
+std::vector<BenchmarkCase> readBaseline(const std::string& path) {
+    std::ifstream in(path);
+    if (!in) {
+        throw std::runtime_error("无法打开基线文件: " + path);
+    }
+
+    std::vector<BenchmarkCase> cases;
+    std::string line;
+    BenchmarkCase c;
+    while (std::getline(in, line)) {
+        if (parseCaseJson(line, c)) {
+            cases.push_back(c);
+        }
+    }
+    return cases;
+}
+
+// 在子进程中运行一个用例，使峰值内存只反映该用例
+BenchmarkCase runCaseInChild(const std::string& executable, size_t type_index, size_t size,
+                             unsigned int seed) {
+    std::string command = "\"" + executable + "\" --run-case " + std::to_string(type_index) + " " +
+                          std::to_string(size) + " --seed " + std::to_string(seed);
+#ifdef _WIN32
+    FILE* pipe = _popen(command.c_str(), "r");
+#else
+    FILE* pipe = popen(command.c_str(), "r");
+#endif
+    if (pipe == nullptr) {
+        throw std::runtime_error("无法启动子进程: " + command);
+    }
+
+    std::string output;
+    char buffer[512];
+    while (std::fgets(buffer, sizeof(buffer), pipe) != nullptr) {
+        output += buffer;
+    }
+#ifdef _WIN32
+    int status = _pclose(pipe);
+#else
+    int status = pclose(pipe);
+#endif
+
+    BenchmarkCase c;
+    if (status != 0 || !parseCaseJson(output, c)) {
+        throw std::runtime_error("子进程运行用例失败: " + command);
+    }
+    return c;
+}
+
+// 按已测规模估计下一个规模的耗时
+double estimateSeconds(size_t size, size_t last_size, double last_seconds,
+                       size_t prev_size, double prev_seconds) {
+    double ratio = static_cast<double>(size) / static_cast<double>(last_size);
+    // 两次测量都足够长时用实测的增长阶数，限制在线性与二次之间以免计时噪声放大
+    if (prev_size > 0 && prev_seconds >= 0.05 && last_seconds >= 0.05) {
+        double exponent = std::log(last_seconds / prev_seconds) /
+                          std::log(static_cast<double>(last_size) / static_cast<double>(prev_size));
+        exponent = std::max(1.0, std::min(2.0, exponent));
+        return last_seconds * std::pow(ratio, exponent);
+    }
+    // 否则按堆/队列调度器的n log n估计
+    return last_seconds * ratio * std::log(static_cast<double>(size)) /
+           std::log(static_cast<double>(std::max<size_t>(last_size, 2)));
+}
+
+// 与基线比较，返回退化的用例数
+int compareWithBaseline(const std::vector<BenchmarkCase>& cases,
+                        const std::vector<BenchmarkCase>& baseline, double tolerance) {
+    int regressions = 0;
+    std::cout << "\n与基线比较 (容差 " << tolerance * 100.0 << "%):" << std::endl;
+    for (const auto& c : cases) {
+        if (c.skipped) {
+            continue;
+        }
+        auto it = std::find_if(baseline.begin(), baseline.end(), [&](const BenchmarkCase& b) {
+            return b.scheduler == c.scheduler && b.size == c.size && !b.skipped;
+        });
+        if (it == baseline.end() || it->processes_per_sec <= 0.0) {
+            continue;
+        }
+
+        double ratio = c.processes_per_sec / it->processes_per_sec;
+        bool regressed = ratio < 1.0 - tolerance;
+        if (regressed) {
+            regressions++;
+        }
+        std::cout << "  " << std::left << std::setw(12) << c.scheduler << std::right
+                  << std::setw(10) << c.size << "  "
+                  << std::fixed << std::setprecision(2) << ratio << "x"
+                  << (regressed ? "  <-- 性能退化" : "") << std::endl;
+    }
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    try {
+        BenchmarkOptions options = parseOptions(argc, argv);
+        auto types = SchedulerFactory::getAvailableTypes();
+
+        if (options.run_case_type >= 0) {
+            if (static_cast<size_t>(options.run_case_type) >= types.size() || options.run_case_size == 0) {
+                throw std::invalid_argument("无效的--run-case参数");
+            }
+            auto type = types[options.run_case_type];
+            SchedulerPtr scheduler = SchedulerFactory::createScheduler(type);
+            scheduler->setTraceEnabled(false);
+            ProcessList workload = generateWorkload(options.run_case_size, options.seed);
+            writeCaseJson(runCase(*scheduler, SchedulerFactory::getSchedulerTypeName(type), workload), std::cout);
+            std::cout << std::endl;
+            return 0;
+        }
+
+        std::vector<BenchmarkCase> cases;
+
+        std::cout << std::left << std::setw(12) << "调度器" << std::right
+                  << std::setw(10) << "进程数"
+                  << std::setw(12) << "耗时(s)"
+                  << std::setw(16) << "进程/秒"
+                  << std::setw(16) << "决策/秒"
+                  << std::setw(14) << "峰值RSS(KB)" << std::endl;
+
+        for (size_t type_index = 0; type_index < types.size(); ++type_index) {
+            std::string name = SchedulerFactory::getSchedulerTypeName(types[type_index]);
+
+            double last_seconds = 0.0;
+            size_t last_size = 0;
+            double prev_seconds = 0.0;
+            size_t prev_size = 0;
+            for (size_t size : options.sizes) {
+                // 估计耗时超出预算的规模直接跳过
+                if (last_size > 0) {
+                    if (estimateSeconds(size, last_size, last_seconds, prev_size, prev_seconds) > options.budget) {
+                        BenchmarkCase skipped = BenchmarkCase();
+                        skipped.scheduler = name;
+                        skipped.size = size;
+                        skipped.skipped = true;
+                        cases.push_back(skipped);
+                        std::cout << std::left << std::setw(12) << name << std::right
+                                  << std::setw(10) << size << "  (预计超出时间预算，跳过)" << std::endl;
+                        continue;
+                    }
+                }
+
+                BenchmarkCase c = runCaseInChild(argv[0], type_index, size, options.seed);
+                cases.push_back(c);
+                prev_seconds = last_seconds;
+                prev_size = last_size;
+                last_seconds = c.seconds;
+                last_size = size;
+
+                std::cout << std::left << std::setw(12) << name << std::right
+                          << std::setw(10) << c.size
+                          << std::fixed << std::setprecision(3) << std::setw(12) << c.seconds
+                          << std::setprecision(0) << std::setw(16) << c.processes_per_sec
+                          << std::setw(16) << c.decisions_per_sec
+                          << std::setw(14) << c.peak_rss_kb << std::endl;
+            }
+        }
+
+        if (!options.json_path.empty()) {
+            std::ofstream out(options.json_path);
+            if (!out) {
+                throw std::runtime_error("无法写入JSON文件: " + options.json_path);
+            }
+            writeJson(cases, options, out);
+            std::cout << "\n基线已写入 " << options.json_path << std::endl;
+        }
+
+        if (!options.compare_path.empty()) {
+            int regressions = compareWithBaseline(cases, readBaseline(options.compare_path),
+                                                  options.tolerance);
+            if (regressions > 0) {
+                std::cout << regressions << " 个用例性能退化" << std::endl;
+                return 1;
+            }
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "错误: " << e.what() << std::endl;
+        return 2;
+    }
+    return 0;
+}
@@ -0,0 +1,264 @@
+#ifndef BASIC_SCHEDULER_H
+#define BASIC_SCHEDULER_H
+
+#include "Scheduler.h"
+#include "SchedulingPolicies.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <ostream>
+#include <utility>
+
+/**
+ * @file BasicScheduler.h
+ * @brief 基于编译期策略组合的通用调度器模板
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class BasicScheduler
+ * @brief 通用单处理器调度器
+ *
+ * 所有调度算法共用同一个事件驱动主循环：校验、复制、重置、接纳到达进程、
+ * 空闲时跳到下一个到达时刻、派发、执行到下一个事件、完成统计。
+ * 算法之间的差异由三个策略模板参数在编译期决定（见SchedulingPolicies.h），
+ * 主循环中没有虚函数调用，也没有运行时的"是否抢占"判断。
+ *
+ * 每个进程只入队、出队O(1)次（抢占和时间片轮转按实际发生次数计），
+ * 使用堆队列时总复杂度为O(事件数·log n)。
+ *
+ * @tparam SelectPolicy 选择策略
+ * @tparam PreemptPolicy 抢占策略
+ * @tparam QueuePolicy 就绪队列策略
+ */
+template <typename SelectPolicy, typename PreemptPolicy, typename QueuePolicy>
+class BasicScheduler : public Scheduler {
+public:
+    /**
+     * @brief 构造函数
+     * @param name 调度器名称
+     * @param description 调度器描述
+     * @param preempt 抢占策略（如时间片大小）
+     */
+    BasicScheduler(const std::string& name, const std::string& description,
+                   const PreemptPolicy& preempt = PreemptPolicy())
+        : Scheduler(name, description), preempt_(preempt) {}
+
+    /**
+     * @brief 执行调度（使用临时工作区）
+     * @param processes 待调度的进程列表（不会被修改）
+     * @return 调度结果，进程顺序与输入一致
+     */
+    SchedulingResult schedule(const ProcessList& processes) override;
+
+    /**
+     * @brief 在工作区中执行调度，稳定状态下不分配内存
+     * @param processes 待调度的进程列表（不能是workspace中的缓冲区）
+     * @param workspace 工作区
+     * @return workspace.result的引用
+     */
+    const SchedulingResult& scheduleInto(const ProcessList& processes,
+                                         SchedulerWorkspace& workspace) override;
+
+    /**
+     * @brief 获取算法类型
+     * @return 调度器名称
+     */
+    std::string getAlgorithmType() const override { return getName(); }
+
+    /**
+     * @brief 是否为抢占式调度
+     * @return 由抢占策略决定
+     */
+    bool isPreemptive() const override { return PreemptPolicy::kPreemptive; }
+
+protected:
+    PreemptPolicy preempt_;  ///< 抢占策略
+
+private:
+    /// CPU空闲时的运行进程标记
+    static constexpr size_t kIdle = std::numeric_limits<size_t>::max();
+};
+
+// 执行调度（使用临时工作区）
+template <typename SelectPolicy, typename PreemptPolicy, typename QueuePolicy>
+SchedulingResult BasicScheduler<SelectPolicy, PreemptPolicy, QueuePolicy>::schedule(
+        const ProcessList& processes) {
+    SchedulerWorkspace workspace;
+    scheduleInto(processes, workspace);
+    return std::move(workspace.result);
+}
+
+// 在工作区中执行调度
+template <typename SelectPolicy, typename PreemptPolicy, typename QueuePolicy>
+const SchedulingResult& BasicScheduler<SelectPolicy, PreemptPolicy, QueuePolicy>::scheduleInto(
+        const ProcessList& processes, SchedulerWorkspace& workspace) {
+    static_assert(!(PreemptPolicy::kPreemptOnArrival && PreemptPolicy::kTimeSliced),
+                  "到达抢占与时间片抢占不能同时使用");
+
+    validateProcesses(processes);
+
+    // 结果中的进程列表直接作为工作副本，复用上次调用的容量
+    ProcessList& scheduled = workspace.result.processes;
+    scheduled.assign(processes.begin(), processes.end());
+    resetProcesses(scheduled);
+
+    // 到达序列：按(到达时间, 下标)排序，之后只需一个游标即可接纳新到达的进程
+    const size_t count = scheduled.size();
+    std::vector<size_t>& arrivals = workspace.arrivals;
+    arrivals.resize(count);
+    std::iota(arrivals.begin(), arrivals.end(), 0);
+    std::sort(arrivals.begin(), arrivals.end(), [&scheduled](size_t a, size_t b) {
+        int arrival_a = scheduled[a].getArrivalTime();
+        int arrival_b = scheduled[b].getArrivalTime();
+        return arrival_a != arrival_b ? arrival_a < arrival_b : a < b;
+    });
+
+    QueuePolicy ready(workspace);
+    ready.reset(count);
+
+    const bool tracing = isTraceEnabled();
+    std::ostream& out = trace();
+
+    size_t next_arrival = 0;
+    size_t completed = 0;
+    size_t running = kIdle;
+    int current_time = 0;
+    int slice_left = 0;
+    long long decisions = 0;
+
+    // 接纳到达时间不晚于当前时刻的进程
+    auto admitArrivals = [&]() {
+        while (next_arrival < count &&
+               scheduled[arrivals[next_arrival]].getArrivalTime() <= current_time) {
+            size_t index = arrivals[next_arrival++];
+            Process& process = scheduled[index];
+            process.setState(ProcessState::READY);
+            ready.push(SelectPolicy::key(process), index);
+            if (tracing) {
+                out << "  进程P" << process.getPID() << "到达，加入就绪队列" << std::endl;
+            }
+        }
+    };
+
+    if (tracing) {
+        out << "\n=== " << getName() << "调度过程演示 ===" << std::endl;
+        out << "======================================" << std::endl;
+    }
+
+    while (completed < count) {
+        admitArrivals();
+
+        if constexpr (PreemptPolicy::kPreemptOnArrival) {
+            if (running != kIdle && !ready.empty()) {
+                Process& current = scheduled[running];
+                typename QueuePolicy::Entry entry(SelectPolicy::key(current), running);
+                if (ready.top() < entry) {
+                    if (tracing) {
+                        out << "时间 " << current_time << ": 进程P" << current.getPID()
+                            << "被进程P" << scheduled[ready.top().second].getPID() << "抢占" << std::endl;
+                    }
+                    current.setState(ProcessState::READY);
+                    ready.push(entry.first, running);
+                    running = kIdle;
+                }
+            }
+        }
+
+        if (running == kIdle) {
+            if (ready.empty()) {
+                // CPU空闲：跳到下一个到达时刻
+                int arrival_time = scheduled[arrivals[next_arrival]].getArrivalTime();
+                if (tracing) {
+                    out << "时间 " << current_time << "-" << arrival_time
+                        << ": CPU空闲，等待进程到达" << std::endl;
+                }
+                current_time = arrival_time;
+                continue;
+            }
+
+            running = ready.pop();
+            Process& process = scheduled[running];
+            if (process.isFirstRun()) {
+                process.setStartTime(current_time);
+                process.setResponseTime(current_time - process.getArrivalTime());
+                process.setFirstRun(false);
+            }
+            process.setState(ProcessState::RUNNING);
+            decisions++;
+            if constexpr (PreemptPolicy::kTimeSliced) {
+                slice_left = preempt_.time_quantum;
+            }
+
+            if (tracing) {
+                out << "时间 " << current_time << ": 开始执行进程 P" << process.getPID()
+                    << " (" << process.getName() << ")" << std::endl;
+                out << "  剩余时间: " << process.getRemainingTime() << std::endl;
+            }
+        }
+
+        // 运行到完成、时间片用完或下一个到达时刻（仅到达抢占）中最早者
+        Process& process = scheduled[running];
+        int run_time = process.getRemainingTime();
+        if constexpr (PreemptPolicy::kTimeSliced) {
+            run_time = std::min(run_time, slice_left);
+        }
+        if constexpr (PreemptPolicy::kPreemptOnArrival) {
+            if (next_arrival < count) {
+                run_time = std::min(run_time,
+                                    scheduled[arrivals[next_arrival]].getArrivalTime() - current_time);
+            }
+        }
+
+        process.execute(run_time);
+        current_time += run_time;
+
+        if (process.isCompleted()) {
+            process.setCompletionTime(current_time);
+            process.calculateTimes(current_time);
+            completed++;
+            running = kIdle;
+
+            if (tracing) {
+                out << "时间 " << current_time << ": 进程P" << process.getPID() << "执行完成！" << std::endl;
+                out << "  完成时间: " << process.getCompletionTime() << std::endl;
+                out << "  周转时间: " << process.getTurnaroundTime() << std::endl;
+                out << "  等待时间: " << process.getWaitingTime() << std::endl;
+                out << std::endl;
+            }
+            continue;
+        }
+
+        if constexpr (PreemptPolicy::kTimeSliced) {
+            slice_left -= run_time;
+            if (slice_left <= 0) {
+                if (tracing) {
+                    out << "  时间片用完，进程P" << process.getPID() << "回到就绪队列" << std::endl;
+                }
+                // 先接纳同一时刻新到达的进程，再回到队尾
+                admitArrivals();
+                ready.push(SelectPolicy::key(process), running);
+                running = kIdle;
+            }
+        } else {
+            process.setState(ProcessState::RUNNING);
+        }
+    }
+
+    fillStatistics(workspace.result, current_time);
+    workspace.result.scheduling_decisions = decisions;
+
+    if (tracing) {
+        out << "=== " << getName() << "调度完成！总执行时间: " << current_time << " 时间单位 ===" << std::endl;
+        out << "======================================" << std::endl;
+    }
+
+    return workspace.result;
+}
+
+} // namespace ZTS_OS
+
+#endif // BASIC_SCHEDULER_H
@@ -1,7 +1,7 @@
 #ifndef FCFS_SCHEDULER_H
 #define FCFS_SCHEDULER_H
 
-#include "Scheduler.h"
+#include "BasicScheduler.h"
 
 /**
  * @file FCFSScheduler.h
@@ -21,8 +21,10 @@ namespace ZTS_OS {
  * - 按进程到达时间顺序执行
  * - 简单公平，但可能导致长作业阻塞短作业
  * - 平均等待时间较长
+ *
+ * 由BasicScheduler<按到达时间选择, 非抢占, FIFO队列>实例化。
  */
-class FCFSScheduler : public Scheduler {
+class FCFSScheduler : public BasicScheduler<ArrivalOrderSelect, NoPreemption, FifoReadyQueue> {
 public:
     /**
      * @brief 构造函数
@@ -35,11 +37,13 @@ public:
     virtual ~FCFSScheduler() = default;
     
     /**
-     * @brief 执行FCFS调度算法
+     * @brief 在工作区中执行FCFS调度，结果按到达时间排列
      * @param processes 待调度的进程列表
-     * @return 调度结果
+     * @param workspace 工作区
+     * @return workspace.result的引用
      */
-    SchedulingResult schedule(const ProcessList& processes) override;
+    const SchedulingResult& scheduleInto(const ProcessList& processes,
+                                         SchedulerWorkspace& workspace) override;
     
     /**
      * @brief 获取算法类型
@@ -0,0 +1,205 @@
+#ifndef MONTE_CARLO_SIMULATOR_H
+#define MONTE_CARLO_SIMULATOR_H
+
+#include "Scheduler.h"
+#include <cstdint>
+#include <functional>
+
+/**
+ * @file MonteCarloSimulator.h
+ * @brief 调度算法的蒙特卡洛批量模拟与置信区间估计
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @struct WorkloadSpec
+ * @brief 随机负载的分布描述
+ */
+struct WorkloadSpec {
+    /**
+     * @enum BurstDistribution
+     * @brief 执行时间的分布
+     */
+    enum class BurstDistribution {
+        UNIFORM,      ///< [min_burst, max_burst]上的均匀分布
+        EXPONENTIAL   ///< 均值为mean_burst的指数分布，截断到[min_burst, max_burst]
+    };
+
+    size_t process_count;               ///< 每个负载的进程数
+    double mean_interarrival;           ///< 到达间隔的均值（指数分布，即泊松到达）
+    BurstDistribution burst_distribution; ///< 执行时间分布
+    int min_burst;                      ///< 最短执行时间
+    int max_burst;                      ///< 最长执行时间
+    double mean_burst;                  ///< 执行时间均值（仅指数分布）
+    int min_priority;                   ///< 最高优先级（数值最小）
+    int max_priority;                   ///< 最低优先级（数值最大）
+
+    WorkloadSpec()
+        : process_count(50), mean_interarrival(4.0),
+          burst_distribution(BurstDistribution::UNIFORM),
+          min_burst(1), max_burst(10), mean_burst(5.0),
+          min_priority(1), max_priority(5) {}
+};
+
+/**
+ * @struct MetricEstimate
+ * @brief 一个指标的样本均值与95%置信区间
+ */
+struct MetricEstimate {
+    double mean;        ///< 样本均值
+    double std_dev;     ///< 样本标准差
+    double half_width;  ///< 95%置信区间半宽
+    size_t samples;     ///< 样本数
+
+    MetricEstimate() : mean(0), std_dev(0), half_width(0), samples(0) {}
+
+    double lower() const { return mean - half_width; }
+    double upper() const { return mean + half_width; }
+};
+
+/**
+ * @struct MonteCarloReport
+ * @brief 一个调度器在全部重复实验上的统计结果
+ */
+struct MonteCarloReport {
+    std::string scheduler;              ///< 调度器标签
+    MetricEstimate waiting_time;        ///< 平均等待时间
+    MetricEstimate turnaround_time;     ///< 平均周转时间
+    MetricEstimate response_time;       ///< 平均响应时间
+    MetricEstimate cpu_utilization;     ///< CPU利用率(%)
+    MetricEstimate throughput;          ///< 吞吐率
+};
+
+/**
+ * @struct MonteCarloOptions
+ * @brief 蒙特卡洛模拟的控制参数
+ */
+struct MonteCarloOptions {
+    size_t min_replications;    ///< 至少重复的次数
+    size_t max_replications;    ///< 最多重复的次数
+    double relative_precision;  ///< 目标精度：置信区间半宽不超过|均值|的该比例
+    double absolute_precision;  ///< 均值接近0时使用的绝对精度
+    unsigned int threads;       ///< 工作线程数，0表示使用硬件并发数
+
+    MonteCarloOptions()
+        : min_replications(10), max_replications(10000),
+          relative_precision(0.02), absolute_precision(1e-3), threads(0) {}
+};
+
+/**
+ * @class MonteCarloSimulator
+ * @brief 蒙特卡洛批量模拟器
+ *
+ * 按WorkloadSpec生成K个相互独立的随机负载，用每个注册的调度器分别调度，
+ * 报告各项指标的均值和95%置信区间。
+ *
+ * - 同一次重复中所有调度器使用同一个负载（公共随机数），比较更敏感；
+ * - 第k次重复的负载只由种子和k决定，结果与线程数无关、可复现；
+ * - 每轮在所有核心上并行运行一批重复，全部置信区间都足够窄时自动停止。
+ */
+class MonteCarloSimulator {
+public:
+    /// 创建调度器的工厂函数，每个工作线程各自创建实例
+    using SchedulerMaker = std::function<SchedulerPtr()>;
+
+    /**
+     * @brief 构造函数
+     * @param spec 负载分布
+     * @param seed 随机种子
+     * @throws std::invalid_argument 如果分布参数无效
+     */
+    explicit MonteCarloSimulator(const WorkloadSpec& spec, uint64_t seed = 20250101u);
+
+    /**
+     * @brief 注册一个调度器
+     * @param label 报告中使用的标签
+     * @param maker 创建调度器的函数
+     */
+    void addScheduler(const std::string& label, SchedulerMaker maker);
+
+    /**
+     * @brief 按类型注册一个调度器
+     * @param type 调度算法类型
+     * @param time_quantum 时间片大小（仅用于时间片轮转）
+     */
+    void addScheduler(SchedulerFactory::SchedulerType type, int time_quantum = 2);
+
+    /**
+     * @brief 运行模拟直到置信区间满足精度或达到最大重复次数
+     * @param options 控制参数
+     * @return 每个调度器的统计结果，顺序与注册顺序一致
+     * @throws std::logic_error 如果没有注册调度器
+     */
+    std::vector<MonteCarloReport> run(const MonteCarloOptions& options = MonteCarloOptions());
+
+    /**
+     * @brief 生成第k次重复使用的负载
+     * @param replication 重复序号
+     * @return 进程列表
+     */
+    ProcessList generateWorkload(size_t replication) const;
+
+    /**
+     * @brief 上次运行实际完成的重复次数
+     * @return 重复次数
+     */
+    size_t getReplications() const { return replications_; }
+
+    /**
+     * @brief 上次运行是否在达到最大重复次数之前满足了精度
+     * @return true表示已收敛
+     */
+    bool isConverged() const { return converged_; }
+
+    /**
+     * @brief 打印统计结果
+     * @param reports run()的返回值
+     */
+    void displayReports(const std::vector<MonteCarloReport>& reports) const;
+
+private:
+    /// 每个调度器每次重复的指标样本
+    struct Sample {
+        double waiting_time;
+        double turnaround_time;
+        double response_time;
+        double cpu_utilization;
+        double throughput;
+    };
+
+    WorkloadSpec spec_;                          ///< 负载分布
+    uint64_t seed_;                              ///< 随机种子
+    std::vector<std::string> labels_;            ///< 调度器标签
+    std::vector<SchedulerMaker> makers_;         ///< 调度器工厂
+    size_t replications_;                        ///< 上次运行的重复次数
+    bool converged_;                             ///< 上次运行是否收敛
+
+    /**
+     * @brief 由样本计算均值与置信区间
+     * @param values 样本
+     * @return 估计值
+     */
+    static MetricEstimate estimate(const std::vector<double>& values);
+
+    /**
+     * @brief 95%置信水平下Student t分布的双侧临界值
+     * @param degrees 自由度
+     * @return 临界值
+     */
+    static double tCritical(size_t degrees);
+
+    /**
+     * @brief 置信区间是否已足够窄
+     * @param metric 估计值
+     * @param options 控制参数
+     * @return true表示满足精度
+     */
+    static bool isPrecise(const MetricEstimate& metric, const MonteCarloOptions& options);
+};
+
+} // namespace ZTS_OS
+
+#endif // MONTE_CARLO_SIMULATOR_H
@@ -0,0 +1,325 @@
+#ifndef MULTI_CORE_SCHEDULER_H
+#define MULTI_CORE_SCHEDULER_H
+
+#include "Scheduler.h"
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @file MultiCoreScheduler.h
+ * @brief 异构多核调度模拟（各CPU速度不同，可选DVFS与功耗模型）
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @struct PerformanceState
+ * @brief 一个频率状态（P-state）
+ */
+struct PerformanceState {
+    double frequency;  ///< 相对频率，核心实际速度 = speed × frequency
+    double power;      ///< 该频率下运行时的功率
+};
+
+/**
+ * @struct IdleState
+ * @brief 一个空闲状态（C-state）
+ */
+struct IdleState {
+    std::string name;         ///< 名称（如"C1"、"C6"）
+    double power;             ///< 该状态下的功率
+    double target_residency;  ///< 空闲至少这么久才值得进入该状态
+};
+
+/**
+ * @struct CpuCore
+ * @brief 一个CPU核心的描述
+ *
+ * 执行时间为B的进程在速度为s、频率为f的核心上需要B/(s·f)个时间单位。
+ * 没有频率状态时核心以频率1.0、功率active_power运行；没有空闲状态时空闲功率为0。
+ */
+struct CpuCore {
+    int id;                                           ///< 核心编号
+    std::string core_class;                           ///< 核心类别（如"big"、"little"），按类别汇总统计
+    double speed;                                     ///< 速度倍率，1.0为基准核心
+    double active_power;                              ///< 满载时的相对功耗，用于能耗感知放置
+    std::vector<PerformanceState> performance_states; ///< 频率状态（添加时按频率升序排列）
+    std::vector<IdleState> idle_states;               ///< 空闲状态（添加时按目标驻留时间升序排列）
+
+    CpuCore(int core_id, const std::string& class_name, double speed_factor, double power = 1.0)
+        : id(core_id), core_class(class_name), speed(speed_factor), active_power(power) {}
+
+    /**
+     * @brief 按"静态功率 + 动态功率×f³"生成频率状态
+     * @param frequencies 相对频率列表，最高频率的功率为max_power
+     * @param max_power 最高频率下的功率
+     * @param static_power 与频率无关的静态功率
+     * @return 频率状态列表
+     */
+    static std::vector<PerformanceState> cubicPowerCurve(const std::vector<double>& frequencies,
+                                                         double max_power, double static_power);
+};
+
+/**
+ * @enum FrequencyGovernor
+ * @brief 频率调节器
+ */
+enum class FrequencyGovernor {
+    RACE_TO_IDLE,  ///< 运行时始终使用最高频率，尽快完成后进入空闲
+    ONDEMAND,      ///< 利用率超过阈值时升到最高频率，否则按利用率在最低和最高频率间线性选择
+    SCHEDUTIL      ///< 目标频率 = 1.25 × 利用率 × 最高频率
+};
+
+/**
+ * @enum PlacementPolicy
+ * @brief 就绪进程放到哪个空闲核心上
+ */
+enum class PlacementPolicy {
+    FASTEST_AVAILABLE,    ///< 最快的空闲核心
+    ENERGY_AWARE,         ///< 单位工作量能耗(功耗/速度)最低的空闲核心
+    AFFINITY_PRESERVING   ///< 优先上次运行的核心，其次同类别核心，避免迁移
+};
+
+/**
+ * @struct ProcessRunRecord
+ * @brief 一个进程在多核上的执行记录（时间可以是小数）
+ */
+struct ProcessRunRecord {
+    int pid;                      ///< 进程ID
+    std::string name;             ///< 进程名称
+    int arrival_time;             ///< 到达时间
+    int burst_time;               ///< 基准核心上的执行时间
+    double start_time;            ///< 首次运行时间
+    double completion_time;       ///< 完成时间
+    double service_time;          ///< 实际占用CPU执行的时间
+    double waiting_time;          ///< 等待时间（周转时间 - 执行时间，含迁移开销）
+    double turnaround_time;       ///< 周转时间
+    double response_time;         ///< 响应时间
+    int completion_core;          ///< 完成时所在的核心编号
+    std::string completion_class; ///< 完成时所在的核心类别
+    int migrations;               ///< 迁移次数
+
+    ProcessRunRecord()
+        : pid(0), arrival_time(0), burst_time(0), start_time(0), completion_time(0),
+          service_time(0), waiting_time(0), turnaround_time(0), response_time(0),
+          completion_core(-1), migrations(0) {}
+};
+
+/**
+ * @struct CoreReport
+ * @brief 单个核心的统计
+ */
+struct CoreReport {
+    int core_id;             ///< 核心编号
+    std::string core_class;  ///< 核心类别
+    double speed;            ///< 速度倍率
+    double busy_time;        ///< 忙碌时间（含迁移开销）
+    double work_done;        ///< 完成的工作量（基准时间单位）
+    double utilization;      ///< 利用率(%)
+    long long dispatches;    ///< 被分派进程的次数
+    double energy;           ///< 能耗（运行与空闲）
+    long long frequency_changes;  ///< 频率切换次数
+    std::vector<std::pair<double, double>> frequency_residency;   ///< 各频率的运行时间：(相对频率, 时间)
+    std::vector<std::pair<std::string, double>> idle_residency;   ///< 各空闲状态的驻留时间：(名称, 时间)
+};
+
+/**
+ * @struct CoreClassReport
+ * @brief 同类别核心的汇总统计
+ */
+struct CoreClassReport {
+    std::string core_class;          ///< 核心类别
+    size_t core_count;               ///< 核心数
+    double busy_time;                ///< 忙碌时间之和
+    double work_done;                ///< 完成的工作量之和
+    double utilization;              ///< 平均利用率(%)
+    double energy;                   ///< 能耗之和
+    size_t completed;                ///< 在该类核心上完成的进程数
+    double average_completion_time;  ///< 这些进程的平均完成时间
+    double average_turnaround_time;  ///< 这些进程的平均周转时间
+};
+
+/**
+ * @struct MultiCoreResult
+ * @brief 多核调度结果
+ */
+struct MultiCoreResult {
+    std::vector<ProcessRunRecord> processes;  ///< 进程执行记录，顺序与输入一致
+    std::vector<CoreReport> cores;            ///< 各核心统计
+    std::vector<CoreClassReport> classes;     ///< 各类别统计，按首次出现的顺序
+    double average_waiting_time;              ///< 平均等待时间
+    double average_turnaround_time;           ///< 平均周转时间
+    double average_response_time;             ///< 平均响应时间
+    double cpu_utilization;                   ///< 全部核心的平均利用率(%)
+    double throughput;                        ///< 吞吐率
+    double makespan;                          ///< 总执行时间
+    long long scheduling_decisions;           ///< 调度决策次数
+    long long migrations;                     ///< 迁移总次数
+    double energy;                            ///< 全部核心的能耗
+    double energy_delay_product;              ///< 能耗延迟积（能耗 × 总执行时间）
+    double performance_per_watt;              ///< 每单位能耗完成的工作量（基准时间单位）
+
+    MultiCoreResult()
+        : average_waiting_time(0), average_turnaround_time(0), average_response_time(0),
+          cpu_utilization(0), throughput(0), makespan(0), scheduling_decisions(0), migrations(0),
+          energy(0), energy_delay_product(0), performance_per_watt(0) {}
+};
+
+/**
+ * @class MultiCoreScheduler
+ * @brief 异构多核调度模拟器
+ *
+ * 全局就绪队列按单核调度算法的顺序（FCFS、时间片轮转、SJF、非抢占式优先级）出队，
+ * 再由放置策略决定使用哪个空闲核心。只有一个速度为1.0的核心时，
+ * 结果与src/scheduler/中对应的单核调度器一致，可直接对比
+ * （同时到达时FCFS按PID、其余顺序按输入顺序，与单核调度器相同）。
+ *
+ * 时间片轮转的时间片按实际时间计算，快核心在一个时间片内完成更多工作。
+ * 进程换到与上次不同的核心上运行时，先付出migration_cost的迁移开销（缓存重新预热）。
+ *
+ * 功耗模型：有多个频率状态的核心由频率调节器在分派时和运行中每个采样周期选择频率；
+ * 调节器使用的利用率是忙闲状态以采样周期为时间常数的指数滑动平均。
+ * 核心空闲一段时间后，按这段空闲的实际长度计入能进入的最低功率空闲状态（理想空闲调节器）。
+ */
+class MultiCoreScheduler {
+public:
+    /**
+     * @brief 构造函数
+     * @param order 就绪队列的出队顺序
+     * @param placement 放置策略
+     * @param time_quantum 时间片大小（仅用于时间片轮转）
+     * @throws std::invalid_argument 如果时间片不是正数
+     */
+    explicit MultiCoreScheduler(SchedulerFactory::SchedulerType order = SchedulerFactory::SchedulerType::FCFS,
+                                PlacementPolicy placement = PlacementPolicy::FASTEST_AVAILABLE,
+                                int time_quantum = 2);
+
+    /**
+     * @brief 添加一个核心
+     * @param core 核心描述
+     * @throws std::invalid_argument 如果速度或功耗不是正数，或编号重复
+     */
+    void addCore(const CpuCore& core);
+
+    /**
+     * @brief 添加一组相同的核心，编号接在已有核心之后
+     * @param core_class 核心类别
+     * @param count 核心数
+     * @param speed 速度倍率
+     * @param active_power 满载相对功耗
+     */
+    void addCores(const std::string& core_class, size_t count, double speed, double active_power = 1.0);
+
+    /**
+     * @brief 获取全部核心
+     * @return 核心列表
+     */
+    const std::vector<CpuCore>& getCores() const { return cores_; }
+
+    /**
+     * @brief 设置放置策略
+     * @param placement 放置策略
+     */
+    void setPlacementPolicy(PlacementPolicy placement) { placement_ = placement; }
+
+    /**
+     * @brief 获取放置策略
+     * @return 放置策略
+     */
+    PlacementPolicy getPlacementPolicy() const { return placement_; }
+
+    /**
+     * @brief 设置迁移开销
+     * @param cost 进程换核心运行时额外占用的时间
+     * @throws std::invalid_argument 如果为负数
+     */
+    void setMigrationCost(double cost);
+
+    /**
+     * @brief 获取迁移开销
+     * @return 迁移开销
+     */
+    double getMigrationCost() const { return migration_cost_; }
+
+    /**
+     * @brief 设置频率调节器
+     * @param governor 频率调节器
+     * @param sampling_period 采样周期，也是利用率滑动平均的时间常数
+     * @throws std::invalid_argument 如果采样周期不是正数
+     */
+    void setGovernor(FrequencyGovernor governor, double sampling_period = 4.0);
+
+    /**
+     * @brief 获取频率调节器
+     * @return 频率调节器
+     */
+    FrequencyGovernor getGovernor() const { return governor_; }
+
+    /**
+     * @brief 执行调度
+     * @param processes 待调度的进程列表
+     * @return 调度结果
+     * @throws std::invalid_argument 如果进程列表无效
+     * @throws std::logic_error 如果还没有添加核心
+     */
+    MultiCoreResult schedule(const ProcessList& processes) const;
+
+    /**
+     * @brief 打印调度结果
+     * @param result schedule()的返回值
+     */
+    static void displayResult(const MultiCoreResult& result);
+
+    /**
+     * @brief 获取放置策略名称
+     * @param placement 放置策略
+     * @return 名称
+     */
+    static std::string getPlacementPolicyName(PlacementPolicy placement);
+
+    /**
+     * @brief 获取频率调节器名称
+     * @param governor 频率调节器
+     * @return 名称
+     */
+    static std::string getGovernorName(FrequencyGovernor governor);
+
+private:
+    std::vector<CpuCore> cores_;             ///< 核心列表
+    SchedulerFactory::SchedulerType order_;  ///< 出队顺序
+    PlacementPolicy placement_;              ///< 放置策略
+    int time_quantum_;                       ///< 时间片大小
+    double migration_cost_;                  ///< 迁移开销
+    FrequencyGovernor governor_;             ///< 频率调节器
+    double sampling_period_;                 ///< 调节器采样周期
+
+    /**
+     * @brief 为进程选择空闲核心
+     * @param idle 各核心是否空闲
+     * @param last_core 进程上次运行的核心下标，-1表示从未运行
+     * @return 核心下标
+     */
+    size_t choosePlacement(const std::vector<bool>& idle, int last_core) const;
+
+    /**
+     * @brief 由调节器为核心选择频率状态
+     * @param core 核心下标
+     * @param utilization 核心当前的利用率滑动平均(0~1)
+     * @return 频率状态下标
+     */
+    size_t chooseFrequency(size_t core, double utilization) const;
+
+    /**
+     * @brief 核心满载时单位工作量的能耗，用于能耗感知放置
+     * @param core 核心下标
+     * @return 功率 / 实际速度
+     */
+    double energyPerWork(size_t core) const;
+};
+
+} // namespace ZTS_OS
+
+#endif // MULTI_CORE_SCHEDULER_H
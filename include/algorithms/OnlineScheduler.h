@@ -0,0 +1,242 @@
+#ifndef ONLINE_SCHEDULER_H
+#define ONLINE_SCHEDULER_H
+
+#include "Scheduler.h"
+#include <deque>
+#include <utility>
+
+/**
+ * @file OnlineScheduler.h
+ * @brief 在线(增量)调度器定义
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class OnlineScheduler
+ * @brief 在线调度器
+ *
+ * 与批处理式的schedule()不同，在线调度器支持边提交进程边推进时钟：
+ * - submit()     提交一个新进程（到达时间不得早于当前时钟）
+ * - advanceTo()  把模拟时钟推进到指定时刻
+ * - runUntilIdle() 一直运行到没有待到达、就绪或运行中的进程
+ * - pollCompletions() 取出自上次调用以来完成的进程
+ *
+ * 就绪结构在多次调用之间保持不变，整个输入流的总开销为O(事件数·log n)，
+ * 不需要每次都从时间0重新模拟。
+ */
+class OnlineScheduler : public Scheduler {
+public:
+    /**
+     * @brief 构造函数
+     * @param type 调度算法类型
+     * @param preemptive 是否抢占（对SJF即SRTF，对优先级调度即抢占式优先级）
+     * @param time_quantum 时间片大小（仅用于时间片轮转）
+     * @throws std::invalid_argument 如果时间片小于等于0
+     */
+    explicit OnlineScheduler(SchedulerFactory::SchedulerType type,
+                             bool preemptive = false,
+                             int time_quantum = 2);
+
+    /**
+     * @brief 析构函数
+     */
+    ~OnlineScheduler() override = default;
+
+    /**
+     * @brief 提交一个进程
+     * @param process 进程（状态会被重置）
+     * @return 进程句柄（提交序号）
+     * @throws std::invalid_argument 如果到达时间早于当前时钟
+     */
+    size_t submit(const Process& process);
+
+    /**
+     * @brief 修改一个尚未到达的进程（到达时间、执行时间、优先级等）
+     * @param handle 进程句柄
+     * @param process 新的进程参数
+     * @return true表示修改成功，false表示该进程已经到达
+     * @throws std::out_of_range 如果句柄无效
+     * @throws std::invalid_argument 如果新的到达时间早于当前时钟
+     */
+    bool revise(size_t handle, const Process& process);
+
+    /**
+     * @brief 推进模拟时钟到指定时刻
+     * @param time 目标时刻
+     * @throws std::invalid_argument 如果目标时刻早于当前时钟
+     */
+    void advanceTo(int time);
+
+    /**
+     * @brief 运行直到系统空闲（无待到达、就绪和运行中的进程）
+     * @return 空闲时的时钟
+     */
+    int runUntilIdle();
+
+    /**
+     * @brief 取出自上次调用以来完成的进程
+     * @return 按完成顺序排列的进程列表
+     */
+    std::vector<Process> pollCompletions();
+
+    /**
+     * @brief 清空全部状态，时钟回到0
+     */
+    void clear();
+
+    /**
+     * @brief 系统是否空闲
+     * @return true表示没有任何未完成的进程
+     */
+    bool isIdle() const;
+
+    /**
+     * @brief 获取当前时钟
+     * @return 当前时钟
+     */
+    int getCurrentTime() const { return clock_; }
+
+    /**
+     * @brief 获取已提交但尚未到达的进程数
+     * @return 待到达进程数
+     */
+    size_t getPendingCount() const { return pending_.size(); }
+
+    /**
+     * @brief 获取就绪进程数（不含正在运行的进程）
+     * @return 就绪进程数
+     */
+    size_t getReadyCount() const { return fifo_.size() + ready_heap_.size(); }
+
+    /**
+     * @brief 获取已提交的全部进程（按句柄索引）
+     * @return 进程列表
+     */
+    const ProcessList& getProcesses() const { return processes_; }
+
+    /**
+     * @brief 按当前已完成的进程计算统计结果
+     * @return 调度结果
+     */
+    SchedulingResult getResult() const;
+
+    /**
+     * @brief 批处理接口：清空状态，提交全部进程并运行到空闲
+     * @param processes 待调度的进程列表
+     * @return 调度结果
+     */
+    SchedulingResult schedule(const ProcessList& processes) override;
+
+    /**
+     * @brief 获取算法类型
+     * @return 算法类型字符串
+     */
+    std::string getAlgorithmType() const override;
+
+    /**
+     * @brief 是否为抢占式调度
+     * @return true表示抢占式，false表示非抢占式
+     */
+    bool isPreemptive() const override;
+
+    /**
+     * @brief 获取调度算法类型
+     * @return 调度算法类型
+     */
+    SchedulerFactory::SchedulerType getType() const { return type_; }
+
+    /**
+     * @brief 获取时间片大小
+     * @return 时间片大小
+     */
+    int getTimeQuantum() const { return time_quantum_; }
+
+private:
+    friend class SchedulerCheckpoint;
+    friend class WhatIfAnalyzer;
+
+    /// 堆元素：(排序键, 进程句柄)，键越小越优先，相同时句柄小者优先
+    using HeapEntry = std::pair<long long, size_t>;
+
+    SchedulerFactory::SchedulerType type_;  ///< 调度算法类型
+    bool preemptive_;                       ///< 是否抢占
+    int time_quantum_;                      ///< 时间片大小
+
+    ProcessList processes_;                 ///< 已提交的进程（按句柄索引）
+    std::vector<HeapEntry> pending_;        ///< 待到达进程的最小堆，键为到达时间
+    std::deque<size_t> fifo_;               ///< FCFS/RR的就绪队列
+    std::vector<HeapEntry> ready_heap_;     ///< SJF/SRTF/优先级的就绪最小堆
+    std::vector<size_t> completions_;       ///< 按完成顺序记录的进程句柄
+    size_t poll_cursor_;                    ///< pollCompletions的读取位置
+
+    int clock_;                             ///< 模拟时钟
+    int running_;                           ///< 正在运行的进程句柄，-1表示CPU空闲
+    int slice_left_;                        ///< 当前时间片剩余（仅RR）
+    size_t completed_count_;                ///< 已完成进程数
+    long long decisions_;                   ///< 调度决策（派发）次数
+
+    /**
+     * @brief 是否使用FIFO就绪队列
+     * @return true表示FCFS或RR
+     */
+    bool usesFifo() const;
+
+    /**
+     * @brief 计算进程在就绪堆中的排序键
+     * @param index 进程句柄
+     * @return 排序键
+     */
+    long long readyKey(size_t index) const;
+
+    /**
+     * @brief 将进程放入就绪结构
+     * @param index 进程句柄
+     */
+    void pushReady(size_t index);
+
+    /**
+     * @brief 从就绪结构取出下一个进程
+     * @return 进程句柄
+     */
+    size_t popReady();
+
+    /**
+     * @brief 将到达时间不晚于当前时钟的进程移入就绪结构
+     */
+    void admitArrivals();
+
+    /**
+     * @brief 抢占式策略下检查是否有更优的就绪进程
+     * @return true表示应当抢占当前进程
+     */
+    bool shouldPreempt() const;
+
+    /**
+     * @brief 让就绪结构中的下一个进程上CPU
+     */
+    void dispatch();
+
+    /**
+     * @brief 将当前进程放回就绪结构
+     */
+    void requeueRunning();
+
+    /**
+     * @brief 处理当前进程的完成
+     */
+    void completeRunning();
+
+    /**
+     * @brief 模拟到指定时刻（不做参数检查）
+     * @param limit 目标时刻
+     * @param stop_when_idle 系统空闲时是否立即返回
+     */
+    void simulate(int limit, bool stop_when_idle);
+};
+
+} // namespace ZTS_OS
+
+#endif // ONLINE_SCHEDULER_H
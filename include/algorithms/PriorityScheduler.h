@@ -1,7 +1,7 @@
 #ifndef PRIORITY_SCHEDULER_H
 #define PRIORITY_SCHEDULER_H
 
-#include "Scheduler.h"
+#include "BasicScheduler.h"
 
 /**
  * @file PriorityScheduler.h
@@ -12,12 +12,20 @@
 
 namespace ZTS_OS {
 
+/// 非抢占式优先级调度：选择优先级最高的进程，运行到完成
+using NonPreemptivePriorityPolicy = BasicScheduler<HighestPrioritySelect, NoPreemption, HeapReadyQueue>;
+
+/// 抢占式优先级调度：更高优先级的进程到达时抢占
+using PreemptivePriorityPolicy = BasicScheduler<HighestPrioritySelect, ArrivalPreemption, HeapReadyQueue>;
+
 /**
  * @class PriorityScheduler
  * @brief 优先级调度器
  * 
  * 实现基于优先级的调度算法，按照进程优先级进行调度。
  * 支持抢占式和非抢占式两种模式。
+ * 两种模式分别是BasicScheduler的一个实例，构造时选定，调度主循环中不再判断是否抢占。
+ * 优先级相同时先到达（下标小）的进程优先。
  */
 class PriorityScheduler : public Scheduler {
 public:
@@ -34,6 +42,15 @@ public:
      */
     SchedulingResult schedule(const ProcessList& processes) override;
     
+    /**
+     * @brief 在工作区中执行调度
+     * @param processes 待调度的进程列表
+     * @param workspace 工作区
+     * @return workspace.result的引用
+     */
+    const SchedulingResult& scheduleInto(const ProcessList& processes,
+                                         SchedulerWorkspace& workspace) override;
+    
     /**
      * @brief 获取算法类型
      * @return 算法类型字符串
@@ -52,36 +69,8 @@ public:
     void displayInfo() const override;
 
 private:
-    /**
-     * @brief 非抢占式优先级调度
-     * @param processes 进程列表
-     * @return 调度结果
-     */
-    SchedulingResult scheduleNonPreemptive(ProcessList& processes);
-    
-    /**
-     * @brief 抢占式优先级调度
-     * @param processes 进程列表
-     * @return 调度结果
-     */
-    SchedulingResult schedulePreemptive(ProcessList& processes);
-    
-    /**
-     * @brief 按优先级排序进程列表
-     * @param processes 进程列表
-     */
-    void sortByPriority(ProcessList& processes) const;
-    
-    /**
-     * @brief 找到最高优先级的进程
-     * @param processes 进程列表
-     * @param current_time 当前时间
-     * @return 进程索引，如果没有找到返回-1
-     */
-    int findHighestPriority(const ProcessList& processes, int current_time) const;
-
-private:
-    bool preemptive_;  ///< 是否为抢占式调度
+    bool preemptive_;         ///< 是否为抢占式调度
+    SchedulerPtr policy_;     ///< 对应模式的策略调度器
 };
 
 } // namespace ZTS_OS
@@ -1,8 +1,7 @@
 #ifndef ROUND_ROBIN_SCHEDULER_H
 #define ROUND_ROBIN_SCHEDULER_H
 
-#include "Scheduler.h"
-#include <queue>
+#include "BasicScheduler.h"
 
 /**
  * @file RoundRobinScheduler.h
@@ -23,8 +22,11 @@ namespace ZTS_OS {
  * - 进程在时间片内执行，超时则切换到下一个进程
  * - 适合分时系统，响应时间较好
  * - 时间片大小影响性能：过大退化为FCFS，过小增加切换开销
+ *
+ * 由BasicScheduler<按到达时间选择, 时间片抢占, FIFO队列>实例化。
+ * 时间片用完时，同一时刻新到达的进程排在被换下的进程之前。
  */
-class RoundRobinScheduler : public Scheduler {
+class RoundRobinScheduler : public BasicScheduler<ArrivalOrderSelect, TimeSlicePreemption, FifoReadyQueue> {
 public:
     /**
      * @brief 构造函数
@@ -37,13 +39,6 @@ public:
      */
     virtual ~RoundRobinScheduler() = default;
     
-    /**
-     * @brief 执行Round Robin调度算法
-     * @param processes 待调度的进程列表
-     * @return 调度结果
-     */
-    SchedulingResult schedule(const ProcessList& processes) override;
-    
     /**
      * @brief 获取算法类型
      * @return 算法类型字符串
@@ -65,7 +60,7 @@ public:
      * @brief 获取时间片大小
      * @return 时间片大小
      */
-    int getTimeQuantum() const { return time_quantum_; }
+    int getTimeQuantum() const { return preempt_.time_quantum; }
     
     /**
      * @brief 设置时间片大小
@@ -73,41 +68,6 @@ public:
      * @throws std::invalid_argument 如果时间片小于等于0
      */
     void setTimeQuantum(int time_quantum);
-
-private:
-    int time_quantum_;  ///< 时间片大小
-    
-    /**
-     * @brief 初始化就绪队列
-     * @param processes 进程列表
-     * @param ready_queue 就绪队列
-     * @param current_time 当前时间
-     */
-    void initializeReadyQueue(const ProcessList& processes, 
-                             std::queue<size_t>& ready_queue, 
-                             int current_time) const;
-    
-    /**
-     * @brief 检查并添加新到达的进程到就绪队列
-     * @param processes 进程列表
-     * @param ready_queue 就绪队列
-     * @param current_time 当前时间
-     * @param last_check_time 上次检查时间
-     */
-    void checkAndAddArrivedProcesses(const ProcessList& processes,
-                                   std::queue<size_t>& ready_queue,
-                                   int current_time,
-                                   int& last_check_time) const;
-    
-    /**
-     * @brief 显示当前就绪队列状态
-     * @param ready_queue 就绪队列
-     * @param processes 进程列表
-     * @param current_time 当前时间
-     */
-    void displayReadyQueue(const std::queue<size_t>& ready_queue,
-                          const ProcessList& processes,
-                          int current_time) const;
 };
 
 } // namespace ZTS_OS
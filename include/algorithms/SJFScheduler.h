@@ -1,7 +1,7 @@
 #ifndef SJF_SCHEDULER_H
 #define SJF_SCHEDULER_H
 
-#include "Scheduler.h"
+#include "BasicScheduler.h"
 
 /**
  * @file SJFScheduler.h
@@ -12,12 +12,19 @@
 
 namespace ZTS_OS {
 
+/// 非抢占式SJF：按执行时间选择，运行到完成
+using ShortestJobFirstPolicy = BasicScheduler<ShortestJobSelect, NoPreemption, HeapReadyQueue>;
+
+/// SRTF：按剩余时间选择，更短的进程到达时抢占
+using ShortestRemainingTimePolicy = BasicScheduler<ShortestJobSelect, ArrivalPreemption, HeapReadyQueue>;
+
 /**
  * @class SJFScheduler
  * @brief 最短作业优先调度器
  * 
  * 实现SJF调度算法，按照进程的执行时间长短进行调度。
  * 分为抢占式(SRTF)和非抢占式两种模式。
+ * 两种模式分别是BasicScheduler的一个实例，构造时选定，调度主循环中不再判断是否抢占。
  */
 class SJFScheduler : public Scheduler {
 public:
@@ -34,6 +41,15 @@ public:
      */
     SchedulingResult schedule(const ProcessList& processes) override;
     
+    /**
+     * @brief 在工作区中执行调度
+     * @param processes 待调度的进程列表
+     * @param workspace 工作区
+     * @return workspace.result的引用
+     */
+    const SchedulingResult& scheduleInto(const ProcessList& processes,
+                                         SchedulerWorkspace& workspace) override;
+    
     /**
      * @brief 获取算法类型
      * @return 算法类型字符串
@@ -52,36 +68,8 @@ public:
     void displayInfo() const override;
 
 private:
-    /**
-     * @brief 非抢占式SJF调度
-     * @param processes 进程列表
-     * @return 调度结果
-     */
-    SchedulingResult scheduleNonPreemptive(ProcessList& processes);
-    
-    /**
-     * @brief 抢占式SJF调度(SRTF)
-     * @param processes 进程列表
-     * @return 调度结果
-     */
-    SchedulingResult schedulePreemptive(ProcessList& processes);
-    
-    /**
-     * @brief 按执行时间排序进程列表
-     * @param processes 进程列表
-     */
-    void sortByBurstTime(ProcessList& processes) const;
-    
-    /**
-     * @brief 找到剩余时间最短的进程
-     * @param processes 进程列表
-     * @param current_time 当前时间
-     * @return 进程索引，如果没有找到返回-1
-     */
-    int findShortestRemainingTime(const ProcessList& processes, int current_time) const;
-
-private:
-    bool preemptive_;  ///< 是否为抢占式调度
+    bool preemptive_;         ///< 是否为抢占式调度
+    SchedulerPtr policy_;     ///< 对应模式的策略调度器
 };
 
 } // namespace ZTS_OS
@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <ostream>
 
 /**
  * @file Scheduler.h
@@ -15,6 +16,8 @@
 
 namespace ZTS_OS {
 
+struct SchedulerWorkspace;
+
 /**
  * @class Scheduler
  * @brief 抽象调度器基类
@@ -43,6 +46,19 @@ public:
      */
     virtual SchedulingResult schedule(const ProcessList& processes) = 0;
     
+    /**
+     * @brief 使用可复用的工作区执行调度
+     * 
+     * 结果保存在workspace.result中。默认实现调用schedule()后拷贝结果；
+     * 基于BasicScheduler的调度器直接在工作区中调度，稳定状态下不分配内存。
+     * 
+     * @param processes 待调度的进程列表
+     * @param workspace 工作区（同一时刻只能被一个调用使用）
+     * @return workspace.result的引用
+     */
+    virtual const SchedulingResult& scheduleInto(const ProcessList& processes,
+                                                 SchedulerWorkspace& workspace);
+    
     /**
      * @brief 获取调度器名称
      * @return 调度器名称
@@ -67,6 +83,38 @@ public:
      */
     virtual bool isPreemptive() const = 0;
     
+    /**
+     * @brief 设置是否输出调度过程跟踪信息
+     * @param enabled true表示输出到控制台（默认），false表示静默运行
+     */
+    void setTraceEnabled(bool enabled) { trace_enabled_ = enabled; }
+    
+    /**
+     * @brief 是否输出调度过程跟踪信息
+     * @return true表示输出
+     */
+    bool isTraceEnabled() const { return trace_enabled_; }
+    
+    /**
+     * @brief 设置单CPU功耗模型，用于计算结果中的能耗
+     * @param active_power 运行进程时的功率
+     * @param idle_power 空闲时的功率
+     * @throws std::invalid_argument 如果功率为负数
+     */
+    void setPowerModel(double active_power, double idle_power);
+    
+    /**
+     * @brief 获取运行功率
+     * @return 运行进程时的功率（默认0，即不计算能耗）
+     */
+    double getActivePower() const { return active_power_; }
+    
+    /**
+     * @brief 获取空闲功率
+     * @return 空闲时的功率
+     */
+    double getIdlePower() const { return idle_power_; }
+    
     /**
      * @brief 显示调度器信息
      */
@@ -91,6 +139,12 @@ public:
     static void displayStatistics(const SchedulingResult& result);
 
 protected:
+    /**
+     * @brief 获取调度过程跟踪输出流
+     * @return 启用跟踪时为std::cout，否则为丢弃所有输出的空流
+     */
+    std::ostream& trace() const;
+    
     /**
      * @brief 计算调度结果的统计信息
      * @param processes 进程列表
@@ -99,6 +153,13 @@ protected:
      */
     SchedulingResult calculateStatistics(const ProcessList& processes, int total_time) const;
     
+    /**
+     * @brief 按result.processes就地计算调度结果的统计信息
+     * @param result 调度结果（processes已填好，其余统计字段会被覆盖）
+     * @param total_time 总执行时间
+     */
+    void fillStatistics(SchedulingResult& result, int total_time) const;
+    
     /**
      * @brief 验证进程列表
      * @param processes 待验证的进程列表
@@ -123,6 +184,9 @@ protected:
 private:
     std::string name_;         ///< 调度器名称
     std::string description_;  ///< 调度器描述
+    bool trace_enabled_;       ///< 是否输出跟踪信息
+    double active_power_;      ///< 运行功率
+    double idle_power_;        ///< 空闲功率
 };
 
 /**
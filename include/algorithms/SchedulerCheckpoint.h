@@ -0,0 +1,135 @@
+#ifndef SCHEDULER_CHECKPOINT_H
+#define SCHEDULER_CHECKPOINT_H
+
+#include "OnlineScheduler.h"
+#include <cstdint>
+
+/**
+ * @file SchedulerCheckpoint.h
+ * @brief 调度器状态的二进制检查点与恢复
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class MappedFile
+ * @brief 只读内存映射文件
+ *
+ * Windows下使用CreateFileMapping/MapViewOfFile，其它平台使用mmap。
+ * 恢复检查点时直接从映射内存解析，避免先整体读入缓冲区。
+ */
+class MappedFile {
+public:
+    /**
+     * @brief 构造函数，映射整个文件
+     * @param path 文件路径
+     * @throws std::runtime_error 如果文件无法打开或映射
+     */
+    explicit MappedFile(const std::string& path);
+
+    /**
+     * @brief 析构函数，解除映射
+     */
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    /**
+     * @brief 获取映射起始地址
+     * @return 映射内存的首地址
+     */
+    const char* data() const { return data_; }
+
+    /**
+     * @brief 获取映射长度
+     * @return 字节数
+     */
+    size_t size() const { return size_; }
+
+private:
+    const char* data_;   ///< 映射首地址
+    size_t size_;        ///< 映射长度
+#ifdef _WIN32
+    void* file_handle_;     ///< 文件句柄
+    void* mapping_handle_;  ///< 映射句柄
+#else
+    int fd_;                ///< 文件描述符
+#endif
+};
+
+/**
+ * @class SchedulerCheckpoint
+ * @brief 在线调度器检查点
+ *
+ * 保存完整的模拟状态：时钟、运行中进程与时间片剩余、就绪队列、
+ * 待到达进程堆、每个进程的计数器以及完成序列。
+ * 检查点既可以写入文件（恢复时内存映射），也可以保存在内存缓冲区中。
+ */
+class SchedulerCheckpoint {
+public:
+    /// 检查点字节缓冲区
+    using Buffer = std::vector<char>;
+
+    /**
+     * @brief 将调度器状态序列化到内存缓冲区
+     * @param scheduler 在线调度器
+     * @return 检查点数据
+     */
+    static Buffer capture(const OnlineScheduler& scheduler);
+
+    /**
+     * @brief 从内存中的检查点恢复调度器状态
+     * @param scheduler 目标调度器（算法配置必须与检查点一致）
+     * @param data 检查点数据
+     * @param size 数据长度
+     * @throws std::runtime_error 如果数据损坏或配置不一致
+     */
+    static void restore(OnlineScheduler& scheduler, const char* data, size_t size);
+
+    /**
+     * @brief 从内存中的检查点恢复调度器状态
+     * @param scheduler 目标调度器
+     * @param buffer 检查点数据
+     */
+    static void restore(OnlineScheduler& scheduler, const Buffer& buffer) {
+        restore(scheduler, buffer.data(), buffer.size());
+    }
+
+    /**
+     * @brief 保存检查点到文件
+     * @param scheduler 在线调度器
+     * @param path 文件路径
+     * @throws std::runtime_error 如果写入失败
+     */
+    static void save(const OnlineScheduler& scheduler, const std::string& path);
+
+    /**
+     * @brief 通过内存映射从文件恢复调度器状态
+     * @param scheduler 目标调度器（算法配置必须与检查点一致）
+     * @param path 文件路径
+     */
+    static void load(OnlineScheduler& scheduler, const std::string& path);
+
+    /**
+     * @brief 通过内存映射从文件创建并恢复调度器
+     * @param path 文件路径
+     * @return 按检查点中的算法配置创建的调度器
+     */
+    static std::unique_ptr<OnlineScheduler> load(const std::string& path);
+
+private:
+    /**
+     * @brief 按检查点头部创建调度器
+     * @param data 检查点数据
+     * @param size 数据长度
+     * @return 新调度器
+     */
+    static std::unique_ptr<OnlineScheduler> createFor(const char* data, size_t size);
+};
+
+} // namespace ZTS_OS
+
+#endif // SCHEDULER_CHECKPOINT_H
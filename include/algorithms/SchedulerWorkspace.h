@@ -0,0 +1,37 @@
+#ifndef SCHEDULER_WORKSPACE_H
+#define SCHEDULER_WORKSPACE_H
+
+#include "../core/Process.h"
+#include <utility>
+#include <vector>
+
+/**
+ * @file SchedulerWorkspace.h
+ * @brief 调度器可复用的工作区
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @struct SchedulerWorkspace
+ * @brief 调度过程中使用的全部缓冲区
+ *
+ * 传给Scheduler::scheduleInto()后，每次调度只会清空并复用这些缓冲区而不释放。
+ * 对同一规模的负载反复调度（参数扫描、蒙特卡洛模拟）时，
+ * 第一次调用之后不再分配内存。
+ *
+ * 一个工作区同一时刻只能被一个调度调用使用；多线程时每个线程使用自己的工作区。
+ */
+struct SchedulerWorkspace {
+    SchedulingResult result;                        ///< 调度结果，result.processes同时作为调度时的工作副本
+    ProcessList staging;                            ///< 需要预处理输入时的暂存区（如FCFS按到达时间排序）
+    std::vector<size_t> arrivals;                   ///< 按到达时间排序的进程下标
+    std::vector<size_t> fifo;                       ///< FIFO就绪队列的环形缓冲区
+    std::vector<std::pair<long long, size_t>> heap; ///< 就绪堆
+};
+
+} // namespace ZTS_OS
+
+#endif // SCHEDULER_WORKSPACE_H
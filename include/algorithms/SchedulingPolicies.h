@@ -0,0 +1,174 @@
+#ifndef SCHEDULING_POLICIES_H
+#define SCHEDULING_POLICIES_H
+
+#include "../core/Process.h"
+#include "SchedulerWorkspace.h"
+#include <algorithm>
+#include <functional>
+#include <utility>
+#include <vector>
+
+/**
+ * @file SchedulingPolicies.h
+ * @brief BasicScheduler使用的编译期调度策略
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ *
+ * 一个调度算法由三类策略组合而成：
+ * - 选择策略(SelectPolicy)：  static long long key(const Process&)，键越小越优先，相同时下标小者优先
+ * - 抢占策略(PreemptPolicy)： 编译期常量kPreemptOnArrival/kTimeSliced决定何时让出CPU
+ * - 队列策略(QueuePolicy)：   就绪结构，由SchedulerWorkspace构造并使用其中的缓冲区，
+ *                             提供reset(进程总数)/push/pop/empty，有序队列还需提供top
+ *
+ * 策略全部是普通类型，由模板在编译期内联，调度主循环中没有虚函数调用。
+ */
+
+namespace ZTS_OS {
+
+// ==================== 选择策略 ====================
+
+/**
+ * @struct ArrivalOrderSelect
+ * @brief 按到达时间选择（FCFS、RR）
+ */
+struct ArrivalOrderSelect {
+    static long long key(const Process& process) { return process.getArrivalTime(); }
+};
+
+/**
+ * @struct ShortestJobSelect
+ * @brief 按剩余执行时间选择（非抢占时即SJF，抢占时即SRTF）
+ */
+struct ShortestJobSelect {
+    static long long key(const Process& process) { return process.getRemainingTime(); }
+};
+
+/**
+ * @struct HighestPrioritySelect
+ * @brief 按优先级选择，数值越小优先级越高
+ */
+struct HighestPrioritySelect {
+    static long long key(const Process& process) { return static_cast<int>(process.getPriority()); }
+};
+
+// ==================== 抢占策略 ====================
+
+/**
+ * @struct NoPreemption
+ * @brief 非抢占：进程一直运行到完成
+ */
+struct NoPreemption {
+    static constexpr bool kPreemptive = false;
+    static constexpr bool kPreemptOnArrival = false;
+    static constexpr bool kTimeSliced = false;
+};
+
+/**
+ * @struct ArrivalPreemption
+ * @brief 到达抢占：新进程到达时，若其键更优则抢占当前进程
+ */
+struct ArrivalPreemption {
+    static constexpr bool kPreemptive = true;
+    static constexpr bool kPreemptOnArrival = true;
+    static constexpr bool kTimeSliced = false;
+};
+
+/**
+ * @struct TimeSlicePreemption
+ * @brief 时间片抢占：进程最多运行一个时间片，用完后回到就绪队列
+ */
+struct TimeSlicePreemption {
+    static constexpr bool kPreemptive = true;
+    static constexpr bool kPreemptOnArrival = false;
+    static constexpr bool kTimeSliced = true;
+
+    int time_quantum;  ///< 时间片大小
+
+    explicit TimeSlicePreemption(int quantum = 2) : time_quantum(quantum) {}
+};
+
+// ==================== 队列策略 ====================
+
+/**
+ * @class FifoReadyQueue
+ * @brief 先进先出就绪队列，忽略选择键
+ *
+ * 每个进程同一时刻最多在队列中出现一次，因此用容量为进程总数的环形缓冲区即可。
+ */
+class FifoReadyQueue {
+public:
+    explicit FifoReadyQueue(SchedulerWorkspace& workspace)
+        : ring_(workspace.fifo), head_(0), size_(0) {}
+
+    void reset(size_t count) {
+        ring_.resize(count);
+        head_ = 0;
+        size_ = 0;
+    }
+
+    bool empty() const { return size_ == 0; }
+    size_t size() const { return size_; }
+
+    void push(long long /* key */, size_t index) {
+        size_t tail = head_ + size_;
+        if (tail >= ring_.size()) {
+            tail -= ring_.size();
+        }
+        ring_[tail] = index;
+        size_++;
+    }
+
+    size_t pop() {
+        size_t index = ring_[head_];
+        if (++head_ == ring_.size()) {
+            head_ = 0;
+        }
+        size_--;
+        return index;
+    }
+
+private:
+    std::vector<size_t>& ring_;  ///< 环形缓冲区（属于工作区）
+    size_t head_;                ///< 队首位置
+    size_t size_;                ///< 队列长度
+};
+
+/**
+ * @class HeapReadyQueue
+ * @brief 以(键, 下标)为序的二叉最小堆
+ */
+class HeapReadyQueue {
+public:
+    /// 堆元素：(选择键, 进程下标)
+    using Entry = std::pair<long long, size_t>;
+
+    explicit HeapReadyQueue(SchedulerWorkspace& workspace) : heap_(workspace.heap) {}
+
+    void reset(size_t count) {
+        heap_.clear();
+        heap_.reserve(count);
+    }
+
+    bool empty() const { return heap_.empty(); }
+    size_t size() const { return heap_.size(); }
+    const Entry& top() const { return heap_.front(); }
+
+    void push(long long key, size_t index) {
+        heap_.emplace_back(key, index);
+        std::push_heap(heap_.begin(), heap_.end(), std::greater<Entry>());
+    }
+
+    size_t pop() {
+        std::pop_heap(heap_.begin(), heap_.end(), std::greater<Entry>());
+        size_t index = heap_.back().second;
+        heap_.pop_back();
+        return index;
+    }
+
+private:
+    std::vector<Entry>& heap_;  ///< 堆数组（属于工作区）
+};
+
+} // namespace ZTS_OS
+
+#endif // SCHEDULING_POLICIES_H
@@ -0,0 +1,177 @@
+#ifndef WHAT_IF_ANALYZER_H
+#define WHAT_IF_ANALYZER_H
+
+#include "OnlineScheduler.h"
+
+/**
+ * @file WhatIfAnalyzer.h
+ * @brief 基于自动检查点的增量"假设分析"(what-if)重新模拟
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @struct WhatIfResult
+ * @brief 一次假设分析的结果
+ */
+struct WhatIfResult {
+    SchedulingResult result;   ///< 修改后的完整调度结果
+    int restored_from;         ///< 恢复所用检查点的时钟
+    int converged_at;          ///< 状态与基线重新一致的时钟，-1表示未收敛
+    int resimulated_until;     ///< 实际重新模拟到的时钟
+    size_t checkpoints_checked; ///< 比较过的检查点数量
+
+    WhatIfResult() : restored_from(0), converged_at(-1), resimulated_until(0), checkpoints_checked(0) {}
+};
+
+/**
+ * @class WhatIfAnalyzer
+ * @brief 假设分析器
+ *
+ * 先完整运行一次基线模拟，并每隔固定的模拟时间自动保存检查点。
+ * 修改某个作业后，只需从该作业到达之前最近的检查点恢复并向后模拟；
+ * 一旦在某个检查点处的运行状态与基线完全一致，之后的演化必然相同，
+ * 剩余进程直接沿用基线结果，模拟提前结束。
+ *
+ * 检查点只保存该时刻的"活跃"状态（运行中与就绪进程），
+ * 已完成进程沿用基线终值，未到达进程由原始输入还原，因此每个检查点的大小只与活跃进程数有关。
+ *
+ * 工作调度器在多次查询间复用：进程表平时与基线终值一致，只撤销上一次查询改写过的表项；
+ * 未到达的进程按到达顺序在模拟推进时才放入待到达堆。恢复的代价因此只与上次重新模拟的
+ * 范围和检查点的活跃进程数有关，与进程总数无关。
+ */
+class WhatIfAnalyzer {
+public:
+    /**
+     * @brief 构造函数
+     * @param type 调度算法类型
+     * @param preemptive 是否抢占
+     * @param time_quantum 时间片大小（仅用于时间片轮转）
+     * @param checkpoint_interval 自动检查点间隔（模拟时间单位）
+     * @throws std::invalid_argument 如果检查点间隔小于等于0
+     */
+    WhatIfAnalyzer(SchedulerFactory::SchedulerType type,
+                   bool preemptive = false,
+                   int time_quantum = 2,
+                   int checkpoint_interval = 100);
+
+    /**
+     * @brief 运行基线模拟并保存自动检查点
+     * @param processes 原始进程序列
+     * @return 基线调度结果
+     * @throws std::invalid_argument 如果进程列表为空，或有进程到达时间为负、执行时间不为正
+     */
+    const SchedulingResult& runBaseline(const ProcessList& processes);
+
+    /**
+     * @brief 修改一个作业并增量重新模拟
+     * @param job_index 作业在原始序列中的下标
+     * @param modified 修改后的作业（到达时间、执行时间、优先级）
+     * @return 假设分析结果
+     * @throws std::logic_error 如果尚未运行基线
+     * @throws std::out_of_range 如果下标无效
+     * @throws std::invalid_argument 如果修改后的到达时间为负或执行时间不为正
+     */
+    WhatIfResult query(size_t job_index, const Process& modified);
+
+    /**
+     * @brief 获取基线结果
+     * @return 基线调度结果
+     */
+    const SchedulingResult& getBaseline() const { return baseline_result_; }
+
+    /**
+     * @brief 获取自动检查点数量
+     * @return 检查点数量
+     */
+    size_t getCheckpointCount() const { return checkpoints_.size(); }
+
+private:
+    /**
+     * @struct LiveProcess
+     * @brief 检查点中活跃进程的动态计数器
+     */
+    struct LiveProcess {
+        size_t index;
+        int remaining_time;
+        int start_time;
+        int response_time;
+        bool first_run;
+
+        bool operator==(const LiveProcess& other) const {
+            return index == other.index && remaining_time == other.remaining_time &&
+                   start_time == other.start_time && response_time == other.response_time &&
+                   first_run == other.first_run;
+        }
+    };
+
+    /**
+     * @struct LiveCheckpoint
+     * @brief 自动检查点：某一时刻的活跃状态
+     */
+    struct LiveCheckpoint {
+        int clock;                    ///< 模拟时钟
+        int admitted_through;         ///< 到达时间不超过此值的进程都已被接纳（初始检查点为-1）
+        int running;                  ///< 运行中进程，-1表示空闲
+        int slice_left;               ///< 时间片剩余
+        long long decisions;          ///< 截至该时刻的调度决策次数
+        size_t completed;             ///< 截至该时刻的完成进程数
+        std::vector<std::pair<long long, size_t>> ready; ///< 就绪结构（FIFO保持顺序，堆按内容排序）
+        std::vector<LiveProcess> live; ///< 运行中与就绪进程的计数器（按下标排序）
+    };
+
+    SchedulerFactory::SchedulerType type_;  ///< 调度算法类型
+    bool preemptive_;                       ///< 是否抢占
+    int time_quantum_;                      ///< 时间片大小
+    int checkpoint_interval_;               ///< 检查点间隔
+
+    ProcessList trace_;                     ///< 原始进程序列
+    ProcessList baseline_final_;            ///< 基线运行结束时各进程的终值
+    std::vector<std::pair<long long, size_t>> arrival_order_; ///< 按(到达时间, 下标)排序的全部进程
+    SchedulingResult baseline_result_;      ///< 基线调度结果
+    std::vector<LiveCheckpoint> checkpoints_; ///< 自动检查点，按时钟递增
+    OnlineScheduler work_;                  ///< 重新模拟用的调度器（多次查询复用）
+    bool has_baseline_;                     ///< 是否已运行基线
+    size_t arrival_cursor_;                 ///< arrival_order_中下一个要放入待到达堆的位置
+    std::vector<size_t> touched_;           ///< 本次查询改写过的进程表项（下次恢复时撤销）
+
+    /**
+     * @brief 采集调度器当前的活跃状态
+     * @param scheduler 在线调度器
+     * @param admitted_through 已接纳的到达时间上界
+     * @return 活跃状态检查点
+     */
+    LiveCheckpoint captureLive(const OnlineScheduler& scheduler, int admitted_through) const;
+
+    /**
+     * @brief 把工作调度器恢复到指定检查点
+     * @param checkpoint 检查点
+     */
+    void restoreInto(const LiveCheckpoint& checkpoint);
+
+    /**
+     * @brief 把到达时间不超过limit的进程放入工作调度器的待到达堆
+     * @param limit 到达时间上界
+     * @param skip 被修改的作业（已单独放入，跳过其原始记录）
+     */
+    void feedArrivals(long long limit, size_t skip);
+
+    /**
+     * @brief 收敛后用基线终值补齐尚未完成的进程
+     * @param checkpoint 收敛处的检查点
+     */
+    void mergeWithBaseline(const LiveCheckpoint& checkpoint);
+
+    /**
+     * @brief 计算进程列表的最后完成时间
+     * @param processes 进程列表
+     * @return 最后完成时间
+     */
+    static int lastCompletion(const ProcessList& processes);
+};
+
+} // namespace ZTS_OS
+
+#endif // WHAT_IF_ANALYZER_H
@@ -75,6 +75,7 @@ public:
     // Setter 方法
     void setState(ProcessState state) { state_ = state; }
     void setPriority(ProcessPriority priority) { priority_ = priority; }
+    void setRemainingTime(int time) { remaining_time_ = time; }
     void setWaitingTime(int time) { waiting_time_ = time; }
     void setTurnaroundTime(int time) { turnaround_time_ = time; }
     void setResponseTime(int time) { response_time_ = time; }
@@ -143,11 +144,15 @@ struct SchedulingResult {
     double cpu_utilization;             // CPU利用率
     double throughput;                  // 吞吐率
     int total_time;                     // 总执行时间
+    long long scheduling_decisions;     // 调度决策次数（选择进程上CPU的次数）
+    double energy;                      // 能耗（未设置功耗模型时为0）
+    double energy_delay_product;        // 能耗延迟积（能耗 × 总执行时间）
     
     // 构造函数
     SchedulingResult() : average_waiting_time(0), average_turnaround_time(0),
                         average_response_time(0), cpu_utilization(0),
-                        throughput(0), total_time(0) {}
+                        throughput(0), total_time(0), scheduling_decisions(0),
+                        energy(0), energy_delay_product(0) {}
 };
 
 } // namespace ZTS_OS
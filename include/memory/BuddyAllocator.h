@@ -0,0 +1,168 @@
+#ifndef BUDDY_ALLOCATOR_H
+#define BUDDY_ALLOCATOR_H
+
+#include "MemoryManager.h"
+#include <cstdint>
+#include <unordered_map>
+
+/**
+ * @file BuddyAllocator.h
+ * @brief 二进制伙伴系统分配器定义
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class BuddyAllocator
+ * @brief 二进制伙伴系统
+ *
+ * 内存按2的幂大小的块管理，第k阶的块大小为2^k KB、起始地址是2^k的倍数。
+ * 每阶一条空闲链表，另有每阶一张位图记录“从某地址开始的该阶块是否空闲”，
+ * 地址为a的k阶块的伙伴是 a ^ 2^k，查位图即可知道伙伴能否合并，分割和合并都是O(log 总大小)。
+ *
+ * 请求大小向上取整到2的幂，多出的部分是内部碎片，与空闲块之间的外部碎片分开统计。
+ * 总大小不是2的幂时，内存被切成若干按地址对齐的最大块，伙伴超出总大小的块不再向上合并。
+ * 基类的块链表同步记录每一块（伙伴在地址上总是相邻），用于显示内存映射图。
+ */
+class BuddyAllocator : public MemoryManager {
+public:
+    /**
+     * @brief 构造函数
+     * @param total_size 总内存大小(KB)
+     * @throws std::invalid_argument 如果总大小为0
+     */
+    explicit BuddyAllocator(size_t total_size);
+
+    /**
+     * @brief 析构函数
+     */
+    ~BuddyAllocator() override = default;
+
+    /**
+     * @brief 分配内存，大小向上取整到2的幂
+     * @param size 请求大小
+     * @param process_id 进程ID
+     * @param name 块名称
+     * @return 分配的起始地址，失败返回-1
+     */
+    int allocateMemory(size_t size, int process_id, const std::string& name = "") override;
+
+    /**
+     * @brief 释放进程的全部内存，并逐阶与空闲伙伴合并
+     * @param process_id 进程ID
+     * @return 是否成功释放
+     */
+    bool deallocateMemory(int process_id) override;
+
+    /**
+     * @brief 显示内存状态
+     */
+    void displayMemoryStatus() const override;
+
+    /**
+     * @brief 伙伴系统的块必须按大小对齐，不做内存压缩
+     */
+    void compactMemory() override;
+
+    /**
+     * @brief 获取最大空闲块大小（最高的非空阶，O(log 总大小)）
+     * @return 最大空闲块大小
+     */
+    size_t getLargestFreeBlock() const override;
+
+    /**
+     * @brief 获取空闲块数量
+     * @return 空闲块数量
+     */
+    int getFreeBlockCount() const { return static_cast<int>(free_block_count_); }
+
+    /**
+     * @brief 获取进程实际请求的大小之和
+     * @return 请求大小之和
+     */
+    size_t getRequestedSize() const { return requested_size_; }
+
+    /**
+     * @brief 获取内部碎片程度
+     * @return 已分配块中未被请求使用的部分占已分配大小的百分比
+     */
+    double getInternalFragmentation() const;
+
+    /**
+     * @brief 获取最高阶数
+     * @return 最高阶数
+     */
+    int getMaxOrder() const { return max_order_; }
+
+    /**
+     * @brief 获取某一阶的空闲块数
+     * @param order 阶数
+     * @return 空闲块数
+     */
+    size_t getFreeCount(int order) const;
+
+protected:
+    /**
+     * @brief 查找能放下size的最小空闲块（不分割）
+     * @param size 需要的大小
+     * @return 块句柄，未找到返回-1
+     */
+    int findFreeBlock(size_t size) override;
+
+private:
+    /// 空闲链表的空指针
+    static constexpr size_t kNil = SIZE_MAX;
+
+    /// 一次分配的记录
+    struct Allocation {
+        size_t address;    ///< 起始地址
+        int order;         ///< 阶数
+        size_t requested;  ///< 请求大小
+    };
+
+    int max_order_;                                                ///< 最高阶数
+    std::vector<size_t> free_heads_;                               ///< 每阶空闲链表的表头地址
+    std::vector<size_t> free_counts_;                              ///< 每阶空闲块数
+    std::vector<size_t> free_next_;                                ///< 按地址索引的空闲链表后继
+    std::vector<size_t> free_prev_;                                ///< 按地址索引的空闲链表前驱
+    std::vector<std::vector<bool>> free_bitmap_;                   ///< [阶][地址>>阶]：该块是否空闲
+    std::vector<int> handle_at_;                                   ///< 块起始地址 -> 块链表句柄
+    std::unordered_map<int, std::vector<Allocation>> allocations_; ///< 进程ID -> 分配记录
+    size_t free_block_count_;                                      ///< 空闲块总数
+    size_t requested_size_;                                        ///< 请求大小之和
+
+    /**
+     * @brief 计算能放下size的最小阶数
+     * @param size 大小
+     * @return 阶数
+     */
+    static int orderFor(size_t size);
+
+    /**
+     * @brief 把块加入该阶的空闲链表并置位图
+     * @param address 起始地址
+     * @param order 阶数
+     */
+    void pushFree(size_t address, int order);
+
+    /**
+     * @brief 把块从该阶的空闲链表中摘下并清位图
+     * @param address 起始地址
+     * @param order 阶数
+     */
+    void removeFree(size_t address, int order);
+
+    /**
+     * @brief 判断块是否空闲
+     * @param address 起始地址
+     * @param order 阶数
+     * @return 是否空闲
+     */
+    bool isFree(size_t address, int order) const;
+};
+
+} // namespace ZTS_OS
+
+#endif // BUDDY_ALLOCATOR_H
@@ -2,6 +2,7 @@
 #define CONTIGUOUS_ALLOCATOR_H
 
 #include "MemoryManager.h"
+#include "FreeBlockIndex.h"
 
 /**
  * @file ContiguousAllocator.h
@@ -16,7 +17,10 @@ namespace ZTS_OS {
  * @class ContiguousAllocator
  * @brief 连续内存分配管理器
  * 
- * 实现首次适应、最佳适应、最坏适应和循环首次适应算法
+ * 实现首次适应、最佳适应、最坏适应和循环首次适应算法。
+ * 空闲块另外登记在FreeBlockIndex中，首次、最佳和最坏适应不再扫描全部内存块；
+ * 释放时只与地址上相邻的块合并，不触及其他块。每个进程的已分配块串成一条链表，
+ * 释放进程的内存只遍历它自己的块。
  */
 class ContiguousAllocator : public MemoryManager {
 public:
@@ -52,11 +56,11 @@ public:
      * @brief 显示内存状态
      */
     void displayMemoryStatus() const override;
-    
+
     /**
-     * @brief 显示内存映射图
+     * @brief 内存压缩（碎片整理），完成后重建空闲块索引
      */
-    void displayMemoryMap() const;
+    void compactMemory() override;
     
     /**
      * @brief 设置分配策略
@@ -65,7 +69,7 @@ public:
     void setAllocationStrategy(MemoryAllocationStrategy strategy) { 
         strategy_ = strategy; 
         if (strategy_ == MemoryAllocationStrategy::NEXT_FIT) {
-            next_fit_pointer_ = 0;
+            next_fit_pointer_ = memory_blocks_.head();
         }
     }
     
@@ -83,13 +87,13 @@ public:
     static std::string getStrategyName(MemoryAllocationStrategy strategy);
     
     /**
-     * @brief 获取最大空闲块大小
+     * @brief 获取最大空闲块大小（由空闲块索引维护，O(1)）
      * @return 最大空闲块大小
      */
-    size_t getLargestFreeBlock() const;
+    size_t getLargestFreeBlock() const override;
     
     /**
-     * @brief 获取空闲块数量
+     * @brief 获取空闲块数量（由空闲块索引维护，O(1)）
      * @return 空闲块数量
      */
     int getFreeBlockCount() const;
@@ -98,38 +102,51 @@ protected:
     /**
      * @brief 查找空闲块
      * @param size 需要的大小
-     * @return 块索引，未找到返回-1
+     * @return 块句柄，未找到返回-1
      */
     int findFreeBlock(size_t size) override;
 
 private:
-    int next_fit_pointer_;  ///< 循环首次适应的指针位置
+    int next_fit_pointer_;       ///< 循环首次适应下次开始查找的块句柄
+    FreeBlockIndex free_index_;  ///< 空闲块索引
+
+    /**
+     * @brief 按内存块列表重建空闲块索引
+     */
+    void rebuildFreeIndex();
+
+    /**
+     * @brief 释放一个已分配块并与相邻空闲块合并，同时维护空闲块索引
+     * @param block 句柄
+     * @return 合并后的块句柄
+     */
+    int releaseBlock(int block);
     
     /**
      * @brief 首次适应算法
      * @param size 需要的大小
-     * @return 块索引，未找到返回-1
+     * @return 块句柄，未找到返回-1
      */
     int firstFit(size_t size);
     
     /**
      * @brief 最佳适应算法
      * @param size 需要的大小
-     * @return 块索引，未找到返回-1
+     * @return 块句柄，未找到返回-1
      */
     int bestFit(size_t size);
     
     /**
      * @brief 最坏适应算法
      * @param size 需要的大小
-     * @return 块索引，未找到返回-1
+     * @return 块句柄，未找到返回-1
      */
     int worstFit(size_t size);
     
     /**
      * @brief 循环首次适应算法
      * @param size 需要的大小
-     * @return 块索引，未找到返回-1
+     * @return 块句柄，未找到返回-1
      */
     int nextFit(size_t size);
 };
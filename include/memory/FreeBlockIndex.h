@@ -0,0 +1,115 @@
+#ifndef FREE_BLOCK_INDEX_H
+#define FREE_BLOCK_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+/**
+ * @file FreeBlockIndex.h
+ * @brief 空闲块索引：按大小和按地址的两棵有序树
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class FreeBlockIndex
+ * @brief 连续分配中空闲块的索引
+ *
+ * 每个空闲块记录起始地址、大小和它在内存块链表中的句柄，查找直接返回句柄。
+ * 按(大小, 地址)排序的映射用于最佳适应和最坏适应，大小相同时取地址最小的块；
+ * 按地址排序的树堆(treap)在每个结点上记录子树中最大的空闲块大小，
+ * 首次适应沿着“左子树放得下就往左”的路径下降，找到地址最小的可用块。
+ * 三种查找都是O(log n)，结果与按地址顺序线性扫描全部空闲块相同。
+ */
+class FreeBlockIndex {
+public:
+    /**
+     * @brief 构造函数
+     */
+    FreeBlockIndex();
+
+    /**
+     * @brief 加入空闲块
+     * @param address 起始地址（不能与已有空闲块相同）
+     * @param size 大小
+     * @param block 内存块句柄
+     */
+    void insert(size_t address, size_t size, int block);
+
+    /**
+     * @brief 移除空闲块
+     * @param address 起始地址
+     * @param size 大小（必须与加入时相同）
+     */
+    void erase(size_t address, size_t size);
+
+    /**
+     * @brief 清空索引
+     */
+    void clear();
+
+    /**
+     * @brief 首次适应：地址最小的、大小不小于size的空闲块
+     * @param size 需要的大小
+     * @return 内存块句柄，没有则返回-1
+     */
+    int firstFit(size_t size) const;
+
+    /**
+     * @brief 最佳适应：大小不小于size的最小空闲块，同样大小取地址最小的
+     * @param size 需要的大小
+     * @return 内存块句柄，没有则返回-1
+     */
+    int bestFit(size_t size) const;
+
+    /**
+     * @brief 最坏适应：最大的空闲块，同样大小取地址最小的
+     * @param size 需要的大小
+     * @return 内存块句柄，最大块也放不下时返回-1
+     */
+    int worstFit(size_t size) const;
+
+    /**
+     * @brief 获取最大空闲块大小
+     * @return 大小，没有空闲块时为0
+     */
+    size_t largest() const { return by_size_.empty() ? 0 : by_size_.rbegin()->first.first; }
+
+    /**
+     * @brief 获取空闲块数量
+     * @return 数量
+     */
+    size_t count() const { return by_size_.size(); }
+
+private:
+    /// 树堆结点，按地址排序，优先级满足大根堆
+    struct Node {
+        size_t address;     ///< 起始地址
+        size_t size;        ///< 大小
+        size_t max_size;    ///< 子树中最大的空闲块大小
+        uint32_t priority;  ///< 随机优先级
+        int block;          ///< 内存块句柄
+        int left;           ///< 左子结点，-1表示空
+        int right;          ///< 右子结点，-1表示空
+    };
+
+    std::map<std::pair<size_t, size_t>, int> by_size_;  ///< (大小, 地址) -> 内存块句柄
+    std::vector<Node> nodes_;                           ///< 结点池
+    std::vector<int> free_nodes_;                       ///< 空闲结点
+    int root_;                                          ///< 根结点，-1表示空树
+    uint32_t seed_;                                     ///< 优先级生成器状态
+
+    size_t maxOf(int node) const { return node < 0 ? 0 : nodes_[node].max_size; }
+    void update(int node);
+    void split(int node, size_t address, int& left, int& right);
+    int merge(int left, int right);
+};
+
+} // namespace ZTS_OS
+
+#endif // FREE_BLOCK_INDEX_H
@@ -3,6 +3,7 @@
 
 #include <vector>
 #include <string>
+#include <ostream>
 #include <memory>
 #include <unordered_map>
 
@@ -34,12 +35,21 @@ enum class PageReplacementAlgorithm {
     FIFO,    ///< 先进先出
     LRU,     ///< 最近最少使用
     LFU,     ///< 最少使用频率
-    CLOCK    ///< 时钟算法
+    CLOCK,   ///< 时钟算法
+    ARC,         ///< 自适应置换缓存
+    TWO_QUEUE,   ///< 2Q
+    LIRS,        ///< 低跨度访问集
+    CLOCK_PRO,   ///< CLOCK-Pro
+    WS_CLOCK     ///< 工作集时钟
 };
 
 /**
  * @struct MemoryBlock
  * @brief 内存块结构
+ *
+ * prev/next是块在BlockList中的物理相邻块句柄，作用相当于堆分配器中的边界标记：
+ * 释放时不用查找就能看到左右两个邻居。owner_next把同一进程的已分配块串起来，
+ * 由分配器维护。
  */
 struct MemoryBlock {
     size_t start_address;  ///< 起始地址
@@ -47,13 +57,107 @@ struct MemoryBlock {
     bool is_free;         ///< 是否空闲
     int process_id;       ///< 占用进程ID（-1表示空闲）
     std::string name;     ///< 块名称
+    int prev;             ///< 地址上前一块的句柄（-1表示没有）
+    int next;             ///< 地址上后一块的句柄（-1表示没有）
+    int owner_next;       ///< 同一进程的后一块的句柄（-1表示没有）
     
     MemoryBlock(size_t start, size_t sz, bool free = true, int pid = -1, const std::string& n = "")
-        : start_address(start), size(sz), is_free(free), process_id(pid), name(n) {}
+        : start_address(start), size(sz), is_free(free), process_id(pid), name(n), prev(-1), next(-1),
+          owner_next(-1) {}
     
     size_t end_address() const { return start_address + size - 1; }
 };
 
+/**
+ * @class BlockList
+ * @brief 按地址排列的侵入式双向链表，结点放在结点池中
+ *
+ * 块用池中的下标（句柄）表示，删除的结点回收到空闲表中重复使用。
+ * 句柄在块被删除之前一直有效，分割和合并只改动相邻的几个结点，都是O(1)。
+ */
+class BlockList {
+public:
+    /**
+     * @brief 构造函数
+     */
+    BlockList();
+
+    /**
+     * @brief 获取第一块（地址最小）
+     * @return 句柄，空链表返回-1
+     */
+    int head() const { return head_; }
+
+    /**
+     * @brief 获取地址上的后一块
+     * @param block 句柄
+     * @return 句柄，没有返回-1
+     */
+    int next(int block) const { return nodes_[block].next; }
+
+    /**
+     * @brief 获取地址上的前一块
+     * @param block 句柄
+     * @return 句柄，没有返回-1
+     */
+    int prev(int block) const { return nodes_[block].prev; }
+
+    /**
+     * @brief 访问块
+     * @param block 句柄
+     * @return 内存块
+     */
+    MemoryBlock& operator[](int block) { return nodes_[block]; }
+    const MemoryBlock& operator[](int block) const { return nodes_[block]; }
+
+    /**
+     * @brief 获取块数
+     * @return 块数
+     */
+    size_t size() const { return count_; }
+
+    /**
+     * @brief 在链表末尾加入一块
+     * @param block 内存块
+     * @return 新块的句柄
+     */
+    int pushBack(const MemoryBlock& block);
+
+    /**
+     * @brief 在指定块之后插入一块
+     * @param position 句柄
+     * @param block 内存块
+     * @return 新块的句柄
+     */
+    int insertAfter(int position, const MemoryBlock& block);
+
+    /**
+     * @brief 删除一块，句柄回收
+     * @param block 句柄
+     */
+    void erase(int block);
+
+    /**
+     * @brief 清空链表
+     */
+    void clear();
+
+    /**
+     * @brief 按地址顺序复制出全部块
+     * @return 内存块列表
+     */
+    std::vector<MemoryBlock> toVector() const;
+
+private:
+    std::vector<MemoryBlock> nodes_;  ///< 结点池
+    std::vector<int> free_nodes_;     ///< 已回收的句柄
+    int head_;                        ///< 第一块
+    int tail_;                        ///< 最后一块
+    size_t count_;                    ///< 块数
+
+    int allocateNode(const MemoryBlock& block);
+};
+
 /**
  * @struct Page
  * @brief 页面结构
@@ -119,6 +223,12 @@ public:
      */
     double getFragmentation() const;
     
+    /**
+     * @brief 获取最大空闲块大小
+     * @return 最大空闲块大小（基类遍历全部块，派生类可用索引覆盖）
+     */
+    virtual size_t getLargestFreeBlock() const;
+    
     /**
      * @brief 显示内存状态
      */
@@ -126,9 +236,9 @@ public:
     
     /**
      * @brief 获取内存块列表
-     * @return 内存块列表
+     * @return 按地址顺序排列的内存块副本
      */
-    const std::vector<MemoryBlock>& getMemoryBlocks() const { return memory_blocks_; }
+    std::vector<MemoryBlock> getMemoryBlocks() const { return memory_blocks_.toVector(); }
     
     /**
      * @brief 获取总内存大小
@@ -140,41 +250,80 @@ public:
      * @brief 获取已使用内存大小
      * @return 已使用内存大小
      */
-    size_t getUsedSize() const;
+    size_t getUsedSize() const { return used_size_; }
     
     /**
      * @brief 获取空闲内存大小
      * @return 空闲内存大小
      */
-    size_t getFreeSize() const;
+    size_t getFreeSize() const { return total_size_ - used_size_; }
     
     /**
      * @brief 内存压缩（碎片整理）
      */
     virtual void compactMemory();
     
+    /**
+     * @brief 显示内存映射图
+     */
+    void displayMemoryMap() const;
+    
+    /**
+     * @brief 设置是否输出分配和释放的过程信息
+     * @param enabled true表示输出到控制台（默认），false表示静默运行
+     */
+    void setTraceEnabled(bool enabled) { trace_enabled_ = enabled; }
+    
+    /**
+     * @brief 是否输出分配和释放的过程信息
+     * @return true表示输出
+     */
+    bool isTraceEnabled() const { return trace_enabled_; }
+    
 protected:
     size_t total_size_;                    ///< 总内存大小
-    std::vector<MemoryBlock> memory_blocks_; ///< 内存块列表
+    size_t used_size_;                     ///< 已分配的大小，由派生类在分配和释放时维护
+    BlockList memory_blocks_;              ///< 内存块链表
     MemoryAllocationStrategy strategy_;     ///< 分配策略
+    std::unordered_map<int, int> owner_heads_; ///< 进程ID -> 该进程已分配块链表（owner_next）的第一块
+    bool trace_enabled_;                   ///< 是否输出过程信息
+    
+    /**
+     * @brief 获取过程信息输出流，关闭跟踪时输出被丢弃
+     * @return 输出流
+     */
+    std::ostream& trace() const;
+    
+    /**
+     * @brief 把已分配块加入所属进程的链表头部
+     * @param block 句柄
+     */
+    void linkOwner(int block);
+    
+    /**
+     * @brief 按内存块链表重建各进程的已分配块链表（压缩后句柄全部改变）
+     */
+    void rebuildOwnerIndex();
     
     /**
-     * @brief 合并相邻的空闲块
+     * @brief 把空闲块与地址上相邻的空闲块合并
+     * @param block 句柄（必须是空闲块）
+     * @return 合并后的块句柄，被并入的块的句柄失效
      */
-    void mergeAdjacentFreeBlocks();
+    int coalesceBlock(int block);
     
     /**
-     * @brief 分割内存块
-     * @param block_index 块索引
+     * @brief 分割内存块，剩余部分作为新的空闲块插在其后
+     * @param block 句柄
      * @param size 分割大小
-     * @return 新块的索引
+     * @return 原块的句柄，失败返回-1
      */
-    int splitBlock(int block_index, size_t size);
+    int splitBlock(int block, size_t size);
     
     /**
      * @brief 查找空闲块
      * @param size 需要的大小
-     * @return 块索引，未找到返回-1
+     * @return 块句柄，未找到返回-1
      */
     virtual int findFreeBlock(size_t size) = 0;
 };
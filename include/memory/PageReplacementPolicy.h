@@ -0,0 +1,361 @@
+#ifndef PAGE_REPLACEMENT_POLICY_H
+#define PAGE_REPLACEMENT_POLICY_H
+
+#include "MemoryManager.h"
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/**
+ * @file PageReplacementPolicy.h
+ * @brief 带历史信息的页面置换策略定义
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ *
+ * FIFO、LRU、LFU和CLOCK只依赖驻留页框自身的记录，由PagingManager直接维护。
+ * 这里的策略还要记住已被换出页面的历史（ARC的B1/B2、2Q的A1out、LIRS栈中的非驻留HIR页、
+ * CLOCK-Pro的测试页），因此以页面键（进程ID与页号的组合）识别页面，由PagingManager通过
+ * 下面的统一接口驱动：
+ * - onLoad：页面调入页框（缺页处理的最后一步）；
+ * - onHit：驻留页面被访问；
+ * - evict：没有空闲页框时选出牺牲页框，并把它从驻留簿记中移除（可能留下历史记录）；
+ * - onRemove：进程释放时页框被直接收回，不留历史记录。
+ * 各策略的命中和缺页处理都是均摊O(1)。
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class PageReplacementPolicy
+ * @brief 页面置换策略接口
+ */
+class PageReplacementPolicy {
+public:
+    /// 缺页时不知道将要调入哪个页面
+    static constexpr long long kNoPage = -1;
+
+    /**
+     * @brief 构造函数
+     * @param frames 页框数
+     */
+    explicit PageReplacementPolicy(size_t frames) : frames_(frames), frame_keys_(frames, kNoPage) {}
+
+    /**
+     * @brief 析构函数
+     */
+    virtual ~PageReplacementPolicy() = default;
+
+    /**
+     * @brief 页面调入页框
+     * @param frame 页框号
+     * @param key 页面键
+     */
+    virtual void onLoad(int frame, long long key) = 0;
+
+    /**
+     * @brief 驻留页面被访问
+     * @param frame 页框号
+     * @param is_write 是否为写操作
+     */
+    virtual void onHit(int frame, bool is_write) = 0;
+
+    /**
+     * @brief 选出牺牲页框并移出驻留簿记
+     * @param incoming 即将调入的页面键，未知时为kNoPage
+     * @return 牺牲页框号
+     */
+    virtual int evict(long long incoming) = 0;
+
+    /**
+     * @brief 页框被直接收回（进程释放）
+     * @param frame 页框号
+     */
+    virtual void onRemove(int frame) = 0;
+
+    /**
+     * @brief 获取策略名称
+     * @return 名称
+     */
+    virtual std::string getName() const = 0;
+
+    /**
+     * @brief 创建置换策略
+     * @param algorithm 置换算法
+     * @param frames 页框数
+     * @return 策略对象；FIFO、LRU、LFU、CLOCK由PagingManager直接处理，返回空指针
+     */
+    static std::unique_ptr<PageReplacementPolicy> create(PageReplacementAlgorithm algorithm, size_t frames);
+
+protected:
+    size_t frames_;                       ///< 页框数
+    std::vector<long long> frame_keys_;   ///< 页框中页面的键
+};
+
+/**
+ * @class ArcPolicy
+ * @brief 自适应置换缓存（ARC）
+ *
+ * T1保存只访问过一次的驻留页，T2保存访问过至少两次的驻留页，两者都按LRU排列；
+ * B1、B2分别记录最近从T1、T2换出的页面键。缺页命中B1说明T1太小，命中B2说明T2太小，
+ * 据此调整T1的目标大小p，在近期性和频率之间自适应。
+ */
+class ArcPolicy : public PageReplacementPolicy {
+public:
+    explicit ArcPolicy(size_t frames);
+    void onLoad(int frame, long long key) override;
+    void onHit(int frame, bool is_write) override;
+    int evict(long long incoming) override;
+    void onRemove(int frame) override;
+    std::string getName() const override { return "ARC"; }
+
+    /**
+     * @brief 获取T1的目标大小
+     * @return p
+     */
+    size_t getTarget() const { return target_; }
+
+private:
+    enum ListId { kT1, kT2, kB1, kB2, kListCount };
+
+    /// 链表节点：驻留页记录页框号，历史页的页框号为-1
+    struct Node {
+        long long key;
+        int frame;
+        int list;
+    };
+
+    std::list<Node> lists_[kListCount];                                ///< T1、T2、B1、B2，表头为LRU端
+    std::vector<std::list<Node>::iterator> frame_nodes_;              ///< 页框 -> 驻留节点
+    std::unordered_map<long long, std::list<Node>::iterator> ghosts_; ///< 历史页 -> 节点
+    size_t target_;                                                    ///< T1的目标大小p
+    long long prepared_;                                               ///< evict已为其做过调整的页面
+    int prepared_list_;                                                ///< 该页面应进入的链表
+
+    /**
+     * @brief 按ARC处理一次缺页：调整p、修剪历史，需要时选出牺牲页框
+     * @param key 缺页的页面键
+     * @param need_victim 是否需要牺牲页框
+     * @return 牺牲页框号，不需要时返回-1
+     */
+    int prepare(long long key, bool need_victim);
+
+    /**
+     * @brief 从T1或T2的LRU端换出一页，页面键记入对应的历史链表
+     * @param incoming_in_b2 缺页的页面是否命中B2
+     * @return 牺牲页框号
+     */
+    int replace(bool incoming_in_b2);
+
+    /**
+     * @brief 丢弃历史链表中最旧的记录
+     * @param list B1或B2
+     */
+    void dropGhost(int list);
+};
+
+/**
+ * @class TwoQueuePolicy
+ * @brief 2Q置换（完整版本）
+ *
+ * 新调入的页进入FIFO队列A1in，被换出时把页面键记入A1out；
+ * 只有在A1out中再次缺页的页面才进入按LRU管理的Am。一次性扫描的页面只在A1in中停留，
+ * 不会冲掉Am中反复访问的页面。A1in占页框的25%，A1out记录页框数50%的历史。
+ */
+class TwoQueuePolicy : public PageReplacementPolicy {
+public:
+    explicit TwoQueuePolicy(size_t frames);
+    void onLoad(int frame, long long key) override;
+    void onHit(int frame, bool is_write) override;
+    int evict(long long incoming) override;
+    void onRemove(int frame) override;
+    std::string getName() const override { return "2Q"; }
+
+private:
+    enum ListId { kA1in, kAm };
+
+    std::list<int> resident_[2];                                        ///< A1in（FIFO）与Am（LRU），表头先被淘汰
+    std::vector<std::list<int>::iterator> frame_nodes_;                ///< 页框在所属队列中的位置
+    std::vector<int> frame_list_;                                       ///< 页框所属队列
+    std::list<long long> a1out_;                                        ///< 换出历史，表头最旧
+    std::unordered_map<long long, std::list<long long>::iterator> a1out_index_; ///< 页面键 -> 历史位置
+    size_t in_limit_;                                                   ///< A1in的目标大小
+    size_t out_limit_;                                                  ///< A1out的容量
+};
+
+/**
+ * @class LirsPolicy
+ * @brief 低跨度访问集置换（LIRS）
+ *
+ * 按重用距离（两次访问之间访问过的不同页面数）区分LIR页和HIR页：大部分页框留给重用距离小的
+ * LIR页，只有约1%的页框轮换HIR页。栈S按最近访问排列，栈底总是LIR页；队列Q保存驻留的HIR页，
+ * 换出时淘汰Q的表头。在S中仍有记录的HIR页再次被访问说明其重用距离小于栈底LIR页，升级为LIR。
+ * S中保留的非驻留HIR页最多为页框数的两倍。
+ */
+class LirsPolicy : public PageReplacementPolicy {
+public:
+    explicit LirsPolicy(size_t frames);
+    void onLoad(int frame, long long key) override;
+    void onHit(int frame, bool is_write) override;
+    int evict(long long incoming) override;
+    void onRemove(int frame) override;
+    std::string getName() const override { return "LIRS"; }
+
+private:
+    /// 页面记录
+    struct Block {
+        int frame;                                  ///< 页框号，非驻留为-1
+        bool lir;                                   ///< 是否为LIR页
+        bool in_stack;                              ///< 是否在栈S中
+        bool in_queue;                              ///< 是否在队列Q中
+        std::list<long long>::iterator stack_pos;   ///< 在S中的位置
+        std::list<long long>::iterator queue_pos;   ///< 在Q中的位置
+        std::list<long long>::iterator ghost_pos;   ///< 在非驻留记录中的位置
+    };
+
+    std::unordered_map<long long, Block> blocks_;   ///< 页面键 -> 记录
+    std::list<long long> stack_;                    ///< 栈S，表尾为栈顶
+    std::list<long long> queue_;                    ///< 队列Q，表头先被淘汰
+    std::list<long long> ghosts_;                   ///< S中的非驻留HIR页，表头最旧
+    size_t lir_limit_;                              ///< LIR页的数量上限
+    size_t lir_count_;                              ///< LIR页数
+
+    /// 压入栈顶
+    void pushStack(long long key, Block& block);
+    /// 加入队尾
+    void pushQueue(long long key, Block& block);
+    /// 移出栈
+    void removeFromStack(Block& block);
+    /// 移出队列
+    void removeFromQueue(Block& block);
+
+    /**
+     * @brief 把已在栈顶的HIR页升级为LIR，LIR页超出上限时把栈底LIR页降为驻留HIR页
+     * @param block 页面记录
+     */
+    void promote(Block& block);
+
+    /**
+     * @brief 栈剪枝：移除栈底的HIR页直到栈底为LIR页
+     */
+    void prune();
+
+    /**
+     * @brief 限制栈中非驻留HIR页的数量
+     */
+    void trimGhosts();
+};
+
+/**
+ * @class ClockProPolicy
+ * @brief CLOCK-Pro置换
+ *
+ * 用时钟近似LIRS：页面分为热页、冷驻留页和处于测试期的非驻留冷页（测试页）。
+ * HAND_cold淘汰未被访问的冷页并把它保留为测试页，访问过的冷页升为热页；
+ * HAND_hot把未被访问的热页降为冷页；测试页按先后顺序结束测试期。
+ * 测试页在测试期内再次缺页，说明冷页的份额太小，冷页目标增加；测试期自然结束则减少。
+ * 与原算法一样，HAND_hot转过一整圈（越过测试页的位置）时测试期结束。
+ *
+ * 原算法三根指针在同一个环上转动，冷页很少时HAND_cold每次缺页都要越过大量热页和测试页。
+ * 这里热页、冷驻留页各排成一个时钟，测试页排成一个队列，每根指针只经过自己那一类页面：
+ * 每转一步要么消耗一次命中设置的访问位，要么改变一个页面的类别，命中和缺页都是均摊O(1)。
+ */
+class ClockProPolicy : public PageReplacementPolicy {
+public:
+    explicit ClockProPolicy(size_t frames);
+    void onLoad(int frame, long long key) override;
+    void onHit(int frame, bool is_write) override;
+    int evict(long long incoming) override;
+    void onRemove(int frame) override;
+    std::string getName() const override { return "CLOCK-Pro"; }
+
+    /**
+     * @brief 获取冷页目标数
+     * @return 冷页目标数
+     */
+    size_t getColdTarget() const { return cold_target_; }
+
+    /**
+     * @brief 获取各指针累计转动的步数
+     * @return 步数
+     */
+    long long getHandSteps() const { return hand_steps_; }
+
+private:
+    enum PageType { kHot, kCold };
+
+    std::list<int> hot_;                                ///< 热页时钟，表头为HAND_hot所指
+    std::list<int> cold_;                               ///< 冷驻留页时钟，表头为HAND_cold所指
+    std::vector<std::list<int>::iterator> frame_pos_;   ///< 页框在所属时钟中的位置
+    std::vector<int> frame_type_;                       ///< 页框中页面的类别
+    std::vector<char> referenced_;                      ///< 访问位
+    /// 测试页：页面键与测试期开始时HAND_hot的步数，表头最先开始测试期
+    std::list<std::pair<long long, long long>> tests_;
+    std::unordered_map<long long, std::list<std::pair<long long, long long>>::iterator> test_index_;  ///< 测试页索引
+    size_t cold_target_;                                ///< 冷页目标数
+    long long prepared_;                                ///< evict已为其处理过测试页的页面
+    bool prepared_hot_;                                 ///< 该页面是否以热页调入
+    long long hand_steps_;                              ///< 指针累计步数
+    long long hot_steps_;                               ///< HAND_hot累计步数
+
+    /**
+     * @brief 页面若是测试页则结束其测试并增大冷页目标
+     * @param key 页面键
+     * @return 是否为测试页
+     */
+    bool takeTest(long long key);
+
+    /// 转动HAND_cold一步，淘汰时返回页框，否则返回-1
+    int runHandCold();
+    /// 转动HAND_hot一步
+    void runHandHot();
+    /// 结束HAND_hot已转过一整圈的测试页的测试期
+    void expireTests();
+};
+
+/**
+ * @class WsClockPolicy
+ * @brief 工作集时钟置换（WSClock）
+ *
+ * 指针在页框环上转动：访问过的页清除访问位并记下当前虚拟时间；未访问且超出工作集窗口的页
+ * 若是干净页就淘汰，若被修改过则安排写回（模拟中立即完成，下一圈即为干净页）后继续转动。
+ * 转过一整圈仍没有可淘汰的页时，说明所有页都在工作集内，淘汰途中见到的最久未用的页。
+ * 虚拟时间按访问次数计。
+ */
+class WsClockPolicy : public PageReplacementPolicy {
+public:
+    /**
+     * @brief 构造函数
+     * @param frames 页框数
+     * @param window 工作集窗口（访问次数），0表示取页框数的两倍
+     */
+    explicit WsClockPolicy(size_t frames, long long window = 0);
+    void onLoad(int frame, long long key) override;
+    void onHit(int frame, bool is_write) override;
+    int evict(long long incoming) override;
+    void onRemove(int frame) override;
+    std::string getName() const override { return "WSClock"; }
+
+    /**
+     * @brief 获取安排写回的次数
+     * @return 写回次数
+     */
+    long long getWriteBackCount() const { return write_backs_; }
+
+private:
+    std::vector<uint8_t> referenced_;    ///< 访问位
+    std::vector<uint8_t> dirty_;         ///< 修改位
+    std::vector<uint8_t> resident_;      ///< 页框是否驻留
+    std::vector<long long> last_use_;    ///< 最近使用的虚拟时间
+    long long window_;                   ///< 工作集窗口
+    long long now_;                      ///< 虚拟时间
+    long long write_backs_;              ///< 写回次数
+    size_t hand_;                        ///< 时钟指针
+};
+
+} // namespace ZTS_OS
+
+#endif // PAGE_REPLACEMENT_POLICY_H
@@ -0,0 +1,83 @@
+#ifndef PAGE_TRACE_ANALYZER_H
+#define PAGE_TRACE_ANALYZER_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @file PageTraceAnalyzer.h
+ * @brief 页面访问序列的离线分析
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class PageTraceAnalyzer
+ * @brief 页面访问序列离线分析器
+ *
+ * 在完整的访问序列上计算在线置换算法无法得到的参考值，
+ * 用来衡量各置换算法离最优还有多远。
+ */
+class PageTraceAnalyzer {
+public:
+    /// 之后不再被访问的下次使用位置
+    static constexpr size_t kNeverUsed = static_cast<size_t>(-1);
+
+    /**
+     * @brief 计算每次访问的页面下一次被访问的位置
+     *
+     * 从后向前扫描一遍，用哈希表记住每个页面最近一次（即更靠后）出现的位置。
+     *
+     * @param trace 页面访问序列
+     * @return 与序列等长的数组，next_use[i]为trace[i]下一次出现的下标，不再出现为kNeverUsed
+     */
+    static std::vector<size_t> computeNextUse(const std::vector<int>& trace);
+
+    /**
+     * @brief 计算Belady最优置换（OPT）的缺页次数
+     *
+     * 缺页且页框已满时淘汰下一次使用最远的页面。驻留页面按下一次使用位置放在最大堆里，
+     * 命中时只压入新位置，旧记录留在堆里，弹出时再与驻留表核对丢弃；堆中过期记录
+     * 超过页框数时按驻留表重建，堆的大小始终不超过页框数的两倍。
+     * 总时间O(n log frames)，额外空间为一个n项的下次使用数组加O(frames)。
+     *
+     * @param trace 页面访问序列
+     * @param frames 物理页框数
+     * @return 缺页次数（包括冷启动缺页）
+     * @throws std::invalid_argument 如果页框数为0
+     */
+    static long long countOptimalFaults(const std::vector<int>& trace, size_t frames);
+
+    /**
+     * @brief 一遍扫描计算LRU在所有页框数下的缺页次数（Mattson栈距离）
+     *
+     * LRU具有栈性质：c个页框时驻留的页面恰好是LRU栈顶的c个页面，访问命中当且仅当
+     * 其栈距离（上次访问以来访问过的不同页面数，含自身）不超过c。
+     * 栈距离用树状数组求：每个页面只在最近一次访问的位置上记1，
+     * 上次访问位置之后的前缀和之差就是期间访问过的不同页面数。时间O(n log n)，空间O(n)。
+     *
+     * @param trace 页面访问序列
+     * @return 下标为页框数的缺页次数，从0一直到不同页面数（之后只剩冷启动缺页，不再下降）
+     */
+    static std::vector<long long> computeLruFaultCurve(const std::vector<int>& trace);
+
+    /**
+     * @brief 按页面哈希抽样近似计算LRU缺页曲线（SHARDS）
+     *
+     * 只保留哈希值落在抽样比例以内的页面的全部访问，在子序列上求栈距离，
+     * 再把距离和次数都按1/抽样比例放大。同一页面要么全部被抽中要么全不抽中，
+     * 子序列中的栈距离是原栈距离的无偏缩小。抽样比例为0.01时时间和空间约为精确计算的1%。
+     *
+     * @param trace 页面访问序列
+     * @param sampling_rate 抽样比例，(0, 1]
+     * @return 下标为页框数的缺页次数估计
+     * @throws std::invalid_argument 如果抽样比例不在(0, 1]内
+     */
+    static std::vector<long long> estimateLruFaultCurve(const std::vector<int>& trace, double sampling_rate);
+};
+
+} // namespace ZTS_OS
+
+#endif // PAGE_TRACE_ANALYZER_H
@@ -2,8 +2,13 @@
 #define PAGING_MANAGER_H
 
 #include "MemoryManager.h"
+#include "PageReplacementPolicy.h"
+#include <cstdint>
+#include <memory>
 #include <queue>
 #include <list>
+#include <unordered_map>
+#include <vector>
 
 /**
  * @file PagingManager.h
@@ -23,12 +28,12 @@ struct PageFrame {
     bool is_free;          ///< 是否空闲
     int process_id;        ///< 占用进程ID
     int page_number;       ///< 页号
-    int reference_bit;     ///< 引用位（时钟算法用）
-    int access_time;       ///< 访问时间
-    int access_count;      ///< 访问次数
+    long long load_time;   ///< 调入时间
+    long long access_time; ///< 最近访问时间
+    long long access_count;///< 调入以来的访问次数
     
     PageFrame(int fn) : frame_number(fn), is_free(true), process_id(-1), 
-                       page_number(-1), reference_bit(0), access_time(0), access_count(0) {}
+                       page_number(-1), load_time(0), access_time(0), access_count(0) {}
 };
 
 /**
@@ -49,6 +54,15 @@ struct PageTableEntry {
 /**
  * @class PagingManager
  * @brief 分页内存管理器
+ *
+ * 请求调页：allocatePages只建立页表，页面在第一次访问时经handlePageFault调入。
+ * 每次访问都设置页框的引用位（模拟硬件的访问位），位数组按64个页框一个字压缩存放。
+ * 各置换算法的簿记在命中和缺页时都是O(1)：
+ * - FIFO、LRU共用一条按页框号索引迭代器的链表，LRU命中时把页框移到表尾，FIFO不动；
+ * - LFU按访问次数分桶，桶内按进入顺序排列，淘汰最小次数桶的表头；
+ * - CLOCK在引用位数组上按字扫描，一次跳过64个已被访问的页框。
+ * ARC、2Q、LIRS、CLOCK-Pro和WSClock需要记住换出页面的历史，由PageReplacementPolicy对象处理。
+ * 切换算法时按页框记录的调入时间、访问时间和次数重建所选算法的簿记（换出历史不保留）。
  */
 class PagingManager {
 public:
@@ -57,6 +71,7 @@ public:
      * @param total_memory 总内存大小(KB)
      * @param page_size 页面大小(KB)
      * @param replacement_algorithm 页面置换算法
+     * @throws std::invalid_argument 如果页面大小为0或总内存容纳不下一个页面
      */
     PagingManager(size_t total_memory, size_t page_size = 4, 
                   PageReplacementAlgorithm replacement_algorithm = PageReplacementAlgorithm::FIFO);
@@ -70,7 +85,7 @@ public:
      * @brief 分配页面给进程
      * @param process_id 进程ID
      * @param pages_needed 需要的页面数
-     * @return 是否分配成功
+     * @return 是否分配成功（页面数为0时失败），进程已有页表时在末尾追加
      */
     bool allocatePages(int process_id, size_t pages_needed);
     
@@ -86,7 +101,8 @@ public:
      * @param process_id 进程ID
      * @param virtual_address 虚拟地址
      * @param is_write 是否为写操作
-     * @return 物理地址，页错误返回-1
+     * @return 物理地址，页错误返回-1（页错误已计数，调用者用handlePageFault调入页面）
+     * @throws std::invalid_argument 如果进程没有页表或地址超出页表范围
      */
     int accessPage(int process_id, size_t virtual_address, bool is_write = false);
     
@@ -94,13 +110,17 @@ public:
      * @brief 处理页错误
      * @param process_id 进程ID
      * @param page_number 页号
-     * @return 分配的页框号，失败返回-1
+     * @return 分配的页框号，失败返回-1；页面已在内存时直接返回其页框号
+     * @throws std::invalid_argument 如果进程没有页表或页号超出页表范围
      */
     int handlePageFault(int process_id, int page_number);
     
     /**
-     * @brief 页面置换
-     * @return 被置换的页框号
+     * @brief 页面置换：按当前算法选出牺牲页框并把其中的页面换出
+     *
+     * 只在页框全部占用时置换，换出后的页框回到空闲页框队列。
+     *
+     * @return 被置换的页框号，还有空闲页框时返回-1
      */
     int replaceePage();
     
@@ -130,7 +150,28 @@ public:
      * @brief 获取页错误次数
      * @return 页错误次数
      */
-    int getPageFaultCount() const { return page_fault_count_; }
+    long long getPageFaultCount() const { return page_fault_count_; }
+    
+    /**
+     * @brief 获取页面访问次数
+     * @return 访问次数
+     */
+    long long getAccessCount() const { return access_count_; }
+    
+    /**
+     * @brief 获取缺页率
+     * @return 缺页次数占访问次数的百分比
+     */
+    double getPageFaultRate() const;
+    
+    /**
+     * @brief 获取页框的引用位
+     * @param frame_number 页框号
+     * @return 引用位
+     */
+    bool getReferenceBit(int frame_number) const {
+        return (reference_bits_[frame_number >> 6] >> (frame_number & 63)) & 1u;
+    }
     
     /**
      * @brief 获取页框总数
@@ -145,12 +186,16 @@ public:
     size_t getPageSize() const { return page_size_; }
     
     /**
-     * @brief 设置页面置换算法
+     * @brief 获取页面置换算法
+     * @return 置换算法
+     */
+    PageReplacementAlgorithm getReplacementAlgorithm() const { return replacement_algorithm_; }
+    
+    /**
+     * @brief 设置页面置换算法，并按页框记录重建该算法的簿记
      * @param algorithm 置换算法
      */
-    void setReplacementAlgorithm(PageReplacementAlgorithm algorithm) { 
-        replacement_algorithm_ = algorithm; 
-    }
+    void setReplacementAlgorithm(PageReplacementAlgorithm algorithm);
 
 private:
     size_t total_memory_;                  ///< 总内存大小
@@ -163,13 +208,18 @@ private:
     std::queue<int> free_frames_;          ///< 空闲页框队列
     
     // 页面置换算法相关
-    std::queue<int> fifo_queue_;           ///< FIFO队列
-    std::list<int> lru_list_;             ///< LRU链表
-    std::unordered_map<int, int> lfu_count_; ///< LFU计数
+    std::list<int> lru_list_;              ///< FIFO/LRU链表，表头最先被淘汰
+    std::vector<std::list<int>::iterator> lru_position_; ///< 页框在链表中的位置
+    std::unordered_map<long long, std::list<int>> lfu_buckets_; ///< LFU：访问次数 -> 页框链表
+    std::vector<std::list<int>::iterator> lfu_position_; ///< 页框在所属桶中的位置
+    long long lfu_min_count_;              ///< 非空桶中最小的访问次数
+    std::vector<uint64_t> reference_bits_; ///< 引用位数组，每个页框一位
     int clock_pointer_;                    ///< 时钟指针
+    std::unique_ptr<PageReplacementPolicy> policy_; ///< 带历史信息的置换策略，基本算法为空
     
-    int page_fault_count_;                 ///< 页错误计数
-    int current_time_;                     ///< 当前时间
+    long long page_fault_count_;           ///< 页错误计数
+    long long access_count_;               ///< 访问计数
+    long long current_time_;               ///< 当前时间
     
     /**
      * @brief FIFO页面置换
@@ -202,6 +252,56 @@ private:
      */
     void updatePageAccess(int frame_number, bool is_write);
     
+    /**
+     * @brief 把刚调入的页框加入当前算法的簿记
+     * @param frame_number 页框号
+     */
+    void trackFrame(int frame_number);
+    
+    /**
+     * @brief 把页框从当前算法的簿记中移除
+     * @param frame_number 页框号
+     */
+    void untrackFrame(int frame_number);
+    
+    /**
+     * @brief 换出页框中的页面：移出置换簿记后释放页框
+     * @param frame_number 页框号
+     */
+    void evictFrame(int frame_number);
+    
+    /**
+     * @brief 更新页框中页面的页表项并清空页框
+     * @param frame_number 页框号
+     */
+    void releaseFrame(int frame_number);
+    
+    /**
+     * @brief 按当前算法选出牺牲页框并换出
+     * @param incoming 即将调入的页面键，未知时为PageReplacementPolicy::kNoPage
+     * @return 被置换的页框号，没有已占用的页框时返回-1
+     */
+    int replacePage(long long incoming);
+    
+    /**
+     * @brief 计算页面键
+     * @param process_id 进程ID
+     * @param page_number 页号
+     * @return 进程ID在高32位、页号在低32位的键
+     */
+    static long long pageKey(int process_id, int page_number) {
+        return (static_cast<long long>(process_id) << 32) | static_cast<uint32_t>(page_number);
+    }
+    
+    /**
+     * @brief 查找进程的页表项
+     * @param process_id 进程ID
+     * @param page_number 页号
+     * @return 页表项
+     * @throws std::invalid_argument 如果进程没有页表或页号超出范围
+     */
+    PageTableEntry& pageEntry(int process_id, size_t page_number);
+    
     /**
      * @brief 获取虚拟地址的页号
      * @param virtual_address 虚拟地址
@@ -0,0 +1,228 @@
+#ifndef SLAB_ALLOCATOR_H
+#define SLAB_ALLOCATOR_H
+
+#include "MemoryManager.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @file SlabAllocator.h
+ * @brief 固定大小对象缓存（slab分配器）定义
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @struct SlabCacheStats
+ * @brief 单个对象缓存的统计
+ */
+struct SlabCacheStats {
+    std::string name;           ///< 缓存名称
+    size_t object_size;         ///< 对象大小（字节）
+    size_t objects_per_slab;    ///< 每个slab的对象数
+    size_t full_slabs;          ///< 全满slab数
+    size_t partial_slabs;       ///< 部分使用slab数
+    size_t empty_slabs;         ///< 空slab数
+    size_t active_objects;      ///< 已分配对象数
+    size_t total_objects;       ///< 全部slab能容纳的对象数
+    long long allocations;      ///< 分配次数
+    long long frees;            ///< 释放次数
+    long long slab_grows;       ///< 向页面来源申请slab的次数
+    long long slab_shrinks;     ///< 把空slab还给页面来源的次数
+    long long failures;         ///< 页面来源没有空间导致的分配失败次数
+    double utilization;         ///< 已分配对象字节数占slab总字节数的百分比
+
+    SlabCacheStats()
+        : object_size(0), objects_per_slab(0), full_slabs(0), partial_slabs(0), empty_slabs(0),
+          active_objects(0), total_objects(0), allocations(0), frees(0), slab_grows(0),
+          slab_shrinks(0), failures(0), utilization(0) {}
+};
+
+/**
+ * @class SlabAllocator
+ * @brief 建立在页面来源之上的对象缓存
+ *
+ * 每个缓存只分配一种大小的对象，向页面来源（任意MemoryManager，例如BuddyAllocator）
+ * 一次申请slab_size KB作为一个slab，切成等大的对象。空闲对象在slab内串成单链表，
+ * 链接保存在每个slab的下标数组next中（模拟器不持有对象内存），分配和释放都是O(1)。
+ * slab按全满、部分使用、空三种状态挂在缓存的三条链表上，分配优先使用部分使用的slab；
+ * 每个缓存最多保留max_empty_slabs个空slab，多余的还给页面来源。
+ *
+ * 对象地址以字节为单位（slab起始地址KB × 1024 + 对象下标 × 对象大小），
+ * 按1KB页登记所属slab，释放时由地址直接找到slab。
+ * kmalloc按2的幂大小类别自动建立kmalloc-8、kmalloc-16……缓存。
+ */
+class SlabAllocator {
+public:
+    /// slab在页面来源中使用的进程ID起点，第i个slab的ID为kSlabOwnerBase + i
+    static constexpr int kSlabOwnerBase = 1 << 20;
+
+    /// kmalloc最小的大小类别（字节）
+    static constexpr size_t kMinKmallocSize = 8;
+
+    /**
+     * @brief 构造函数
+     * @param page_source 页面来源，slab从这里分配
+     * @param slab_size 每个slab的大小(KB)
+     * @param max_empty_slabs 每个缓存最多保留的空slab数
+     * @throws std::invalid_argument 如果slab大小为0
+     */
+    explicit SlabAllocator(MemoryManager& page_source, size_t slab_size = 4, size_t max_empty_slabs = 1);
+
+    /**
+     * @brief 创建对象缓存
+     * @param name 缓存名称
+     * @param object_size 对象大小（字节）
+     * @return 缓存ID
+     * @throws std::invalid_argument 如果对象大小为0或超过slab大小
+     */
+    int createCache(const std::string& name, size_t object_size);
+
+    /**
+     * @brief 从缓存分配一个对象
+     * @param cache 缓存ID
+     * @return 对象地址（字节），页面来源没有空间时返回-1
+     * @throws std::invalid_argument 如果缓存ID无效
+     */
+    long long allocate(int cache);
+
+    /**
+     * @brief 释放对象
+     * @param address allocate()或kmalloc()返回的地址
+     * @throws std::invalid_argument 如果地址不属于任何slab、不是对象起始地址或对象已空闲
+     */
+    void deallocate(long long address);
+
+    /**
+     * @brief 按大小分配对象，使用不小于size的2的幂大小类别
+     * @param size 大小（字节）
+     * @return 对象地址（字节），页面来源没有空间时返回-1
+     * @throws std::invalid_argument 如果size为0或超过slab大小
+     */
+    long long kmalloc(size_t size);
+
+    /**
+     * @brief 释放kmalloc分配的对象
+     * @param address 对象地址
+     */
+    void kfree(long long address) { deallocate(address); }
+
+    /**
+     * @brief 把所有缓存的空slab还给页面来源
+     * @return 释放的slab数
+     */
+    size_t shrink();
+
+    /**
+     * @brief 获取缓存数
+     * @return 缓存数
+     */
+    int getCacheCount() const { return static_cast<int>(caches_.size()); }
+
+    /**
+     * @brief 获取缓存统计
+     * @param cache 缓存ID
+     * @return 统计
+     * @throws std::invalid_argument 如果缓存ID无效
+     */
+    SlabCacheStats getCacheStats(int cache) const;
+
+    /**
+     * @brief 获取从页面来源占用的总字节数
+     * @return 字节数
+     */
+    size_t getSlabBytes() const { return slab_count_ * slab_bytes_; }
+
+    /**
+     * @brief 获取已分配对象的总字节数
+     * @return 字节数
+     */
+    size_t getActiveBytes() const { return active_bytes_; }
+
+    /**
+     * @brief 获取slab利用率
+     * @return 已分配对象字节数占slab总字节数的百分比
+     */
+    double getSlabUtilization() const;
+
+    /**
+     * @brief 显示各缓存的统计
+     */
+    void displayStatus() const;
+
+private:
+    /// slab描述符
+    struct Slab {
+        int cache;                 ///< 所属缓存
+        size_t base;               ///< 起始地址(KB)
+        int free_head;             ///< 第一个空闲对象下标，-1表示没有
+        size_t in_use;             ///< 已分配对象数
+        std::vector<int> next;     ///< 空闲链表：next[i]为空闲对象i之后的下一个空闲对象下标，已分配为-2
+        int prev_slab;             ///< 所在状态链表的前一个slab
+        int next_slab;             ///< 所在状态链表的后一个slab
+        int list;                  ///< 所在的状态链表
+    };
+
+    /// 对象缓存
+    struct Cache {
+        std::string name;          ///< 名称
+        size_t object_size;        ///< 对象大小
+        size_t objects_per_slab;   ///< 每个slab的对象数
+        int lists[3];              ///< 全满、部分使用、空三条链表的表头
+        size_t list_sizes[3];      ///< 三条链表的长度
+        size_t active_objects;     ///< 已分配对象数
+        SlabCacheStats counters;   ///< 计数器
+    };
+
+    MemoryManager& page_source_;                 ///< 页面来源
+    size_t slab_size_;                           ///< slab大小(KB)
+    size_t slab_bytes_;                          ///< slab大小（字节）
+    size_t max_empty_slabs_;                     ///< 每个缓存保留的空slab数
+    std::vector<Cache> caches_;                  ///< 缓存
+    std::vector<Slab> slabs_;                    ///< slab池
+    std::vector<int> free_slab_ids_;             ///< 可重用的slab ID
+    std::unordered_map<size_t, int> page_owner_; ///< 1KB页号 -> slab ID
+    std::vector<int> kmalloc_caches_;            ///< 第i个kmalloc大小类别的缓存ID，-1表示尚未建立
+    size_t slab_count_;                          ///< slab数
+    size_t active_bytes_;                        ///< 已分配对象的总字节数
+
+    /**
+     * @brief 检查缓存ID
+     * @param cache 缓存ID
+     * @throws std::invalid_argument 如果无效
+     */
+    void checkCache(int cache) const;
+
+    /**
+     * @brief 把slab挂到所属缓存某条状态链表的头部
+     * @param slab slab ID
+     * @param list 状态链表
+     */
+    void linkSlab(int slab, int list);
+
+    /**
+     * @brief 把slab从所在的状态链表摘下
+     * @param slab slab ID
+     */
+    void unlinkSlab(int slab);
+
+    /**
+     * @brief 向页面来源申请一个新slab，挂到空链表
+     * @param cache 缓存ID
+     * @return slab ID，页面来源没有空间时返回-1
+     */
+    int growCache(int cache);
+
+    /**
+     * @brief 把空slab还给页面来源
+     * @param slab slab ID
+     */
+    void destroySlab(int slab);
+};
+
+} // namespace ZTS_OS
+
+#endif // SLAB_ALLOCATOR_H
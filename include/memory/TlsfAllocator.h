@@ -0,0 +1,137 @@
+#ifndef TLSF_ALLOCATOR_H
+#define TLSF_ALLOCATOR_H
+
+#include "MemoryManager.h"
+#include <cstdint>
+
+/**
+ * @file TlsfAllocator.h
+ * @brief TLSF（两级分离适配）分配器定义
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class TlsfAllocator
+ * @brief 两级分离适配（Two-Level Segregated Fit）分配器
+ *
+ * 空闲块按大小分类：第一级按2的幂划分，第二级把每个2的幂区间再线性等分为16份，
+ * 小于16KB的块按1KB一类。每一类一条空闲链表，第一级一个位图、每个第一级类别一个第二级位图
+ * 记录哪些链表非空。分配时把请求向上取整到所在类别的上界，用两次“找最低置位”
+ * 直接定位到第一个必然放得下的非空链表，不遍历任何链表；释放时借助块链表的相邻块
+ * 立即合并。分配和释放的时间都与堆中块的数量无关。
+ *
+ * 代价是分配不一定选到最合适的块：请求向上取整后，恰好放得下、但落在同一类别里的块不会被选中。
+ */
+class TlsfAllocator : public MemoryManager {
+public:
+    /// 第二级划分数的对数
+    static constexpr int kSecondLevelLog2 = 4;
+    /// 第二级划分数
+    static constexpr int kSecondLevelCount = 1 << kSecondLevelLog2;
+    /// 第一级类别数（位图宽度）
+    static constexpr int kFirstLevelCount = 32;
+
+    /**
+     * @brief 构造函数
+     * @param total_size 总内存大小(KB)
+     * @throws std::invalid_argument 如果总大小为0或超出第一级类别能表示的范围
+     */
+    explicit TlsfAllocator(size_t total_size);
+
+    /**
+     * @brief 析构函数
+     */
+    ~TlsfAllocator() override = default;
+
+    /**
+     * @brief 分配内存
+     * @param size 请求大小
+     * @param process_id 进程ID
+     * @param name 块名称
+     * @return 分配的起始地址，失败返回-1
+     */
+    int allocateMemory(size_t size, int process_id, const std::string& name = "") override;
+
+    /**
+     * @brief 释放进程的全部内存
+     * @param process_id 进程ID
+     * @return 是否成功释放
+     */
+    bool deallocateMemory(int process_id) override;
+
+    /**
+     * @brief 显示内存状态
+     */
+    void displayMemoryStatus() const override;
+
+    /**
+     * @brief 内存压缩（碎片整理），完成后重建空闲链表
+     */
+    void compactMemory() override;
+
+    /**
+     * @brief 获取最大空闲块大小（只遍历最高的非空类别）
+     * @return 最大空闲块大小
+     */
+    size_t getLargestFreeBlock() const override;
+
+    /**
+     * @brief 获取空闲块数量
+     * @return 空闲块数量
+     */
+    int getFreeBlockCount() const { return static_cast<int>(free_block_count_); }
+
+    /**
+     * @brief 计算块大小所属的类别
+     * @param size 块大小
+     * @param first 第一级下标
+     * @param second 第二级下标
+     */
+    static void mapping(size_t size, int& first, int& second);
+
+protected:
+    /**
+     * @brief 查找必然放得下size的空闲块
+     * @param size 需要的大小
+     * @return 块句柄，未找到返回-1
+     */
+    int findFreeBlock(size_t size) override;
+
+private:
+    uint32_t first_bitmap_;                                     ///< 第一级位图
+    uint32_t second_bitmaps_[kFirstLevelCount];                 ///< 第二级位图
+    int heads_[kFirstLevelCount][kSecondLevelCount];            ///< 各类别空闲链表的表头
+    std::vector<int> free_prev_;                                ///< 按块句柄索引的空闲链表前驱
+    std::vector<int> free_next_;                                ///< 按块句柄索引的空闲链表后继
+    size_t free_block_count_;                                   ///< 空闲块数
+
+    /**
+     * @brief 把空闲块加入所属类别的链表头部
+     * @param block 句柄
+     */
+    void insertFree(int block);
+
+    /**
+     * @brief 把空闲块从所属类别的链表中摘下
+     * @param block 句柄
+     */
+    void removeFree(int block);
+
+    /**
+     * @brief 释放一个已分配块并与相邻空闲块合并
+     * @param block 句柄
+     */
+    void releaseBlock(int block);
+
+    /**
+     * @brief 按块链表重建空闲链表和位图
+     */
+    void rebuildFreeLists();
+};
+
+} // namespace ZTS_OS
+
+#endif // TLSF_ALLOCATOR_H
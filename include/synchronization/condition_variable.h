@@ -0,0 +1,71 @@
+#ifndef ZTS_CONDITION_VARIABLE_H
+#define ZTS_CONDITION_VARIABLE_H
+
+#include "sync_primitive.h"
+#include <vector>
+
+/**
+ * @file condition_variable.h
+ * @brief 模拟条件变量
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class ConditionVariable
+ * @brief Mesa语义的条件变量
+ *
+ * 被唤醒的进程还需要重新获得与之配合的互斥锁才能继续运行；
+ * 没有等待者时的signal不会被记住（计入lost_signals）。
+ */
+class ConditionVariable : public SyncPrimitive {
+public:
+    /**
+     * @brief 构造函数
+     * @param id 原语编号
+     * @param name 名称
+     */
+    ConditionVariable(int id, const std::string& name);
+
+    /**
+     * @brief 获取原语类型名称
+     * @return "条件变量"
+     */
+    std::string getKind() const override { return "条件变量"; }
+
+    /**
+     * @brief 进程开始等待条件
+     * @param pid 进程ID
+     * @param now 当前时刻
+     */
+    void wait(int pid, int now);
+
+    /**
+     * @brief 唤醒一个等待者
+     * @param now 当前时刻
+     * @return 被唤醒的进程ID，没有等待者时返回-1
+     */
+    int signal(int now);
+
+    /**
+     * @brief 唤醒全部等待者
+     * @param now 当前时刻
+     * @return 按等待顺序排列的被唤醒进程ID
+     */
+    std::vector<int> broadcast(int now);
+
+    /**
+     * @brief 没有等待者时丢失的signal次数
+     * @return 次数
+     */
+    long long getLostSignals() const { return lost_signals_; }
+
+private:
+    long long lost_signals_;  ///< 丢失的signal次数
+};
+
+} // namespace ZTS_OS
+
+#endif // ZTS_CONDITION_VARIABLE_H
@@ -0,0 +1,94 @@
+#ifndef FUTEX_TABLE_H
+#define FUTEX_TABLE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <utility>
+#include <vector>
+
+/**
+ * @file futex_table.h
+ * @brief 按地址散列的等待队列（仿照Linux futex）
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @struct FutexTableStats
+ * @brief 散列等待队列的统计
+ */
+struct FutexTableStats {
+    long long waits;            ///< 进入等待的次数
+    long long wake_calls;       ///< 唤醒调用次数
+    long long woken;            ///< 被唤醒的等待者总数
+    long long scanned;          ///< 唤醒时扫描的队列项总数
+    long long collisions;       ///< 扫描到其他地址的等待者的次数（散列冲突）
+    size_t max_bucket_length;   ///< 单个桶的最长队列
+
+    FutexTableStats()
+        : waits(0), wake_calls(0), woken(0), scanned(0), collisions(0), max_bucket_length(0) {}
+};
+
+/**
+ * @class FutexTable
+ * @brief 固定桶数的散列等待队列
+ *
+ * 内核不为每把用户态锁分配等待队列，而是把锁的地址散列到全局的桶里，
+ * 同一个桶中不同地址的等待者共用一条FIFO队列。唤醒时沿队列扫描，
+ * 只唤醒地址相同的等待者，桶太少时扫描长度随冲突增加。
+ */
+class FutexTable {
+public:
+    /**
+     * @brief 构造函数
+     * @param buckets 桶数，向上取整为2的幂
+     * @throws std::invalid_argument 如果桶数为0
+     */
+    explicit FutexTable(size_t buckets = 256);
+
+    /**
+     * @brief 在地址上等待（加入对应桶的队尾）
+     * @param address 等待的地址
+     * @param tid 线程ID
+     */
+    void wait(std::uintptr_t address, int tid);
+
+    /**
+     * @brief 唤醒地址上最多count个等待者
+     * @param address 地址
+     * @param count 最多唤醒的个数
+     * @return 被唤醒的线程ID，按等待的先后顺序
+     */
+    std::vector<int> wake(std::uintptr_t address, int count);
+
+    /**
+     * @brief 获取桶数
+     * @return 桶数
+     */
+    size_t getBucketCount() const { return buckets_.size(); }
+
+    /**
+     * @brief 计算地址所在的桶
+     * @param address 地址
+     * @return 桶下标
+     */
+    size_t bucketOf(std::uintptr_t address) const;
+
+    /**
+     * @brief 获取统计信息
+     * @return 统计信息
+     */
+    const FutexTableStats& getStats() const { return stats_; }
+
+private:
+    std::vector<std::deque<std::pair<std::uintptr_t, int>>> buckets_;  ///< 每个桶的(地址, 线程ID)队列
+    int shift_;                                                       ///< 斐波那契散列的右移位数
+    FutexTableStats stats_;                                           ///< 统计信息
+};
+
+} // namespace ZTS_OS
+
+#endif // FUTEX_TABLE_H
@@ -0,0 +1,76 @@
+#ifndef ZTS_MUTEX_H
+#define ZTS_MUTEX_H
+
+#include "sync_primitive.h"
+
+/**
+ * @file mutex.h
+ * @brief 模拟互斥锁
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class Mutex
+ * @brief 非递归互斥锁，释放时直接交给等待最久的进程
+ *
+ * 直接交接（而不是让所有等待者重新竞争）保证了FIFO公平，
+ * 但锁在高竞争下会一直在等待者之间传递，形成护航(convoy)：
+ * longest_convoy记录锁连续多少次交接都没有空闲过。
+ */
+class Mutex : public SyncPrimitive {
+public:
+    /**
+     * @brief 构造函数
+     * @param id 原语编号
+     * @param name 名称
+     */
+    Mutex(int id, const std::string& name);
+
+    /**
+     * @brief 获取原语类型名称
+     * @return "互斥锁"
+     */
+    std::string getKind() const override { return "互斥锁"; }
+
+    /**
+     * @brief 尝试加锁
+     * @param pid 进程ID
+     * @param now 当前时刻
+     * @return true表示获得锁，false表示锁被占用
+     */
+    bool tryLock(int pid, int now);
+
+    /**
+     * @brief 加锁失败后进入等待队列
+     * @param pid 进程ID
+     * @param now 当前时刻
+     */
+    void block(int pid, int now);
+
+    /**
+     * @brief 解锁，有等待者时直接交给队首进程
+     * @param pid 进程ID
+     * @param now 当前时刻
+     * @return 获得锁的等待者进程ID，没有等待者时返回-1
+     * @throws std::runtime_error 如果pid不是锁的持有者
+     */
+    int unlock(int pid, int now);
+
+    /**
+     * @brief 获取持有者
+     * @return 持有者进程ID，-1表示空闲
+     */
+    int getOwner() const { return owner_; }
+
+private:
+    int owner_;        ///< 持有者进程ID
+    int acquired_at_;  ///< 本次获得锁的时刻
+    int convoy_;       ///< 当前连续交接次数
+};
+
+} // namespace ZTS_OS
+
+#endif // ZTS_MUTEX_H
@@ -0,0 +1,297 @@
+#ifndef RESOURCE_MANAGER_H
+#define RESOURCE_MANAGER_H
+
+#include <deque>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+/**
+ * @file resource_manager.h
+ * @brief 多类资源管理：银行家算法避免死锁与资源分配图死锁检测
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @enum AllocationPolicy
+ * @brief 资源分配策略
+ */
+enum class AllocationPolicy {
+    DETECTION,  ///< 资源足够就分配，通过资源分配图检测死锁
+    BANKER      ///< 银行家算法：分配后状态不安全的请求也要等待
+};
+
+/**
+ * @enum RequestResult
+ * @brief 资源请求的结果
+ */
+enum class RequestResult {
+    GRANTED,              ///< 立即分配
+    BLOCKED_UNAVAILABLE,  ///< 可用资源不足，进入等待
+    BLOCKED_UNSAFE        ///< 资源足够但分配后不安全，进入等待（仅银行家算法）
+};
+
+/**
+ * @struct ResourceManagerStats
+ * @brief 资源管理器的运行统计
+ */
+struct ResourceManagerStats {
+    long long requests;             ///< 请求次数
+    long long granted;              ///< 分配次数（含等待后分配）
+    long long blocked_unavailable;  ///< 因资源不足而等待的次数
+    long long blocked_unsafe;       ///< 因不安全而等待的次数
+    long long safety_checks;        ///< 安全性检查次数
+    long long safety_visits;        ///< 安全性检查中考察的进程数合计
+    long long edge_insertions;      ///< 资源分配图插入边的次数
+    long long order_searches;       ///< 插入边时需要搜索调整拓扑序的次数
+    long long search_visits;        ///< 搜索中访问的结点数合计
+    long long detections;           ///< 实际执行归约检测的次数
+
+    ResourceManagerStats()
+        : requests(0), granted(0), blocked_unavailable(0), blocked_unsafe(0),
+          safety_checks(0), safety_visits(0), edge_insertions(0), order_searches(0),
+          search_visits(0), detections(0) {}
+};
+
+/**
+ * @class ResourceManager
+ * @brief 管理多类可重复使用资源的分配、等待与死锁
+ *
+ * 银行家算法的安全性检查是增量的：当前状态总是安全的，因此只需判断申请进程能否在
+ * 归约中完成（能完成则其余进程也一定能完成），并且每类资源按需求量排序索引，
+ * 归约时只访问需求已被满足的进程，找到申请进程即停止。
+ *
+ * 死锁检测策略下维护资源分配图：等待进程指向所请求的资源类型，资源类型指向持有它的进程。
+ * 与“等待进程指向持有者”的等待图相比，边数只与请求和持有的项数成正比，
+ * 而成环条件相同。用Pearce-Kelly算法增量维护拓扑序：插入边时只在受影响的序号区间内搜索。
+ * 形成环的边暂存起来，删除边后再重试，因此“暂存边非空”当且仅当存在环。
+ * 多实例资源下环只是死锁的必要条件，有环时再用同样的排序索引做归约检测以确认死锁进程。
+ * 银行家算法保证不会死锁，不维护资源分配图。
+ */
+class ResourceManager {
+public:
+    /**
+     * @brief 构造函数
+     * @param policy 分配策略
+     */
+    explicit ResourceManager(AllocationPolicy policy = AllocationPolicy::BANKER);
+
+    /**
+     * @brief 添加资源类型（必须在添加进程之前）
+     * @param name 名称
+     * @param instances 实例总数
+     * @return 资源类型编号
+     * @throws std::invalid_argument 如果实例数为负数
+     * @throws std::logic_error 如果已经添加了进程
+     */
+    int addResourceType(const std::string& name, int instances);
+
+    /**
+     * @brief 添加进程并声明各类资源的最大需求
+     * @param pid 进程ID
+     * @param max_claim 各类资源的最大需求
+     * @throws std::invalid_argument 如果进程已存在、长度不符、需求为负或超过资源总数
+     */
+    void addProcess(int pid, const std::vector<int>& max_claim);
+
+    /**
+     * @brief 移除进程并释放其持有的全部资源，放弃尚未满足的请求
+     * @param pid 进程ID
+     * @return 因此获得资源的等待进程
+     * @throws std::invalid_argument 如果进程不存在
+     */
+    std::vector<int> removeProcess(int pid);
+
+    /**
+     * @brief 申请资源
+     * @param pid 进程ID
+     * @param amounts 各类资源的申请量
+     * @return 请求结果；等待中的请求在其他进程释放资源后按先来先服务重试
+     * @throws std::invalid_argument 如果进程不存在、长度不符、申请量为负或超过剩余需求
+     * @throws std::logic_error 如果进程已在等待
+     */
+    RequestResult request(int pid, const std::vector<int>& amounts);
+
+    /**
+     * @brief 释放资源
+     * @param pid 进程ID
+     * @param amounts 各类资源的释放量
+     * @return 因此获得资源的等待进程
+     * @throws std::invalid_argument 如果进程不存在、长度不符或释放量超过持有量
+     */
+    std::vector<int> release(int pid, const std::vector<int>& amounts);
+
+    /**
+     * @brief 资源分配图中是否存在环（O(1)，银行家算法下总为false）
+     * @return true表示存在环
+     */
+    bool hasWaitCycle() const { return !deferred_.empty(); }
+
+    /**
+     * @brief 检测死锁
+     * @return 死锁进程ID（升序），没有环时直接返回空
+     */
+    std::vector<int> detectDeadlock();
+
+    /**
+     * @brief 用教科书式的完整扫描判断当前状态是否安全，O(n²·m)，用于校验和对比
+     * @return true表示安全
+     */
+    bool isSafeFullScan() const;
+
+    /**
+     * @brief 获取可用资源
+     * @return 各类资源的可用量
+     */
+    const std::vector<int>& getAvailable() const { return available_; }
+
+    /**
+     * @brief 获取进程已分配的资源
+     * @param pid 进程ID
+     * @return 各类资源的分配量
+     */
+    const std::vector<int>& getAllocation(int pid) const;
+
+    /**
+     * @brief 获取进程的剩余需求
+     * @param pid 进程ID
+     * @return 各类资源的剩余需求
+     */
+    const std::vector<int>& getNeed(int pid) const;
+
+    /**
+     * @brief 进程是否在等待
+     * @param pid 进程ID
+     * @return true表示有尚未满足的请求
+     */
+    bool isWaiting(int pid) const;
+
+    /**
+     * @brief 获取资源类型名称
+     * @param type 资源类型编号
+     * @return 名称
+     */
+    const std::string& getResourceName(int type) const { return names_.at(type); }
+
+    /**
+     * @brief 获取资源类型数
+     * @return 类型数
+     */
+    size_t getResourceCount() const { return totals_.size(); }
+
+    /**
+     * @brief 获取进程数
+     * @return 进程数
+     */
+    size_t getProcessCount() const { return processes_.size(); }
+
+    /**
+     * @brief 获取资源分配图中的边数
+     * @return 边数
+     */
+    size_t getGraphEdgeCount() const { return edges_.size(); }
+
+    /**
+     * @brief 获取分配策略
+     * @return 分配策略
+     */
+    AllocationPolicy getPolicy() const { return policy_; }
+
+    /**
+     * @brief 获取运行统计
+     * @return 统计信息
+     */
+    const ResourceManagerStats& getStats() const { return stats_; }
+
+    /**
+     * @brief 获取分配策略名称
+     * @param policy 分配策略
+     * @return 策略名称
+     */
+    static std::string getPolicyName(AllocationPolicy policy);
+
+private:
+    /// 进程的资源状态
+    struct ProcessEntry {
+        std::vector<int> allocation;  ///< 已分配
+        std::vector<int> need;        ///< 剩余需求（最大需求 - 已分配）
+        std::vector<int> pending;     ///< 等待中的请求，全0表示不在等待
+        bool waiting;                 ///< 是否在等待
+        int slot;                     ///< 连续编号，归约时用作计数数组下标
+    };
+
+    /**
+     * @brief 按某个向量为正的分量建立的排序索引：每类资源一个(数量, 进程编号)有序集合
+     *
+     * 归约时每类资源按数量从小到大扫描到可用量为止，进程的所有正分量都被满足即可完成。
+     * 归约的主要开销是顺序扫描这些前缀，因此用有序数组而不是平衡树存放，
+     * 进程用连续编号而不是进程ID索引，归约中的计数用数组而不是哈希表。
+     */
+    struct ReductionIndex {
+        std::vector<std::vector<std::pair<int, int>>> by_type;  ///< 每类资源按升序排列的(数量, 进程编号)
+        std::vector<int> positive_types;                     ///< 每个进程为正的分量个数
+        std::unordered_set<int> zero;                        ///< 没有正分量的进程，归约时可以直接完成
+
+        void insert(int slot, const std::vector<int>& amounts);
+        void erase(int slot, const std::vector<int>& amounts);
+    };
+
+    AllocationPolicy policy_;                              ///< 分配策略
+    std::vector<std::string> names_;                      ///< 资源名称
+    std::vector<int> totals_;                              ///< 资源总数
+    std::vector<int> available_;                           ///< 可用资源
+    std::unordered_map<int, ProcessEntry> processes_;      ///< 进程状态
+    std::vector<int> slot_pids_;                           ///< 连续编号对应的进程ID，-1表示空闲
+    std::vector<int> free_slots_;                          ///< 空闲的连续编号
+    std::deque<int> wait_queue_;                           ///< 等待进程，先来先服务
+    std::vector<int> waiting_held_;                        ///< 等待进程持有的资源合计
+    ReductionIndex need_index_;                            ///< 剩余需求索引（银行家算法）
+    ReductionIndex request_index_;                         ///< 等待请求索引（死锁检测）
+    std::set<std::pair<long long, long long>> edges_;      ///< 资源分配图的边
+    std::unordered_map<long long, std::unordered_set<long long>> successors_;    ///< 已排序子图的后继
+    std::unordered_map<long long, std::unordered_set<long long>> predecessors_;  ///< 已排序子图的前驱
+    std::set<std::pair<long long, long long>> deferred_;   ///< 会形成环、暂不排序的边
+    std::unordered_map<long long, int> order_;             ///< 拓扑序号
+    int next_order_;                                       ///< 新结点的拓扑序号
+    ResourceManagerStats stats_;                           ///< 运行统计
+
+    ProcessEntry& entry(int pid);
+    const ProcessEntry& entry(int pid) const;
+    void checkLength(const std::vector<int>& amounts) const;
+
+    /**
+     * @brief 在假设状态下判断target能否在归约中完成
+     * @param work 初始可用资源
+     * @param index 使用的需求索引
+     * @param target 目标进程的连续编号，-1表示归约全部进程
+     * @param finished 输出：按连续编号标记归约中完成的进程
+     * @return target能否完成（target为-1时总是返回true）
+     */
+    bool reduce(std::vector<int> work, const ReductionIndex& index, int target,
+                std::vector<char>& finished);
+
+    bool canGrantSafely(int pid, const std::vector<int>& amounts);
+    void grant(int pid, const std::vector<int>& amounts);
+    void startWaiting(int pid, const std::vector<int>& amounts);
+    void stopWaiting(int pid);
+    void changeAllocation(int pid, int type, int delta);
+    std::vector<int> retryWaiting();
+
+    /// 资源分配图结点：进程为偶数，资源类型为奇数
+    static long long processNode(int pid) { return 2LL * pid; }
+    static long long resourceNode(int type) { return 2LL * type + 1; }
+
+    void addEdge(long long from, long long to);
+    void removeEdge(long long from, long long to);
+    void insertOrderedEdge(long long from, long long to);
+};
+
+} // namespace ZTS_OS
+
+#endif // RESOURCE_MANAGER_H
@@ -0,0 +1,70 @@
+#ifndef ZTS_SEMAPHORE_H
+#define ZTS_SEMAPHORE_H
+
+#include "sync_primitive.h"
+
+/**
+ * @file semaphore.h
+ * @brief 模拟计数信号量
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class Semaphore
+ * @brief 计数信号量（P/V操作），V操作有等待者时直接唤醒队首进程
+ */
+class Semaphore : public SyncPrimitive {
+public:
+    /**
+     * @brief 构造函数
+     * @param id 原语编号
+     * @param name 名称
+     * @param initial_count 初始计数
+     * @throws std::invalid_argument 如果初始计数为负数
+     */
+    Semaphore(int id, const std::string& name, int initial_count);
+
+    /**
+     * @brief 获取原语类型名称
+     * @return "信号量"
+     */
+    std::string getKind() const override { return "信号量"; }
+
+    /**
+     * @brief 尝试P操作
+     * @param pid 进程ID
+     * @param now 当前时刻
+     * @return true表示计数大于0并已减1，false表示需要等待
+     */
+    bool tryWait(int pid, int now);
+
+    /**
+     * @brief P操作失败后进入等待队列
+     * @param pid 进程ID
+     * @param now 当前时刻
+     */
+    void block(int pid, int now);
+
+    /**
+     * @brief V操作
+     * @param now 当前时刻
+     * @return 被唤醒的进程ID，没有等待者时计数加1并返回-1
+     */
+    int signal(int now);
+
+    /**
+     * @brief 获取当前计数
+     * @return 计数
+     */
+    int getCount() const { return count_; }
+
+private:
+    int count_;  ///< 当前计数
+};
+
+} // namespace ZTS_OS
+
+#endif // ZTS_SEMAPHORE_H
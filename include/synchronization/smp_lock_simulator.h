@@ -0,0 +1,184 @@
+#ifndef SMP_LOCK_SIMULATOR_H
+#define SMP_LOCK_SIMULATOR_H
+
+#include "futex_table.h"
+#include <string>
+#include <vector>
+
+/**
+ * @file smp_lock_simulator.h
+ * @brief 多核上自旋-休眠锁的竞争模拟
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @struct LockWorkload
+ * @brief 锁竞争负载：每个线程循环执行“临界区外工作 → 加锁 → 临界区 → 解锁”
+ *
+ * 线程i使用第 i % locks 把锁，锁越少、临界区占比越高，竞争越激烈。
+ */
+struct LockWorkload {
+    int threads;            ///< 线程数
+    int iterations;         ///< 每个线程进入临界区的次数
+    int critical_time;      ///< 临界区长度
+    int non_critical_time;  ///< 两次加锁之间的临界区外工作
+    int locks;              ///< 锁的数量
+
+    LockWorkload(int thread_count = 4, int iteration_count = 50, int critical = 2,
+                 int non_critical = 8, int lock_count = 1)
+        : threads(thread_count), iterations(iteration_count), critical_time(critical),
+          non_critical_time(non_critical), locks(lock_count) {}
+};
+
+/**
+ * @struct SpinParkCosts
+ * @brief 自旋-休眠锁各环节的时间开销（时间单位）
+ */
+struct SpinParkCosts {
+    int park_cost;        ///< 等待者进入休眠（futex_wait系统调用）占用自己CPU的时间
+    int wake_cost;        ///< 释放者唤醒等待者（futex_wake系统调用）占用自己CPU的时间
+    int wakeup_latency;   ///< 被唤醒的线程重新进入就绪队列之前的延迟
+    int context_switch;   ///< 核心换上另一个线程的开销
+    int time_quantum;     ///< 时间片，有其他线程就绪时到期的线程被抢占（持锁者也一样）
+
+    SpinParkCosts()
+        : park_cost(2), wake_cost(2), wakeup_latency(4), context_switch(1), time_quantum(20) {}
+};
+
+/**
+ * @struct SmpLockResult
+ * @brief 锁竞争模拟结果
+ */
+struct SmpLockResult {
+    int cores;                        ///< 核心数
+    int threads;                      ///< 线程数
+    int spin_budget;                  ///< 自旋预算（-1表示只自旋不休眠）
+    int makespan;                     ///< 全部线程完成的时间
+    long long critical_sections;      ///< 完成的临界区数
+    double throughput;                ///< 吞吐率：每1000时间单位完成的临界区数
+    long long useful_time;            ///< 执行临界区内外工作的CPU时间
+    long long spin_time;              ///< 自旋消耗的CPU时间
+    long long park_time;              ///< 进入休眠的系统调用消耗的CPU时间
+    long long wake_time;              ///< 唤醒的系统调用消耗的CPU时间
+    long long switch_time;            ///< 上下文切换消耗的CPU时间
+    long long idle_time;              ///< 核心空闲时间
+    double spin_share;                ///< 自旋时间占全部核心时间的百分比
+    long long uncontended;            ///< 第一次尝试就拿到锁的次数
+    long long acquired_spinning;      ///< 自旋期间拿到锁的次数
+    long long parks;                  ///< 进入休眠的次数
+    long long wakeups;                ///< 被唤醒的次数
+    long long futile_wakeups;         ///< 被唤醒后锁又被别人抢走的次数
+    long long holder_preemptions;     ///< 持锁者在临界区内被抢占的次数
+    long long context_switches;       ///< 上下文切换次数
+    double average_wakeup_latency;    ///< 平均唤醒延迟：从futex_wake到被唤醒的线程重新在核心上运行
+    int p95_wakeup_latency;           ///< 唤醒延迟的95百分位（最近秩）
+    int max_wakeup_latency;           ///< 最长唤醒延迟
+    FutexTableStats futex;            ///< 散列等待队列统计
+
+    SmpLockResult()
+        : cores(0), threads(0), spin_budget(0), makespan(0), critical_sections(0), throughput(0),
+          useful_time(0), spin_time(0), park_time(0), wake_time(0), switch_time(0), idle_time(0),
+          spin_share(0), uncontended(0), acquired_spinning(0), parks(0), wakeups(0), futile_wakeups(0),
+          holder_preemptions(0), context_switches(0), average_wakeup_latency(0), p95_wakeup_latency(0),
+          max_wakeup_latency(0) {}
+};
+
+/**
+ * @class SmpLockSimulator
+ * @brief 同构多核上按时间单位推进的自旋-休眠锁模拟器
+ *
+ * 加锁失败的线程先在自己的核心上自旋至多spin_budget个时间单位，期间锁一空闲就拿到；
+ * 预算用完后付出park_cost进入休眠，并按锁的地址加入散列等待队列。
+ * 进入休眠前会再检查一次锁，已经空闲就不休眠（futex_wait的值检查）。
+ * 释放锁时如有休眠的等待者，释放者付出wake_cost唤醒一个，被唤醒的线程经过wakeup_latency
+ * 进入全局FIFO就绪队列，拿到核心后重新竞争，可能被正在自旋或刚到达的线程抢先。
+ *
+ * 线程多于核心时，时间片到期的持锁者会被抢占，其余线程只能空转到它重新运行，
+ * 这是纯自旋锁在超额订阅下吞吐率崩溃的原因；纯休眠锁则在每次交接上付出系统调用和唤醒延迟。
+ */
+class SmpLockSimulator {
+public:
+    /// 只自旋、从不休眠
+    static constexpr int kSpinForever = -1;
+
+    /**
+     * @brief 构造函数
+     * @param cores 核心数
+     * @param spin_budget 自旋预算，0表示直接休眠，kSpinForever表示只自旋
+     * @throws std::invalid_argument 如果核心数不是正数或自旋预算小于-1
+     */
+    explicit SmpLockSimulator(int cores = 4, int spin_budget = 10);
+
+    /**
+     * @brief 设置自旋预算
+     * @param spin_budget 自旋预算，0表示直接休眠，kSpinForever表示只自旋
+     * @throws std::invalid_argument 如果小于-1
+     */
+    void setSpinBudget(int spin_budget);
+
+    /**
+     * @brief 获取自旋预算
+     * @return 自旋预算
+     */
+    int getSpinBudget() const { return spin_budget_; }
+
+    /**
+     * @brief 设置各环节开销
+     * @param costs 开销
+     * @throws std::invalid_argument 如果有负数或时间片不是正数
+     */
+    void setCosts(const SpinParkCosts& costs);
+
+    /**
+     * @brief 获取各环节开销
+     * @return 开销
+     */
+    const SpinParkCosts& getCosts() const { return costs_; }
+
+    /**
+     * @brief 设置散列等待队列的桶数
+     * @param buckets 桶数
+     * @throws std::invalid_argument 如果为0
+     */
+    void setFutexBuckets(size_t buckets);
+
+    /**
+     * @brief 获取核心数
+     * @return 核心数
+     */
+    int getCoreCount() const { return cores_; }
+
+    /**
+     * @brief 运行模拟
+     * @param workload 负载
+     * @return 模拟结果
+     * @throws std::invalid_argument 如果负载参数无效
+     */
+    SmpLockResult run(const LockWorkload& workload) const;
+
+    /**
+     * @brief 打印模拟结果
+     * @param result run()的返回值
+     */
+    static void displayResult(const SmpLockResult& result);
+
+    /**
+     * @brief 获取自旋策略名称
+     * @param spin_budget 自旋预算
+     * @return 名称
+     */
+    static std::string getStrategyName(int spin_budget);
+
+private:
+    int cores_;            ///< 核心数
+    int spin_budget_;      ///< 自旋预算
+    SpinParkCosts costs_;  ///< 各环节开销
+    size_t buckets_;       ///< 散列等待队列的桶数
+};
+
+} // namespace ZTS_OS
+
+#endif // SMP_LOCK_SIMULATOR_H
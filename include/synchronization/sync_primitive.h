@@ -0,0 +1,147 @@
+#ifndef SYNC_PRIMITIVE_H
+#define SYNC_PRIMITIVE_H
+
+#include <deque>
+#include <string>
+
+/**
+ * @file sync_primitive.h
+ * @brief 模拟同步原语的公共基类与统计信息
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @struct Waiter
+ * @brief 等待队列中的一个进程
+ */
+struct Waiter {
+    int pid;    ///< 进程ID
+    int since;  ///< 开始等待的时刻
+};
+
+/**
+ * @struct PrimitiveStats
+ * @brief 同步原语的竞争统计
+ */
+struct PrimitiveStats {
+    long long acquisitions;     ///< 获得次数（加锁成功、P操作成功或被条件变量唤醒）
+    long long contended;        ///< 其中需要先等待的次数
+    long long total_wait_time;  ///< 等待时间之和
+    int max_wait_time;          ///< 最长一次等待
+    long long total_hold_time;  ///< 持有时间之和（仅互斥锁）
+    int max_hold_time;          ///< 最长一次持有（仅互斥锁）
+    size_t max_queue_length;    ///< 等待队列的最大长度
+    long long convoy_handoffs;  ///< 释放时直接交给等待者、且之后仍有人在等的次数
+    int longest_convoy;         ///< 最长的连续交接次数（期间锁一直没有空闲）
+    long long contended_time;   ///< 等待队列非空的总时长
+
+    PrimitiveStats()
+        : acquisitions(0), contended(0), total_wait_time(0), max_wait_time(0),
+          total_hold_time(0), max_hold_time(0), max_queue_length(0),
+          convoy_handoffs(0), longest_convoy(0), contended_time(0) {}
+
+    /// 平均等待时间（按需要等待的次数平均）
+    double averageWaitTime() const {
+        return contended > 0 ? static_cast<double>(total_wait_time) / contended : 0.0;
+    }
+
+    /// 平均持有时间
+    double averageHoldTime() const {
+        return acquisitions > 0 ? static_cast<double>(total_hold_time) / acquisitions : 0.0;
+    }
+};
+
+/**
+ * @class SyncPrimitive
+ * @brief 同步原语基类：名称、FIFO等待队列与统计
+ *
+ * 原语只记录谁在等待、谁获得了资源，不直接改变进程状态；
+ * 阻塞和唤醒由SyncScheduler根据返回值完成。
+ */
+class SyncPrimitive {
+public:
+    /**
+     * @brief 构造函数
+     * @param id 原语编号
+     * @param name 名称
+     */
+    SyncPrimitive(int id, const std::string& name);
+
+    /**
+     * @brief 虚析构函数
+     */
+    virtual ~SyncPrimitive() = default;
+
+    /**
+     * @brief 获取原语编号
+     * @return 编号
+     */
+    int getId() const { return id_; }
+
+    /**
+     * @brief 获取名称
+     * @return 名称
+     */
+    const std::string& getName() const { return name_; }
+
+    /**
+     * @brief 获取原语类型名称
+     * @return 类型名称
+     */
+    virtual std::string getKind() const = 0;
+
+    /**
+     * @brief 获取等待队列
+     * @return 按等待顺序排列的等待者
+     */
+    const std::deque<Waiter>& getWaiters() const { return waiters_; }
+
+    /**
+     * @brief 获取统计信息
+     * @return 统计信息
+     */
+    const PrimitiveStats& getStats() const { return stats_; }
+
+    /**
+     * @brief 把等待者移到队首，使它成为下一个获得资源的进程（按优先级唤醒时使用）
+     * @param pid 进程ID
+     * @throws std::logic_error 如果该进程不在等待队列中
+     */
+    void promoteWaiter(int pid);
+
+    /**
+     * @brief 模拟结束时结算仍未结束的竞争区间
+     * @param now 结束时刻
+     */
+    void finish(int now);
+
+protected:
+    PrimitiveStats stats_;  ///< 统计信息
+
+    /**
+     * @brief 进程进入等待队列
+     * @param pid 进程ID
+     * @param now 当前时刻
+     */
+    void enqueue(int pid, int now);
+
+    /**
+     * @brief 队首进程离开等待队列并获得资源，记录等待时间
+     * @param now 当前时刻
+     * @return 离开队列的等待者
+     */
+    Waiter dequeue(int now);
+
+private:
+    int id_;                      ///< 编号
+    std::string name_;            ///< 名称
+    std::deque<Waiter> waiters_;  ///< 等待队列
+    int contended_since_;         ///< 等待队列变为非空的时刻
+};
+
+} // namespace ZTS_OS
+
+#endif // SYNC_PRIMITIVE_H
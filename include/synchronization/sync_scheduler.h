@@ -0,0 +1,283 @@
+#ifndef SYNC_SCHEDULER_H
+#define SYNC_SCHEDULER_H
+
+#include "../algorithms/Scheduler.h"
+#include "sync_primitive.h"
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @file sync_scheduler.h
+ * @brief 带同步原语的单CPU调度模拟
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @enum SyncActionType
+ * @brief 进程脚本中的同步操作
+ */
+enum class SyncActionType {
+    LOCK,          ///< 对互斥锁加锁
+    UNLOCK,        ///< 释放互斥锁
+    SEM_WAIT,      ///< 信号量P操作
+    SEM_SIGNAL,    ///< 信号量V操作
+    CV_WAIT,       ///< 释放互斥锁并等待条件变量，被唤醒后重新加锁
+    CV_SIGNAL,     ///< 唤醒一个条件变量等待者
+    CV_BROADCAST   ///< 唤醒全部条件变量等待者
+};
+
+/**
+ * @enum LockProtocol
+ * @brief 互斥锁的优先级协议
+ */
+enum class LockProtocol {
+    NONE,                  ///< 不调整优先级
+    PRIORITY_INHERITANCE,  ///< 优先级继承：持锁者继承等待者中的最高优先级（可传递）
+    PRIORITY_CEILING       ///< 优先级天花板：持锁者立即提升到锁的天花板优先级
+};
+
+/**
+ * @struct SyncAction
+ * @brief 进程在执行到某一时刻时进行的同步操作
+ */
+struct SyncAction {
+    int at;               ///< 在进程已执行的CPU时间达到at时进行（0 ≤ at ≤ 执行时间）
+    SyncActionType type;  ///< 操作类型
+    int object;           ///< 操作的原语编号
+    int mutex;            ///< CV_WAIT配合使用的互斥锁编号，其余操作忽略
+
+    SyncAction(int time, SyncActionType action, int object_id, int mutex_id = -1)
+        : at(time), type(action), object(object_id), mutex(mutex_id) {}
+
+    static SyncAction lock(int at, int mutex_id) { return SyncAction(at, SyncActionType::LOCK, mutex_id); }
+    static SyncAction unlock(int at, int mutex_id) { return SyncAction(at, SyncActionType::UNLOCK, mutex_id); }
+    static SyncAction wait(int at, int semaphore_id) { return SyncAction(at, SyncActionType::SEM_WAIT, semaphore_id); }
+    static SyncAction signal(int at, int semaphore_id) { return SyncAction(at, SyncActionType::SEM_SIGNAL, semaphore_id); }
+    static SyncAction cvWait(int at, int cv_id, int mutex_id) { return SyncAction(at, SyncActionType::CV_WAIT, cv_id, mutex_id); }
+    static SyncAction cvSignal(int at, int cv_id) { return SyncAction(at, SyncActionType::CV_SIGNAL, cv_id); }
+    static SyncAction cvBroadcast(int at, int cv_id) { return SyncAction(at, SyncActionType::CV_BROADCAST, cv_id); }
+};
+
+/**
+ * @struct PrimitiveReport
+ * @brief 一个同步原语的统计结果
+ */
+struct PrimitiveReport {
+    int id;                ///< 原语编号
+    std::string name;      ///< 名称
+    std::string kind;      ///< 类型
+    PrimitiveStats stats;  ///< 统计信息
+};
+
+/**
+ * @struct ProcessSyncStats
+ * @brief 一个进程的阻塞统计
+ */
+struct ProcessSyncStats {
+    int pid;                       ///< 进程ID
+    int blocked_time;              ///< 在等待队列中度过的时间
+    int blocks;                    ///< 阻塞次数
+    int inversion_time;            ///< 等待的锁被更低优先级进程持有的时间（优先级反转）
+    int unbounded_inversion_time;  ///< 其中CPU被持锁链以外的更低优先级进程占用的时间
+    int boosts;                    ///< 有效优先级被协议提升的次数
+};
+
+/**
+ * @struct PriorityLevelReport
+ * @brief 同一优先级进程的延迟统计
+ */
+struct PriorityLevelReport {
+    ProcessPriority priority;      ///< 优先级
+    int processes;                 ///< 完成的进程数
+    double average_turnaround;     ///< 平均周转时间
+    int p95_turnaround;            ///< 周转时间的95百分位（最近秩）
+    int max_turnaround;            ///< 最长周转时间
+    int total_inversion_time;      ///< 优先级反转时间合计
+    int max_inversion_time;        ///< 单个进程最长的优先级反转时间
+};
+
+/**
+ * @struct SyncSimulationResult
+ * @brief 带同步的调度结果
+ */
+struct SyncSimulationResult {
+    SchedulingResult scheduling;                 ///< 常规调度统计（等待时间包含阻塞时间）
+    std::vector<PrimitiveReport> primitives;     ///< 各原语统计，按编号排列
+    std::vector<ProcessSyncStats> processes;     ///< 各进程阻塞统计，顺序与输入一致
+    std::vector<PriorityLevelReport> priority_levels;  ///< 按优先级从高到低的延迟统计
+    LockProtocol protocol;                       ///< 使用的锁协议
+    int inversion_time;                          ///< 优先级反转时间合计
+    int unbounded_inversion_time;                ///< 其中被中间优先级进程拉长的部分
+    int idle_time;                               ///< CPU空闲时间（无进程就绪）
+    bool deadlocked;                             ///< 是否以死锁结束
+    std::vector<int> deadlocked_pids;            ///< 死锁时仍在阻塞的进程
+
+    SyncSimulationResult()
+        : protocol(LockProtocol::NONE), inversion_time(0), unbounded_inversion_time(0),
+          idle_time(0), deadlocked(false) {}
+};
+
+/**
+ * @class SyncScheduler
+ * @brief 进程会在脚本指定的时刻操作互斥锁、信号量和条件变量的单CPU调度器
+ *
+ * 就绪队列按FCFS、时间片轮转、SJF或优先级的顺序出队（SJF和优先级可选抢占）。
+ * 进程执行到脚本中的时刻时进行同步操作；需要等待时离开CPU、进入原语的等待队列，
+ * 直到被释放或唤醒才回到就绪队列。全部未完成进程都阻塞且不会再有进程到达时判定为死锁。
+ *
+ * 优先级调度下，低优先级进程持有高优先级进程等待的锁时会发生优先级反转；
+ * 中间优先级的进程还能抢占持锁者，使反转时间不受临界区长度约束。
+ * 可选择优先级继承或优先级天花板协议，并让等待队列按有效优先级唤醒。
+ *
+ * 没有脚本时，结果与src/scheduler/中对应的调度器一致。
+ */
+class SyncScheduler : public Scheduler {
+public:
+    /**
+     * @brief 构造函数
+     * @param type 就绪队列的出队顺序
+     * @param preemptive 是否抢占（仅SJF和优先级调度）
+     * @param time_quantum 时间片大小（仅时间片轮转）
+     * @throws std::invalid_argument 如果时间片不是正数
+     */
+    explicit SyncScheduler(SchedulerFactory::SchedulerType type = SchedulerFactory::SchedulerType::FCFS,
+                           bool preemptive = false, int time_quantum = 2);
+
+    /**
+     * @brief 添加互斥锁
+     * @param name 名称
+     * @return 原语编号
+     */
+    int addMutex(const std::string& name);
+
+    /**
+     * @brief 添加信号量
+     * @param name 名称
+     * @param initial_count 初始计数
+     * @return 原语编号
+     * @throws std::invalid_argument 如果初始计数为负数
+     */
+    int addSemaphore(const std::string& name, int initial_count);
+
+    /**
+     * @brief 添加条件变量
+     * @param name 名称
+     * @return 原语编号
+     */
+    int addConditionVariable(const std::string& name);
+
+    /**
+     * @brief 设置进程的同步脚本
+     * @param pid 进程ID
+     * @param actions 同步操作，按at排序（相同时刻保持给定顺序）
+     * @throws std::invalid_argument 如果原语编号或类型不对、加解锁不配对或结束时仍持有锁
+     */
+    void setScript(int pid, const std::vector<SyncAction>& actions);
+
+    /**
+     * @brief 设置互斥锁的优先级协议
+     * @param protocol 锁协议，只影响优先级调度的出队顺序和抢占
+     *
+     * 天花板协议中每把锁的天花板是本次运行中会对它加锁的进程的最高基础优先级。
+     */
+    void setLockProtocol(LockProtocol protocol) { protocol_ = protocol; }
+
+    /**
+     * @brief 获取互斥锁的优先级协议
+     * @return 锁协议
+     */
+    LockProtocol getLockProtocol() const { return protocol_; }
+
+    /**
+     * @brief 设置等待队列是否按有效优先级唤醒（默认先来先服务）
+     * @param enabled 是否启用
+     */
+    void setPriorityOrderedWaits(bool enabled) { priority_waits_ = enabled; }
+
+    /**
+     * @brief 获取锁协议名称
+     * @param protocol 锁协议
+     * @return 协议名称
+     */
+    static std::string getLockProtocolName(LockProtocol protocol);
+
+    /**
+     * @brief 清除全部脚本
+     */
+    void clearScripts() { scripts_.clear(); }
+
+    /**
+     * @brief 执行调度
+     * @param processes 待调度的进程列表
+     * @return 调度结果
+     */
+    SchedulingResult schedule(const ProcessList& processes) override;
+
+    /**
+     * @brief 执行调度并返回同步统计
+     * @param processes 待调度的进程列表
+     * @return 带同步统计的调度结果
+     * @throws std::invalid_argument 如果进程列表无效、PID重复或脚本时刻超出执行时间
+     */
+    SyncSimulationResult run(const ProcessList& processes);
+
+    /**
+     * @brief 获取算法类型
+     * @return 算法类型描述
+     */
+    std::string getAlgorithmType() const override;
+
+    /**
+     * @brief 是否为抢占式调度
+     * @return true表示抢占式
+     */
+    bool isPreemptive() const override;
+
+    /**
+     * @brief 打印同步统计
+     * @param result run()的返回值
+     */
+    static void displaySyncResult(const SyncSimulationResult& result);
+
+private:
+    /// 原语类型
+    enum class PrimitiveKind { MUTEX, SEMAPHORE, CONDITION_VARIABLE };
+
+    /// 原语定义，每次运行都按定义重新创建原语
+    struct PrimitiveSpec {
+        PrimitiveKind kind;
+        std::string name;
+        int initial_count;
+    };
+
+    SchedulerFactory::SchedulerType type_;            ///< 出队顺序
+    bool preemptive_;                                 ///< 是否抢占
+    int time_quantum_;                                ///< 时间片大小
+    LockProtocol protocol_;                           ///< 互斥锁优先级协议
+    bool priority_waits_;                             ///< 等待队列是否按优先级唤醒
+    std::vector<PrimitiveSpec> specs_;                ///< 原语定义
+    std::map<int, std::vector<SyncAction>> scripts_;  ///< 各进程的同步脚本
+
+    /**
+     * @brief 检查原语编号和类型
+     * @param id 原语编号
+     * @param kind 期望的类型
+     * @throws std::invalid_argument 如果不匹配
+     */
+    void checkPrimitive(int id, PrimitiveKind kind) const;
+
+    /**
+     * @brief 按定义创建全部原语
+     * @return 原语列表，下标即编号
+     */
+    std::vector<std::unique_ptr<SyncPrimitive>> createPrimitives() const;
+};
+
+} // namespace ZTS_OS
+
+#endif // SYNC_SCHEDULER_H
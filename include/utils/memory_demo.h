@@ -39,6 +39,7 @@ struct MemoryRequest {
  * - 分页内存管理演示
  * - 页面置换算法演示
  * - 内存分配算法比较
+ * - Slab对象缓存演示
  */
 class MemoryDemo {
 public:
@@ -83,6 +84,11 @@ private:
      */
     void allocationComparisonDemo();
     
+    /**
+     * @brief Slab对象缓存演示
+     */
+    void slabAllocatorDemo();
+    
     /**
      * @brief 显示连续分配策略菜单
      */
@@ -131,8 +137,16 @@ private:
     /**
      * @brief 比较不同的页面置换算法
      * @param access_sequence 页面访问序列
+     * @param frame_count 物理页框数
+     */
+    void comparePageReplacementAlgorithms(const std::vector<int>& access_sequence, size_t frame_count);
+    
+    /**
+     * @brief 显示LRU在各页框数下的缺页曲线
+     * @param access_sequence 页面访问序列
+     * @param frame_count 当前比较所用的页框数（在曲线上标出）
      */
-    void comparePageReplacementAlgorithms(const std::vector<int>& access_sequence);
+    void displayLruFaultCurve(const std::vector<int>& access_sequence, size_t frame_count);
     
     /**
      * @brief 显示内存可视化
@@ -81,6 +81,23 @@ private:
      */
     void compareAlgorithms(const ProcessList& processes);
     
+    /**
+     * @brief 异构多核调度演示：各放置策略与单核调度的对比
+     * @param processes 进程列表
+     */
+    void multiCoreDemo(const ProcessList& processes);
+    
+    /**
+     * @brief 能耗对比演示：按能耗与能耗延迟积比较单核算法、频率调节器与放置策略
+     * @param processes 进程列表
+     */
+    void energyComparisonDemo(const ProcessList& processes);
+    
+    /**
+     * @brief 蒙特卡洛模拟演示：在随机负载上比较各调度算法的均值与置信区间
+     */
+    void monteCarloDemo();
+    
     /**
      * @brief 显示进程信息表
      * @param processes 进程列表
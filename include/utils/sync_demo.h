@@ -0,0 +1,104 @@
+#ifndef SYNC_DEMO_H
+#define SYNC_DEMO_H
+
+#include "../synchronization/sync_scheduler.h"
+#include "../synchronization/resource_manager.h"
+#include "../synchronization/smp_lock_simulator.h"
+#include "boot_animation.h"
+#include <string>
+
+/**
+ * @file sync_demo.h
+ * @brief 进程同步机制演示器
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+/**
+ * @class SyncDemo
+ * @brief 进程同步机制演示器类
+ *
+ * 提供交互式的进程同步演示功能，包括：
+ * - 互斥锁竞争与护航效应
+ * - 信号量实现的生产者-消费者
+ * - 条件变量的等待与广播
+ * - 临界区长度对吞吐率的影响
+ * - 优先级反转与优先级继承/天花板协议
+ * - 银行家算法与死锁检测
+ * - 多核上自旋-休眠锁的竞争代价
+ */
+class SyncDemo {
+public:
+    /**
+     * @brief 构造函数
+     */
+    SyncDemo() = default;
+
+    /**
+     * @brief 析构函数
+     */
+    ~SyncDemo() = default;
+
+    /**
+     * @brief 启动进程同步演示主界面
+     */
+    void start();
+
+private:
+    /**
+     * @brief 显示演示主菜单
+     */
+    void showMainMenu();
+
+    /**
+     * @brief 互斥锁竞争与护航效应演示
+     */
+    void mutexContentionDemo();
+
+    /**
+     * @brief 生产者-消费者演示
+     */
+    void producerConsumerDemo();
+
+    /**
+     * @brief 条件变量演示
+     */
+    void conditionVariableDemo();
+
+    /**
+     * @brief 临界区长度对吞吐率的影响
+     */
+    void contentionSweepDemo();
+
+    /**
+     * @brief 优先级反转与锁协议比较
+     */
+    void priorityInversionDemo();
+
+    /**
+     * @brief 银行家算法与死锁检测演示
+     */
+    void deadlockDemo();
+
+    /**
+     * @brief 多核自旋-休眠锁演示
+     */
+    void spinParkDemo();
+
+    /**
+     * @brief 暂停并等待用户按键
+     */
+    void pauseForUser();
+
+    /**
+     * @brief 清屏并显示标题
+     * @param title 标题文本
+     */
+    void showTitle(const std::string& title);
+};
+
+} // namespace ZTS_OS
+
+#endif // SYNC_DEMO_H
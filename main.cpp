@@ -3,6 +3,7 @@
 #include "include/utils/boot_animation.h"
 #include "include/utils/scheduler_demo.h"
 #include "include/utils/memory_demo.h"
+#include "include/utils/sync_demo.h"
 
 // 主程序入口
 int main() {
@@ -61,11 +62,17 @@ int main() {
                     std::cout << "\n📁 正在启动文件系统操作模块..." << std::endl;
                     std::cout << "💽 该功能将在后续版本中实现，敬请期待！" << std::endl;
                     break;
-                case 4:
+                case 4: {
+                    // 启动进程同步机制模块
                     ConsoleColor::setColor(ConsoleColor::LIGHT_GREEN);
                     std::cout << "\n🔄 正在启动进程同步机制模块..." << std::endl;
-                    std::cout << "🔗 该功能将在后续版本中实现，敬请期待！" << std::endl;
+                    Sleep(1000);
+                    
+                    // 创建并启动同步演示器
+                    ZTS_OS::SyncDemo demo;
+                    demo.start();
                     break;
+                }
                 case 5:
                     ConsoleColor::setColor(ConsoleColor::LIGHT_GREEN);
                     std::cout << "\n📊 正在启动系统性能监控模块..." << std::endl;
@@ -0,0 +1,256 @@
+#include "../../include/memory/BuddyAllocator.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+/**
+ * @file BuddyAllocator.cpp
+ * @brief 二进制伙伴系统分配器实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+// 2^order
+size_t blockSize(int order) {
+    return static_cast<size_t>(1) << order;
+}
+
+} // namespace
+
+// 构造函数
+BuddyAllocator::BuddyAllocator(size_t total_size)
+    : MemoryManager(total_size), max_order_(0), free_block_count_(0), requested_size_(0) {
+    if (total_size == 0) {
+        throw std::invalid_argument("伙伴系统的总内存大小必须为正数");
+    }
+
+    while (blockSize(max_order_ + 1) <= total_size) {
+        max_order_++;
+    }
+    free_heads_.assign(max_order_ + 1, kNil);
+    free_counts_.assign(max_order_ + 1, 0);
+    free_next_.assign(total_size, kNil);
+    free_prev_.assign(total_size, kNil);
+    handle_at_.assign(total_size, -1);
+    free_bitmap_.resize(max_order_ + 1);
+    for (int order = 0; order <= max_order_; ++order) {
+        free_bitmap_[order].assign(total_size >> order, false);
+    }
+
+    // 把内存切成按地址对齐的最大块
+    memory_blocks_.clear();
+    size_t address = 0;
+    while (address < total_size) {
+        int order = max_order_;
+        while (blockSize(order) > total_size - address || address % blockSize(order) != 0) {
+            order--;
+        }
+        handle_at_[address] = memory_blocks_.pushBack(MemoryBlock(address, blockSize(order), true, -1, "空闲"));
+        pushFree(address, order);
+        address += blockSize(order);
+    }
+}
+
+// 分配内存
+int BuddyAllocator::allocateMemory(size_t size, int process_id, const std::string& name) {
+    if (size == 0) return -1;
+
+    int order = orderFor(size);
+    int available = order;
+    while (available <= max_order_ && free_heads_[available] == kNil) {
+        available++;
+    }
+    if (available > max_order_) {
+        trace() << "❌ 无法为进程 " << process_id << " 分配 " << size 
+                  << "KB 内存：空间不足" << std::endl;
+        return -1;
+    }
+
+    // 取出空闲块，逐阶对半分割，上半块挂到低一阶的空闲链表
+    size_t address = free_heads_[available];
+    removeFree(address, available);
+    int handle = handle_at_[address];
+    while (available > order) {
+        available--;
+        size_t buddy = address + blockSize(available);
+        memory_blocks_[handle].size = blockSize(available);
+        handle_at_[buddy] = memory_blocks_.insertAfter(
+            handle, MemoryBlock(buddy, blockSize(available), true, -1, "空闲"));
+        pushFree(buddy, available);
+    }
+
+    MemoryBlock& block = memory_blocks_[handle];
+    block.is_free = false;
+    block.process_id = process_id;
+    block.name = name.empty() ? ("进程" + std::to_string(process_id)) : name;
+    used_size_ += block.size;
+    requested_size_ += size;
+    allocations_[process_id].push_back({address, order, size});
+
+    trace() << "✅ 成功为进程 " << process_id << " (" << block.name
+              << ") 分配 " << size << "KB 内存（伙伴块 " << block.size << "KB），起始地址: "
+              << address << std::endl;
+
+    return static_cast<int>(address);
+}
+
+// 释放内存
+bool BuddyAllocator::deallocateMemory(int process_id) {
+    auto owner = allocations_.find(process_id);
+    if (owner == allocations_.end()) {
+        trace() << "❌ 未找到进程 " << process_id << " 的内存分配" << std::endl;
+        return false;
+    }
+
+    for (const auto& allocation : owner->second) {
+        size_t address = allocation.address;
+        int order = allocation.order;
+        int handle = handle_at_[address];
+        MemoryBlock& released = memory_blocks_[handle];
+        trace() << "✅ 释放进程 " << process_id << " (" << released.name
+                  << ") 的内存：" << released.size << "KB" << std::endl;
+
+        released.is_free = true;
+        released.process_id = -1;
+        released.name = "空闲";
+        used_size_ -= released.size;
+        requested_size_ -= allocation.requested;
+
+        // 伙伴空闲就合并，直到伙伴被占用或越过内存末尾
+        while (order < max_order_) {
+            size_t buddy = address ^ blockSize(order);
+            if (buddy + blockSize(order) > total_size_ || !isFree(buddy, order)) {
+                break;
+            }
+            removeFree(buddy, order);
+            size_t left = std::min(address, buddy);
+            size_t right = std::max(address, buddy);
+            int left_handle = handle_at_[left];
+            memory_blocks_[left_handle].size = blockSize(order + 1);
+            memory_blocks_.erase(handle_at_[right]);
+            handle_at_[right] = -1;
+            address = left;
+            order++;
+        }
+        pushFree(address, order);
+    }
+
+    allocations_.erase(owner);
+    return true;
+}
+
+// 伙伴系统不做内存压缩
+void BuddyAllocator::compactMemory() {
+    trace() << "\n⚠️ 伙伴系统的块必须按大小对齐，靠合并伙伴消除外部碎片，不做内存压缩" << std::endl;
+}
+
+// 获取最大空闲块大小
+size_t BuddyAllocator::getLargestFreeBlock() const {
+    for (int order = max_order_; order >= 0; --order) {
+        if (free_counts_[order] > 0) {
+            return blockSize(order);
+        }
+    }
+    return 0;
+}
+
+// 获取内部碎片程度
+double BuddyAllocator::getInternalFragmentation() const {
+    if (used_size_ == 0) return 0.0;
+    return static_cast<double>(used_size_ - requested_size_) / used_size_ * 100.0;
+}
+
+// 获取某一阶的空闲块数
+size_t BuddyAllocator::getFreeCount(int order) const {
+    if (order < 0 || order > max_order_) {
+        throw std::invalid_argument("阶数超出范围");
+    }
+    return free_counts_[order];
+}
+
+// 显示内存状态
+void BuddyAllocator::displayMemoryStatus() const {
+    std::cout << "\n📊 内存状态信息（伙伴系统）：" << std::endl;
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
+    std::cout << "总内存大小: " << total_size_ << " KB" << std::endl;
+    std::cout << "已分配: " << getUsedSize() << " KB ("
+              << std::fixed << std::setprecision(1) << getMemoryUtilization() << "%)，其中请求 "
+              << requested_size_ << " KB" << std::endl;
+    std::cout << "空闲: " << getFreeSize() << " KB" << std::endl;
+    std::cout << "内部碎片: " << std::fixed << std::setprecision(1) << getInternalFragmentation() << "%" << std::endl;
+    std::cout << "外部碎片: " << std::fixed << std::setprecision(1) << getFragmentation() << "%" << std::endl;
+    std::cout << "最大空闲块: " << getLargestFreeBlock() << " KB" << std::endl;
+    std::cout << "空闲块数量: " << getFreeBlockCount() << std::endl;
+
+    std::cout << "各阶空闲块:";
+    for (int order = max_order_; order >= 0; --order) {
+        if (free_counts_[order] > 0) {
+            std::cout << " " << blockSize(order) << "KB×" << free_counts_[order];
+        }
+    }
+    std::cout << std::endl;
+
+    displayMemoryMap();
+}
+
+// 查找能放下size的最小空闲块
+int BuddyAllocator::findFreeBlock(size_t size) {
+    for (int order = orderFor(size); order <= max_order_; ++order) {
+        if (free_heads_[order] != kNil) {
+            return handle_at_[free_heads_[order]];
+        }
+    }
+    return -1;
+}
+
+// 计算能放下size的最小阶数
+int BuddyAllocator::orderFor(size_t size) {
+    int order = 0;
+    while (order < 63 && blockSize(order) < size) {
+        order++;
+    }
+    return order;
+}
+
+// 加入空闲链表
+void BuddyAllocator::pushFree(size_t address, int order) {
+    size_t head = free_heads_[order];
+    free_next_[address] = head;
+    free_prev_[address] = kNil;
+    if (head != kNil) {
+        free_prev_[head] = address;
+    }
+    free_heads_[order] = address;
+    free_bitmap_[order][address >> order] = true;
+    free_counts_[order]++;
+    free_block_count_++;
+}
+
+// 从空闲链表摘下
+void BuddyAllocator::removeFree(size_t address, int order) {
+    size_t before = free_prev_[address];
+    size_t after = free_next_[address];
+    if (before != kNil) {
+        free_next_[before] = after;
+    } else {
+        free_heads_[order] = after;
+    }
+    if (after != kNil) {
+        free_prev_[after] = before;
+    }
+    free_bitmap_[order][address >> order] = false;
+    free_counts_[order]--;
+    free_block_count_--;
+}
+
+// 判断块是否空闲
+bool BuddyAllocator::isFree(size_t address, int order) const {
+    return free_bitmap_[order][address >> order];
+}
+
+} // namespace ZTS_OS
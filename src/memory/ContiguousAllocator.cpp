@@ -15,8 +15,9 @@ namespace ZTS_OS {
 
 // 构造函数
 ContiguousAllocator::ContiguousAllocator(size_t total_size, MemoryAllocationStrategy strategy)
-    : MemoryManager(total_size), next_fit_pointer_(0) {
+    : MemoryManager(total_size), next_fit_pointer_(memory_blocks_.head()) {
     strategy_ = strategy;
+    rebuildFreeIndex();
 }
 
 // 分配内存
@@ -24,23 +25,37 @@ int ContiguousAllocator::allocateMemory(size_t size, int process_id, const std::
     if (size == 0) return -1;
     
     // 查找合适的空闲块
-    int block_index = findFreeBlock(size);
-    if (block_index == -1) {
-        std::cout << "❌ 无法为进程 " << process_id << " 分配 " << size 
+    int block_id = findFreeBlock(size);
+    if (block_id == -1) {
+        trace() << "❌ 无法为进程 " << process_id << " 分配 " << size 
                   << "KB 内存：空间不足" << std::endl;
         return -1;
     }
     
-    // 分割块（如果需要）
-    splitBlock(block_index, size);
+    // 分割块（如果需要），剩余部分作为新的空闲块登记
+    size_t original_size = memory_blocks_[block_id].size;
+    free_index_.erase(memory_blocks_[block_id].start_address, original_size);
+    splitBlock(block_id, size);
+    if (original_size > size) {
+        int remainder = memory_blocks_.next(block_id);
+        free_index_.insert(memory_blocks_[remainder].start_address, memory_blocks_[remainder].size, remainder);
+    }
+    
+    // 循环首次适应从分配出去的块之后继续查找
+    if (strategy_ == MemoryAllocationStrategy::NEXT_FIT) {
+        int following = memory_blocks_.next(block_id);
+        next_fit_pointer_ = following >= 0 ? following : memory_blocks_.head();
+    }
     
     // 标记块为已分配
-    MemoryBlock& block = memory_blocks_[block_index];
+    MemoryBlock& block = memory_blocks_[block_id];
     block.is_free = false;
     block.process_id = process_id;
+    used_size_ += block.size;
     block.name = name.empty() ? ("进程" + std::to_string(process_id)) : name;
+    linkOwner(block_id);
     
-    std::cout << "✅ 成功为进程 " << process_id << " (" << block.name 
+    trace() << "✅ 成功为进程 " << process_id << " (" << block.name 
               << ") 分配 " << size << "KB 内存，起始地址: " << block.start_address << std::endl;
     
     return static_cast<int>(block.start_address);
@@ -48,28 +63,77 @@ int ContiguousAllocator::allocateMemory(size_t size, int process_id, const std::
 
 // 释放内存
 bool ContiguousAllocator::deallocateMemory(int process_id) {
-    bool found = false;
+    auto owner = owner_heads_.find(process_id);
+    bool found = owner != owner_heads_.end();
     
-    for (auto& block : memory_blocks_) {
-        if (!block.is_free && block.process_id == process_id) {
-            std::cout << "✅ 释放进程 " << process_id << " (" << block.name 
+    if (found) {
+        int id = owner->second;
+        owner_heads_.erase(owner);
+        while (id >= 0) {
+            const MemoryBlock& block = memory_blocks_[id];
+            trace() << "✅ 释放进程 " << process_id << " (" << block.name 
                       << ") 的内存：" << block.size << "KB" << std::endl;
             
-            block.is_free = true;
-            block.process_id = -1;
-            block.name = "空闲";
-            found = true;
+            // 合并可能回收当前块的句柄，先记下进程的下一块
+            int next_owned = block.owner_next;
+            releaseBlock(id);
+            id = next_owned;
         }
+    } else {
+        trace() << "❌ 未找到进程 " << process_id << " 的内存分配" << std::endl;
     }
     
-    if (found) {
-        // 合并相邻的空闲块
-        mergeAdjacentFreeBlocks();
+    return found;
+}
+
+// 内存压缩
+void ContiguousAllocator::compactMemory() {
+    MemoryManager::compactMemory();
+    next_fit_pointer_ = memory_blocks_.head();
+    rebuildFreeIndex();
+    rebuildOwnerIndex();
+}
+
+// 重建空闲块索引
+void ContiguousAllocator::rebuildFreeIndex() {
+    free_index_.clear();
+    for (int id = memory_blocks_.head(); id >= 0; id = memory_blocks_.next(id)) {
+        const MemoryBlock& block = memory_blocks_[id];
+        if (block.is_free) {
+            free_index_.insert(block.start_address, block.size, id);
+        }
+    }
+}
+
+// 释放一个已分配块并与相邻空闲块合并
+int ContiguousAllocator::releaseBlock(int block) {
+    MemoryBlock& released = memory_blocks_[block];
+    used_size_ -= released.size;
+    released.is_free = true;
+    released.process_id = -1;
+    released.name = "空闲";
+    released.owner_next = -1;
+    
+    // 相邻的空闲块要并入，先从索引中移除
+    int before = memory_blocks_.prev(block);
+    int after = memory_blocks_.next(block);
+    if (before >= 0 && memory_blocks_[before].is_free) {
+        free_index_.erase(memory_blocks_[before].start_address, memory_blocks_[before].size);
+    }
+    if (after >= 0 && memory_blocks_[after].is_free) {
+        free_index_.erase(memory_blocks_[after].start_address, memory_blocks_[after].size);
     } else {
-        std::cout << "❌ 未找到进程 " << process_id << " 的内存分配" << std::endl;
+        after = -1;
     }
     
-    return found;
+    int merged = coalesceBlock(block);
+    free_index_.insert(memory_blocks_[merged].start_address, memory_blocks_[merged].size, merged);
+    
+    // 被并入的块句柄失效，循环首次适应的指针改指合并后的块
+    if (next_fit_pointer_ == block || (after >= 0 && next_fit_pointer_ == after)) {
+        next_fit_pointer_ = merged;
+    }
+    return merged;
 }
 
 // 显示内存状态
@@ -88,24 +152,6 @@ void ContiguousAllocator::displayMemoryStatus() const {
     displayMemoryMap();
 }
 
-// 显示内存映射图
-void ContiguousAllocator::displayMemoryMap() const {
-    std::cout << "\n🗺️ 内存映射图：" << std::endl;
-    std::cout << "┌─────────────┬─────────────┬─────────────┬─────────────┬─────────────────────┐" << std::endl;
-    std::cout << "│   起始地址  │   结束地址  │    大小     │   状态      │      进程/名称      │" << std::endl;
-    std::cout << "├─────────────┼─────────────┼─────────────┼─────────────┼─────────────────────┤" << std::endl;
-    
-    for (const auto& block : memory_blocks_) {
-        std::cout << "│ " << std::setw(11) << block.start_address
-                  << " │ " << std::setw(11) << block.end_address()
-                  << " │ " << std::setw(9) << block.size << " KB"
-                  << " │ " << std::setw(11) << (block.is_free ? "空闲" : "已分配")
-                  << " │ " << std::setw(19) << block.name
-                  << " │" << std::endl;
-    }
-    std::cout << "└─────────────┴─────────────┴─────────────┴─────────────┴─────────────────────┘" << std::endl;
-}
-
 // 获取分配策略名称
 std::string ContiguousAllocator::getStrategyName(MemoryAllocationStrategy strategy) {
     switch (strategy) {
@@ -124,24 +170,12 @@ std::string ContiguousAllocator::getStrategyName(MemoryAllocationStrategy strate
 
 // 获取最大空闲块大小
 size_t ContiguousAllocator::getLargestFreeBlock() const {
-    size_t largest = 0;
-    for (const auto& block : memory_blocks_) {
-        if (block.is_free && block.size > largest) {
-            largest = block.size;
-        }
-    }
-    return largest;
+    return free_index_.largest();
 }
 
 // 获取空闲块数量
 int ContiguousAllocator::getFreeBlockCount() const {
-    int count = 0;
-    for (const auto& block : memory_blocks_) {
-        if (block.is_free) {
-            count++;
-        }
-    }
-    return count;
+    return static_cast<int>(free_index_.count());
 }
 
 // 查找空闲块
@@ -160,61 +194,34 @@ int ContiguousAllocator::findFreeBlock(size_t size) {
     }
 }
 
-// 首次适应算法
+// 首次适应算法：地址最小的可用空闲块
 int ContiguousAllocator::firstFit(size_t size) {
-    for (size_t i = 0; i < memory_blocks_.size(); ++i) {
-        if (memory_blocks_[i].is_free && memory_blocks_[i].size >= size) {
-            return static_cast<int>(i);
-        }
-    }
-    return -1;
+    return free_index_.firstFit(size);
 }
 
-// 最佳适应算法
+// 最佳适应算法：最小的可用空闲块，同样大小取地址最小的
 int ContiguousAllocator::bestFit(size_t size) {
-    int best_index = -1;
-    size_t best_size = SIZE_MAX;
-    
-    for (size_t i = 0; i < memory_blocks_.size(); ++i) {
-        if (memory_blocks_[i].is_free && 
-            memory_blocks_[i].size >= size && 
-            memory_blocks_[i].size < best_size) {
-            best_index = static_cast<int>(i);
-            best_size = memory_blocks_[i].size;
-        }
-    }
-    
-    return best_index;
+    return free_index_.bestFit(size);
 }
 
-// 最坏适应算法
+// 最坏适应算法：最大的空闲块，同样大小取地址最小的
 int ContiguousAllocator::worstFit(size_t size) {
-    int worst_index = -1;
-    size_t worst_size = 0;
-    
-    for (size_t i = 0; i < memory_blocks_.size(); ++i) {
-        if (memory_blocks_[i].is_free && 
-            memory_blocks_[i].size >= size && 
-            memory_blocks_[i].size > worst_size) {
-            worst_index = static_cast<int>(i);
-            worst_size = memory_blocks_[i].size;
-        }
-    }
-    
-    return worst_index;
+    return free_index_.worstFit(size);
 }
 
 // 循环首次适应算法
 int ContiguousAllocator::nextFit(size_t size) {
     size_t block_count = memory_blocks_.size();
     
-    // 从上次分配位置开始查找
+    // 从上次分配位置开始查找，到链表末尾后回到开头
+    int id = next_fit_pointer_;
     for (size_t i = 0; i < block_count; ++i) {
-        size_t index = (next_fit_pointer_ + i) % block_count;
-        
-        if (memory_blocks_[index].is_free && memory_blocks_[index].size >= size) {
-            next_fit_pointer_ = (index + 1) % block_count;
-            return static_cast<int>(index);
+        if (memory_blocks_[id].is_free && memory_blocks_[id].size >= size) {
+            return id;
+        }
+        id = memory_blocks_.next(id);
+        if (id < 0) {
+            id = memory_blocks_.head();
         }
     }
     
@@ -0,0 +1,138 @@
+#include "../../include/memory/FreeBlockIndex.h"
+#include <algorithm>
+
+/**
+ * @file FreeBlockIndex.cpp
+ * @brief 空闲块索引实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 构造函数
+FreeBlockIndex::FreeBlockIndex() : root_(-1), seed_(2463534242u) {
+}
+
+// 重新计算结点的子树最大空闲块
+void FreeBlockIndex::update(int node) {
+    Node& current = nodes_[node];
+    current.max_size = std::max(current.size, std::max(maxOf(current.left), maxOf(current.right)));
+}
+
+// 按地址把子树分成 < address 和 >= address 两部分
+void FreeBlockIndex::split(int node, size_t address, int& left, int& right) {
+    if (node < 0) {
+        left = right = -1;
+        return;
+    }
+    if (nodes_[node].address < address) {
+        split(nodes_[node].right, address, nodes_[node].right, right);
+        left = node;
+    } else {
+        split(nodes_[node].left, address, left, nodes_[node].left);
+        right = node;
+    }
+    update(node);
+}
+
+// 合并两棵子树（left中的地址都小于right）
+int FreeBlockIndex::merge(int left, int right) {
+    if (left < 0) {
+        return right;
+    }
+    if (right < 0) {
+        return left;
+    }
+    if (nodes_[left].priority > nodes_[right].priority) {
+        nodes_[left].right = merge(nodes_[left].right, right);
+        update(left);
+        return left;
+    }
+    nodes_[right].left = merge(left, nodes_[right].left);
+    update(right);
+    return right;
+}
+
+// 加入空闲块
+void FreeBlockIndex::insert(size_t address, size_t size, int block) {
+    by_size_.emplace(std::make_pair(size, address), block);
+
+    // xorshift32生成优先级
+    seed_ ^= seed_ << 13;
+    seed_ ^= seed_ >> 17;
+    seed_ ^= seed_ << 5;
+    Node node = {address, size, size, seed_, block, -1, -1};
+    int id;
+    if (free_nodes_.empty()) {
+        id = static_cast<int>(nodes_.size());
+        nodes_.push_back(node);
+    } else {
+        id = free_nodes_.back();
+        free_nodes_.pop_back();
+        nodes_[id] = node;
+    }
+
+    int left = -1;
+    int right = -1;
+    split(root_, address, left, right);
+    root_ = merge(merge(left, id), right);
+}
+
+// 移除空闲块
+void FreeBlockIndex::erase(size_t address, size_t size) {
+    by_size_.erase(std::make_pair(size, address));
+
+    int left = -1;
+    int middle = -1;
+    int right = -1;
+    split(root_, address, left, right);
+    split(right, address + 1, middle, right);
+    if (middle >= 0) {
+        free_nodes_.push_back(middle);
+    }
+    root_ = merge(left, right);
+}
+
+// 清空索引
+void FreeBlockIndex::clear() {
+    by_size_.clear();
+    nodes_.clear();
+    free_nodes_.clear();
+    root_ = -1;
+}
+
+// 首次适应
+int FreeBlockIndex::firstFit(size_t size) const {
+    if (maxOf(root_) < size) {
+        return -1;
+    }
+    int node = root_;
+    while (true) {
+        const Node& current = nodes_[node];
+        if (maxOf(current.left) >= size) {
+            node = current.left;
+        } else if (current.size >= size) {
+            return current.block;
+        } else {
+            node = current.right;
+        }
+    }
+}
+
+// 最佳适应
+int FreeBlockIndex::bestFit(size_t size) const {
+    auto it = by_size_.lower_bound(std::make_pair(size, static_cast<size_t>(0)));
+    return it == by_size_.end() ? -1 : it->second;
+}
+
+// 最坏适应
+int FreeBlockIndex::worstFit(size_t size) const {
+    size_t biggest = largest();
+    if (by_size_.empty() || biggest < size) {
+        return -1;
+    }
+    return by_size_.lower_bound(std::make_pair(biggest, static_cast<size_t>(0)))->second;
+}
+
+} // namespace ZTS_OS
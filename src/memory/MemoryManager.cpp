@@ -12,11 +12,97 @@
 
 namespace ZTS_OS {
 
+// 构造函数
+BlockList::BlockList() : head_(-1), tail_(-1), count_(0) {
+}
+
+// 从结点池取一个结点
+int BlockList::allocateNode(const MemoryBlock& block) {
+    int id;
+    if (free_nodes_.empty()) {
+        id = static_cast<int>(nodes_.size());
+        nodes_.push_back(block);
+    } else {
+        id = free_nodes_.back();
+        free_nodes_.pop_back();
+        nodes_[id] = block;
+    }
+    count_++;
+    return id;
+}
+
+// 在链表末尾加入一块
+int BlockList::pushBack(const MemoryBlock& block) {
+    int id = allocateNode(block);
+    nodes_[id].prev = tail_;
+    nodes_[id].next = -1;
+    if (tail_ >= 0) {
+        nodes_[tail_].next = id;
+    } else {
+        head_ = id;
+    }
+    tail_ = id;
+    return id;
+}
+
+// 在指定块之后插入一块
+int BlockList::insertAfter(int position, const MemoryBlock& block) {
+    int id = allocateNode(block);
+    int following = nodes_[position].next;
+    nodes_[id].prev = position;
+    nodes_[id].next = following;
+    nodes_[position].next = id;
+    if (following >= 0) {
+        nodes_[following].prev = id;
+    } else {
+        tail_ = id;
+    }
+    return id;
+}
+
+// 删除一块
+void BlockList::erase(int block) {
+    int before = nodes_[block].prev;
+    int after = nodes_[block].next;
+    if (before >= 0) {
+        nodes_[before].next = after;
+    } else {
+        head_ = after;
+    }
+    if (after >= 0) {
+        nodes_[after].prev = before;
+    } else {
+        tail_ = before;
+    }
+    nodes_[block].name.clear();
+    free_nodes_.push_back(block);
+    count_--;
+}
+
+// 清空链表
+void BlockList::clear() {
+    nodes_.clear();
+    free_nodes_.clear();
+    head_ = tail_ = -1;
+    count_ = 0;
+}
+
+// 按地址顺序复制出全部块
+std::vector<MemoryBlock> BlockList::toVector() const {
+    std::vector<MemoryBlock> blocks;
+    blocks.reserve(count_);
+    for (int id = head_; id >= 0; id = nodes_[id].next) {
+        blocks.push_back(nodes_[id]);
+    }
+    return blocks;
+}
+
 // 构造函数
 MemoryManager::MemoryManager(size_t total_size) 
-    : total_size_(total_size), strategy_(MemoryAllocationStrategy::FIRST_FIT) {
+    : total_size_(total_size), used_size_(0), strategy_(MemoryAllocationStrategy::FIRST_FIT),
+      trace_enabled_(true) {
     // 初始化整个内存为一个大的空闲块
-    memory_blocks_.emplace_back(0, total_size, true, -1, "空闲");
+    memory_blocks_.pushBack(MemoryBlock(0, total_size, true, -1, "空闲"));
 }
 
 // 获取内存使用率
@@ -30,122 +116,150 @@ double MemoryManager::getFragmentation() const {
     size_t free_size = getFreeSize();
     if (free_size == 0) return 0.0;
     
-    // 计算最大空闲块
-    size_t largest_free_block = 0;
-    for (const auto& block : memory_blocks_) {
-        if (block.is_free && block.size > largest_free_block) {
-            largest_free_block = block.size;
-        }
-    }
+    size_t largest_free_block = getLargestFreeBlock();
     
     // 外部碎片化 = (总空闲空间 - 最大空闲块) / 总空闲空间
     if (largest_free_block >= free_size) return 0.0;
     return static_cast<double>(free_size - largest_free_block) / free_size * 100.0;
 }
 
-// 获取已使用内存大小
-size_t MemoryManager::getUsedSize() const {
-    size_t used = 0;
-    for (const auto& block : memory_blocks_) {
-        if (!block.is_free) {
-            used += block.size;
+// 获取最大空闲块大小
+size_t MemoryManager::getLargestFreeBlock() const {
+    size_t largest = 0;
+    for (int id = memory_blocks_.head(); id >= 0; id = memory_blocks_.next(id)) {
+        const MemoryBlock& block = memory_blocks_[id];
+        if (block.is_free && block.size > largest) {
+            largest = block.size;
         }
     }
-    return used;
-}
-
-// 获取空闲内存大小
-size_t MemoryManager::getFreeSize() const {
-    return total_size_ - getUsedSize();
+    return largest;
 }
 
 // 内存压缩（碎片整理）
 void MemoryManager::compactMemory() {
-    std::cout << "\n🔧 开始内存压缩..." << std::endl;
+    trace() << "\n🔧 开始内存压缩..." << std::endl;
     
     // 将所有已分配的块移到内存开头
-    std::vector<MemoryBlock> new_blocks;
+    BlockList new_blocks;
     size_t current_address = 0;
     
     // 先添加所有已分配的块
-    for (auto& block : memory_blocks_) {
+    for (int id = memory_blocks_.head(); id >= 0; id = memory_blocks_.next(id)) {
+        MemoryBlock& block = memory_blocks_[id];
         if (!block.is_free) {
             block.start_address = current_address;
-            new_blocks.push_back(block);
+            new_blocks.pushBack(block);
             current_address += block.size;
             
-            std::cout << "移动进程 " << block.process_id << " (" << block.name 
+            trace() << "移动进程 " << block.process_id << " (" << block.name 
                       << ") 到地址 " << block.start_address << std::endl;
         }
     }
     
     // 如果还有剩余空间，添加一个空闲块
     if (current_address < total_size_) {
-        new_blocks.emplace_back(current_address, total_size_ - current_address, true, -1, "空闲");
+        new_blocks.pushBack(MemoryBlock(current_address, total_size_ - current_address, true, -1, "空闲"));
     }
     
     memory_blocks_ = std::move(new_blocks);
     
-    std::cout << "✅ 内存压缩完成！" << std::endl;
+    trace() << "✅ 内存压缩完成！" << std::endl;
 }
 
-// 合并相邻的空闲块
-void MemoryManager::mergeAdjacentFreeBlocks() {
-    std::sort(memory_blocks_.begin(), memory_blocks_.end(),
-              [](const MemoryBlock& a, const MemoryBlock& b) {
-                  return a.start_address < b.start_address;
-              });
+// 显示内存映射图
+void MemoryManager::displayMemoryMap() const {
+    std::cout << "\n🗺️ 内存映射图：" << std::endl;
+    std::cout << "┌─────────────┬─────────────┬─────────────┬─────────────┬─────────────────────┐" << std::endl;
+    std::cout << "│   起始地址  │   结束地址  │    大小     │   状态      │      进程/名称      │" << std::endl;
+    std::cout << "├─────────────┼─────────────┼─────────────┼─────────────┼─────────────────────┤" << std::endl;
     
-    std::vector<MemoryBlock> merged_blocks;
-    
-    for (const auto& block : memory_blocks_) {
-        if (merged_blocks.empty()) {
-            merged_blocks.push_back(block);
-        } else {
-            auto& last_block = merged_blocks.back();
-            
-            // 如果当前块和上一个块都是空闲且相邻，则合并
-            if (last_block.is_free && block.is_free &&
-                last_block.end_address() + 1 == block.start_address) {
-                last_block.size += block.size;
-            } else {
-                merged_blocks.push_back(block);
-            }
+    for (int id = memory_blocks_.head(); id >= 0; id = memory_blocks_.next(id)) {
+        const MemoryBlock& block = memory_blocks_[id];
+        std::cout << "│ " << std::setw(11) << block.start_address
+                  << " │ " << std::setw(11) << block.end_address()
+                  << " │ " << std::setw(9) << block.size << " KB"
+                  << " │ " << std::setw(11) << (block.is_free ? "空闲" : "已分配")
+                  << " │ " << std::setw(19) << block.name
+                  << " │" << std::endl;
+    }
+    std::cout << "└─────────────┴─────────────┴─────────────┴─────────────┴─────────────────────┘" << std::endl;
+}
+
+// 获取过程信息输出流
+std::ostream& MemoryManager::trace() const {
+    // 没有缓冲区的流处于badbit状态，所有输出操作都会被直接跳过
+    static std::ostream null_stream(nullptr);
+    return trace_enabled_ ? std::cout : null_stream;
+}
+
+// 把已分配块加入所属进程的链表头部
+void MemoryManager::linkOwner(int block) {
+    MemoryBlock& owned = memory_blocks_[block];
+    auto result = owner_heads_.emplace(owned.process_id, block);
+    owned.owner_next = -1;
+    if (!result.second) {
+        owned.owner_next = result.first->second;
+        result.first->second = block;
+    }
+}
+
+// 重建各进程的已分配块链表
+void MemoryManager::rebuildOwnerIndex() {
+    owner_heads_.clear();
+    for (int id = memory_blocks_.head(); id >= 0; id = memory_blocks_.next(id)) {
+        if (!memory_blocks_[id].is_free) {
+            linkOwner(id);
         }
     }
+}
+
+// 把空闲块与相邻的空闲块合并
+int MemoryManager::coalesceBlock(int block) {
+    int before = memory_blocks_.prev(block);
+    if (before >= 0 && memory_blocks_[before].is_free) {
+        memory_blocks_[before].size += memory_blocks_[block].size;
+        memory_blocks_.erase(block);
+        block = before;
+    }
+    
+    int after = memory_blocks_.next(block);
+    if (after >= 0 && memory_blocks_[after].is_free) {
+        memory_blocks_[block].size += memory_blocks_[after].size;
+        memory_blocks_.erase(after);
+    }
     
-    memory_blocks_ = std::move(merged_blocks);
+    return block;
 }
 
 // 分割内存块
-int MemoryManager::splitBlock(int block_index, size_t size) {
-    if (block_index < 0 || block_index >= static_cast<int>(memory_blocks_.size())) {
+int MemoryManager::splitBlock(int block, size_t size) {
+    if (block < 0) {
         return -1;
     }
     
-    MemoryBlock& block = memory_blocks_[block_index];
+    MemoryBlock& current = memory_blocks_[block];
     
-    if (!block.is_free || block.size < size) {
+    if (!current.is_free || current.size < size) {
         return -1;
     }
     
     // 如果块大小正好等于请求大小，不需要分割
-    if (block.size == size) {
-        return block_index;
+    if (current.size == size) {
+        return block;
     }
     
     // 创建新的空闲块
-    MemoryBlock new_block(block.start_address + size, 
-                         block.size - size, 
+    MemoryBlock new_block(current.start_address + size, 
+                         current.size - size, 
                          true, -1, "空闲");
     
     // 调整原块大小
-    block.size = size;
+    current.size = size;
     
     // 插入新块
-    memory_blocks_.insert(memory_blocks_.begin() + block_index + 1, new_block);
+    memory_blocks_.insertAfter(block, new_block);
     
-    return block_index;
+    return block;
 }
 
 } // namespace ZTS_OS 
\ No newline at end of file
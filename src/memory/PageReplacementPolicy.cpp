@@ -0,0 +1,582 @@
+#include "../../include/memory/PageReplacementPolicy.h"
+#include <algorithm>
+
+/**
+ * @file PageReplacementPolicy.cpp
+ * @brief 带历史信息的页面置换策略实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 创建置换策略
+std::unique_ptr<PageReplacementPolicy> PageReplacementPolicy::create(PageReplacementAlgorithm algorithm,
+                                                                     size_t frames) {
+    switch (algorithm) {
+        case PageReplacementAlgorithm::ARC:
+            return std::unique_ptr<PageReplacementPolicy>(new ArcPolicy(frames));
+        case PageReplacementAlgorithm::TWO_QUEUE:
+            return std::unique_ptr<PageReplacementPolicy>(new TwoQueuePolicy(frames));
+        case PageReplacementAlgorithm::LIRS:
+            return std::unique_ptr<PageReplacementPolicy>(new LirsPolicy(frames));
+        case PageReplacementAlgorithm::CLOCK_PRO:
+            return std::unique_ptr<PageReplacementPolicy>(new ClockProPolicy(frames));
+        case PageReplacementAlgorithm::WS_CLOCK:
+            return std::unique_ptr<PageReplacementPolicy>(new WsClockPolicy(frames));
+        default:
+            return nullptr;
+    }
+}
+
+// ==================== ARC ====================
+
+// 构造函数
+ArcPolicy::ArcPolicy(size_t frames)
+    : PageReplacementPolicy(frames), frame_nodes_(frames), target_(0),
+      prepared_(kNoPage), prepared_list_(kT1) {}
+
+// 页面调入页框
+void ArcPolicy::onLoad(int frame, long long key) {
+    // 有空闲页框时evict不会被调用，历史命中的调整在这里完成
+    if (key == kNoPage || prepared_ != key) {
+        prepare(key, false);
+    }
+    prepared_ = kNoPage;
+
+    std::list<Node>& list = lists_[prepared_list_];
+    frame_nodes_[frame] = list.insert(list.end(), Node{key, frame, prepared_list_});
+    frame_keys_[frame] = key;
+}
+
+// 驻留页面被访问：移到T2的MRU端
+void ArcPolicy::onHit(int frame, bool is_write) {
+    (void)is_write;
+    auto node = frame_nodes_[frame];
+    int from = node->list;
+    node->list = kT2;
+    lists_[kT2].splice(lists_[kT2].end(), lists_[from], node);
+}
+
+// 选出牺牲页框
+int ArcPolicy::evict(long long incoming) {
+    int victim = prepare(incoming, true);
+    prepared_ = incoming;
+    return victim;
+}
+
+// 页框被直接收回
+void ArcPolicy::onRemove(int frame) {
+    auto node = frame_nodes_[frame];
+    lists_[node->list].erase(node);
+    frame_keys_[frame] = kNoPage;
+}
+
+// 按ARC处理一次缺页：调整p、修剪历史，需要时选出牺牲页框
+int ArcPolicy::prepare(long long key, bool need_victim) {
+    int victim = -1;
+    auto ghost = key == kNoPage ? ghosts_.end() : ghosts_.find(key);
+    if (ghost != ghosts_.end()) {
+        // 命中B1：增大T1的目标；命中B2：减小T1的目标
+        int list = ghost->second->list;
+        size_t b1 = lists_[kB1].size();
+        size_t b2 = lists_[kB2].size();
+        if (list == kB1) {
+            target_ = std::min(frames_, target_ + std::max<size_t>(b2 / b1, 1));
+        } else {
+            target_ -= std::min(target_, std::max<size_t>(b1 / b2, 1));
+        }
+        lists_[list].erase(ghost->second);
+        ghosts_.erase(ghost);
+        if (need_victim) {
+            victim = replace(list == kB2);
+        }
+        prepared_list_ = kT2;
+        return victim;
+    }
+
+    size_t t1 = lists_[kT1].size();
+    size_t l1 = t1 + lists_[kB1].size();
+    size_t total = l1 + lists_[kT2].size() + lists_[kB2].size();
+    if (l1 >= frames_) {
+        if (t1 < frames_) {
+            dropGhost(kB1);
+            if (need_victim) {
+                victim = replace(false);
+            }
+        } else if (need_victim) {
+            // T1占满全部页框：直接淘汰其LRU页，不留历史
+            victim = lists_[kT1].front().frame;
+            lists_[kT1].pop_front();
+        }
+    } else if (total >= frames_) {
+        if (total >= 2 * frames_) {
+            dropGhost(kB2);
+        }
+        if (need_victim) {
+            victim = replace(false);
+        }
+    }
+    if (need_victim && victim < 0) {
+        victim = replace(false);
+    }
+    prepared_list_ = kT1;
+    return victim;
+}
+
+// 从T1或T2的LRU端换出一页，页面键记入对应的历史链表
+int ArcPolicy::replace(bool incoming_in_b2) {
+    size_t t1 = lists_[kT1].size();
+    int from = kT2;
+    int to = kB2;
+    if (t1 > 0 && (lists_[kT2].empty() || t1 > target_ || (incoming_in_b2 && t1 == target_))) {
+        from = kT1;
+        to = kB1;
+    }
+
+    auto node = lists_[from].begin();
+    int victim = node->frame;
+    frame_keys_[victim] = kNoPage;
+    node->frame = -1;
+    node->list = to;
+    lists_[to].splice(lists_[to].end(), lists_[from], node);
+    ghosts_[node->key] = node;
+    return victim;
+}
+
+// 丢弃历史链表中最旧的记录
+void ArcPolicy::dropGhost(int list) {
+    if (!lists_[list].empty()) {
+        ghosts_.erase(lists_[list].front().key);
+        lists_[list].pop_front();
+    }
+}
+
+// ==================== 2Q ====================
+
+// 构造函数
+TwoQueuePolicy::TwoQueuePolicy(size_t frames)
+    : PageReplacementPolicy(frames), frame_nodes_(frames), frame_list_(frames, kA1in),
+      in_limit_(std::max<size_t>(frames / 4, 1)), out_limit_(std::max<size_t>(frames / 2, 1)) {}
+
+// 页面调入页框：在A1out中有记录的进入Am，否则进入A1in
+void TwoQueuePolicy::onLoad(int frame, long long key) {
+    int list = kA1in;
+    auto ghost = a1out_index_.find(key);
+    if (ghost != a1out_index_.end()) {
+        a1out_.erase(ghost->second);
+        a1out_index_.erase(ghost);
+        list = kAm;
+    }
+    frame_nodes_[frame] = resident_[list].insert(resident_[list].end(), frame);
+    frame_list_[frame] = list;
+    frame_keys_[frame] = key;
+}
+
+// 驻留页面被访问：Am中的页移到MRU端，A1in中的页不动
+void TwoQueuePolicy::onHit(int frame, bool is_write) {
+    (void)is_write;
+    if (frame_list_[frame] == kAm) {
+        resident_[kAm].splice(resident_[kAm].end(), resident_[kAm], frame_nodes_[frame]);
+    }
+}
+
+// 选出牺牲页框：A1in超过目标时淘汰其表头并记入A1out，否则淘汰Am的LRU页
+int TwoQueuePolicy::evict(long long incoming) {
+    (void)incoming;
+    int victim;
+    if (resident_[kA1in].size() > in_limit_ || resident_[kAm].empty()) {
+        victim = resident_[kA1in].front();
+        resident_[kA1in].pop_front();
+        long long key = frame_keys_[victim];
+        a1out_index_[key] = a1out_.insert(a1out_.end(), key);
+        if (a1out_.size() > out_limit_) {
+            a1out_index_.erase(a1out_.front());
+            a1out_.pop_front();
+        }
+    } else {
+        victim = resident_[kAm].front();
+        resident_[kAm].pop_front();
+    }
+    frame_keys_[victim] = kNoPage;
+    return victim;
+}
+
+// 页框被直接收回
+void TwoQueuePolicy::onRemove(int frame) {
+    resident_[frame_list_[frame]].erase(frame_nodes_[frame]);
+    frame_keys_[frame] = kNoPage;
+}
+
+// ==================== LIRS ====================
+
+// 构造函数：约1%的页框轮换HIR页，至少一个
+LirsPolicy::LirsPolicy(size_t frames)
+    : PageReplacementPolicy(frames), lir_count_(0) {
+    size_t hir = std::max<size_t>(frames / 100, 1);
+    lir_limit_ = frames > hir ? frames - hir : 1;
+}
+
+// 页面调入页框
+void LirsPolicy::onLoad(int frame, long long key) {
+    frame_keys_[frame] = key;
+    auto found = blocks_.find(key);
+    if (found != blocks_.end()) {
+        // 非驻留HIR页仍在栈中：重用距离小于栈底LIR页，升级为LIR
+        Block& block = found->second;
+        ghosts_.erase(block.ghost_pos);
+        block.frame = frame;
+        stack_.splice(stack_.end(), stack_, block.stack_pos);
+        promote(block);
+    } else {
+        Block& block = blocks_[key];
+        block.frame = frame;
+        block.lir = false;
+        block.in_stack = false;
+        block.in_queue = false;
+        pushStack(key, block);
+        // 预热阶段LIR页不足，新页面直接成为LIR
+        if (lir_count_ < lir_limit_) {
+            block.lir = true;
+            lir_count_++;
+        } else {
+            pushQueue(key, block);
+        }
+    }
+    trimGhosts();
+}
+
+// 驻留页面被访问
+void LirsPolicy::onHit(int frame, bool is_write) {
+    (void)is_write;
+    long long key = frame_keys_[frame];
+    Block& block = blocks_.find(key)->second;
+    if (block.lir) {
+        bool at_bottom = stack_.front() == key;
+        stack_.splice(stack_.end(), stack_, block.stack_pos);
+        if (at_bottom) {
+            prune();
+        }
+    } else if (block.in_stack) {
+        stack_.splice(stack_.end(), stack_, block.stack_pos);
+        promote(block);
+    } else {
+        pushStack(key, block);
+        queue_.splice(queue_.end(), queue_, block.queue_pos);
+    }
+}
+
+// 选出牺牲页框：淘汰Q的表头；Q为空时（只在页框极少或进程释放后出现）淘汰栈底LIR页
+int LirsPolicy::evict(long long incoming) {
+    (void)incoming;
+    long long key;
+    if (!queue_.empty()) {
+        key = queue_.front();
+        removeFromQueue(blocks_.find(key)->second);
+    } else {
+        key = stack_.front();
+        Block& bottom = blocks_.find(key)->second;
+        bottom.lir = false;
+        lir_count_--;
+    }
+
+    auto found = blocks_.find(key);
+    Block& block = found->second;
+    int victim = block.frame;
+    frame_keys_[victim] = kNoPage;
+    if (block.in_stack) {
+        block.frame = -1;
+        block.ghost_pos = ghosts_.insert(ghosts_.end(), key);
+        prune();
+    } else {
+        blocks_.erase(found);
+    }
+    return victim;
+}
+
+// 页框被直接收回
+void LirsPolicy::onRemove(int frame) {
+    long long key = frame_keys_[frame];
+    auto found = blocks_.find(key);
+    Block& block = found->second;
+    if (block.lir) {
+        lir_count_--;
+    }
+    if (block.in_stack) {
+        removeFromStack(block);
+    }
+    if (block.in_queue) {
+        removeFromQueue(block);
+    }
+    blocks_.erase(found);
+    frame_keys_[frame] = kNoPage;
+    prune();
+}
+
+// 压入栈顶
+void LirsPolicy::pushStack(long long key, Block& block) {
+    block.stack_pos = stack_.insert(stack_.end(), key);
+    block.in_stack = true;
+}
+
+// 加入队尾
+void LirsPolicy::pushQueue(long long key, Block& block) {
+    block.queue_pos = queue_.insert(queue_.end(), key);
+    block.in_queue = true;
+}
+
+// 移出栈
+void LirsPolicy::removeFromStack(Block& block) {
+    stack_.erase(block.stack_pos);
+    block.in_stack = false;
+}
+
+// 移出队列
+void LirsPolicy::removeFromQueue(Block& block) {
+    queue_.erase(block.queue_pos);
+    block.in_queue = false;
+}
+
+// 把已在栈顶的HIR页升级为LIR，LIR页超出上限时把栈底LIR页降为驻留HIR页
+void LirsPolicy::promote(Block& block) {
+    block.lir = true;
+    lir_count_++;
+    if (block.in_queue) {
+        removeFromQueue(block);
+    }
+    if (lir_count_ > lir_limit_) {
+        long long bottom_key = stack_.front();
+        Block& bottom = blocks_.find(bottom_key)->second;
+        bottom.lir = false;
+        lir_count_--;
+        removeFromStack(bottom);
+        pushQueue(bottom_key, bottom);
+        prune();
+    }
+}
+
+// 栈剪枝：移除栈底的HIR页直到栈底为LIR页，非驻留的HIR页同时被遗忘
+void LirsPolicy::prune() {
+    while (!stack_.empty()) {
+        long long key = stack_.front();
+        auto found = blocks_.find(key);
+        Block& block = found->second;
+        if (block.lir) {
+            break;
+        }
+        removeFromStack(block);
+        if (block.frame < 0) {
+            ghosts_.erase(block.ghost_pos);
+            blocks_.erase(found);
+        }
+    }
+}
+
+// 限制栈中非驻留HIR页的数量
+void LirsPolicy::trimGhosts() {
+    while (ghosts_.size() > 2 * frames_) {
+        long long key = ghosts_.front();
+        ghosts_.pop_front();
+        auto found = blocks_.find(key);
+        removeFromStack(found->second);
+        blocks_.erase(found);
+    }
+}
+
+// ==================== CLOCK-Pro ====================
+
+// 构造函数：冷页目标从一个页框开始，随测试页的结果自适应
+ClockProPolicy::ClockProPolicy(size_t frames)
+    : PageReplacementPolicy(frames), frame_pos_(frames), frame_type_(frames, kCold), referenced_(frames, 0),
+      cold_target_(1), prepared_(kNoPage), prepared_hot_(false), hand_steps_(0), hot_steps_(0) {}
+
+// 页面调入页框：测试期内再次缺页的页面以热页调入，否则以冷页调入
+void ClockProPolicy::onLoad(int frame, long long key) {
+    bool hot = (key != kNoPage && prepared_ == key) ? prepared_hot_ : takeTest(key);
+    prepared_ = kNoPage;
+    // 预热阶段热页不足，新页面直接成为热页
+    if (hot_.size() + cold_target_ < frames_) {
+        hot = true;
+    }
+    std::list<int>& clock = hot ? hot_ : cold_;
+    frame_pos_[frame] = clock.insert(clock.end(), frame);
+    frame_type_[frame] = hot ? kHot : kCold;
+    referenced_[frame] = 0;
+    frame_keys_[frame] = key;
+}
+
+// 驻留页面被访问：只设置访问位
+void ClockProPolicy::onHit(int frame, bool is_write) {
+    (void)is_write;
+    referenced_[frame] = 1;
+}
+
+// 选出牺牲页框：转动HAND_cold直到淘汰一个冷页
+int ClockProPolicy::evict(long long incoming) {
+    prepared_hot_ = incoming != kNoPage && takeTest(incoming);
+    prepared_ = incoming;
+    while (true) {
+        if (cold_.empty()) {
+            runHandHot();
+            continue;
+        }
+        int victim = runHandCold();
+        if (victim >= 0) {
+            return victim;
+        }
+        while (!hot_.empty() && hot_.size() > frames_ - cold_target_) {
+            runHandHot();
+        }
+    }
+}
+
+// 页框被直接收回
+void ClockProPolicy::onRemove(int frame) {
+    std::list<int>& clock = frame_type_[frame] == kHot ? hot_ : cold_;
+    clock.erase(frame_pos_[frame]);
+    frame_keys_[frame] = kNoPage;
+}
+
+// 页面若是测试页则结束其测试并增大冷页目标
+bool ClockProPolicy::takeTest(long long key) {
+    auto test = test_index_.find(key);
+    if (test == test_index_.end()) {
+        return false;
+    }
+    if (cold_target_ < frames_) {
+        cold_target_++;
+    }
+    tests_.erase(test->second);
+    test_index_.erase(test);
+    return true;
+}
+
+// HAND_cold：访问过的冷页升为热页，未访问的冷页被淘汰并保留为测试页
+int ClockProPolicy::runHandCold() {
+    hand_steps_++;
+    int frame = cold_.front();
+    cold_.pop_front();
+    if (referenced_[frame]) {
+        referenced_[frame] = 0;
+        frame_type_[frame] = kHot;
+        frame_pos_[frame] = hot_.insert(hot_.end(), frame);
+        return -1;
+    }
+
+    long long key = frame_keys_[frame];
+    frame_keys_[frame] = kNoPage;
+    if (key != kNoPage) {
+        test_index_[key] = tests_.insert(tests_.end(), std::make_pair(key, hot_steps_));
+        expireTests();
+    }
+    return frame;
+}
+
+// HAND_hot：清除热页的访问位，未访问的热页降为冷页
+void ClockProPolicy::runHandHot() {
+    hand_steps_++;
+    hot_steps_++;
+    int frame = hot_.front();
+    if (referenced_[frame]) {
+        referenced_[frame] = 0;
+        hot_.splice(hot_.end(), hot_, hot_.begin());
+    } else {
+        hot_.pop_front();
+        frame_type_[frame] = kCold;
+        frame_pos_[frame] = cold_.insert(cold_.end(), frame);
+    }
+    expireTests();
+}
+
+// 测试页不超过页框数；HAND_hot转过一整圈后测试期结束，冷页目标减小
+void ClockProPolicy::expireTests() {
+    while (!tests_.empty() && (tests_.size() > frames_
+                               || hot_steps_ - tests_.front().second > static_cast<long long>(hot_.size()))) {
+        test_index_.erase(tests_.front().first);
+        tests_.pop_front();
+        if (cold_target_ > 1) {
+            cold_target_--;
+        }
+    }
+}
+
+// ==================== WSClock ====================
+
+// 构造函数
+WsClockPolicy::WsClockPolicy(size_t frames, long long window)
+    : PageReplacementPolicy(frames), referenced_(frames, 0), dirty_(frames, 0), resident_(frames, 0),
+      last_use_(frames, 0), window_(window > 0 ? window : static_cast<long long>(2 * frames)),
+      now_(0), write_backs_(0), hand_(0) {}
+
+// 页面调入页框
+void WsClockPolicy::onLoad(int frame, long long key) {
+    now_++;
+    resident_[frame] = 1;
+    referenced_[frame] = 1;
+    dirty_[frame] = 0;
+    last_use_[frame] = now_;
+    frame_keys_[frame] = key;
+}
+
+// 驻留页面被访问
+void WsClockPolicy::onHit(int frame, bool is_write) {
+    now_++;
+    referenced_[frame] = 1;
+    if (is_write) {
+        dirty_[frame] = 1;
+    }
+}
+
+// 选出牺牲页框：最多转一整圈
+int WsClockPolicy::evict(long long incoming) {
+    (void)incoming;
+    int first_written = -1;
+    int oldest = -1;
+    for (size_t step = 0; step < frames_; ++step) {
+        int frame = static_cast<int>(hand_);
+        hand_ = hand_ + 1 < frames_ ? hand_ + 1 : 0;
+        if (!resident_[frame]) {
+            continue;
+        }
+        if (referenced_[frame]) {
+            referenced_[frame] = 0;
+            last_use_[frame] = now_;
+            continue;
+        }
+        if (now_ - last_use_[frame] > window_) {
+            if (!dirty_[frame]) {
+                resident_[frame] = 0;
+                frame_keys_[frame] = kNoPage;
+                return frame;
+            }
+            // 离开工作集的脏页：安排写回，写回完成后即可淘汰
+            dirty_[frame] = 0;
+            write_backs_++;
+            if (first_written < 0) {
+                first_written = frame;
+            }
+        }
+        if (oldest < 0 || last_use_[frame] < last_use_[oldest]) {
+            oldest = frame;
+        }
+    }
+
+    // 转完一圈：优先淘汰最先安排写回的页，否则所有页都在工作集内，淘汰最久未用的页
+    int victim = first_written >= 0 ? first_written : oldest;
+    if (victim < 0) {
+        victim = static_cast<int>(hand_);
+    }
+    resident_[victim] = 0;
+    frame_keys_[victim] = kNoPage;
+    return victim;
+}
+
+// 页框被直接收回
+void WsClockPolicy::onRemove(int frame) {
+    resident_[frame] = 0;
+    referenced_[frame] = 0;
+    dirty_[frame] = 0;
+    frame_keys_[frame] = kNoPage;
+}
+
+} // namespace ZTS_OS
@@ -0,0 +1,213 @@
+#include "../../include/memory/PageTraceAnalyzer.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include <utility>
+
+/**
+ * @file PageTraceAnalyzer.cpp
+ * @brief 页面访问序列离线分析实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+/// SHARDS抽样用的哈希空间大小
+constexpr uint64_t kSampleModulus = 1ULL << 24;
+
+// 页面号的哈希（splitmix64的混合函数），使抽样与页面号的分布无关
+uint64_t hashPage(int page) {
+    uint64_t x = static_cast<uint64_t>(static_cast<uint32_t>(page)) + 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @struct StackDistanceHistogram
+ * @brief 栈距离直方图
+ */
+struct StackDistanceHistogram {
+    std::vector<long long> counts;  ///< counts[d]为栈距离为d的访问次数
+    long long cold_misses = 0;      ///< 首次访问（栈距离无穷大）次数
+};
+
+// 在访问序列上求栈距离直方图
+StackDistanceHistogram buildHistogram(const std::vector<int>& trace) {
+    StackDistanceHistogram histogram;
+    histogram.counts.push_back(0);
+    // 树状数组：位置i记1表示trace[i]是该页面最近一次访问
+    std::vector<int> tree(trace.size() + 1, 0);
+    auto add = [&tree](size_t position, int delta) {
+        for (size_t i = position + 1; i < tree.size(); i += i & (~i + 1)) {
+            tree[i] += delta;
+        }
+    };
+    auto prefix = [&tree](size_t count) {
+        long long sum = 0;
+        for (size_t i = count; i > 0; i -= i & (~i + 1)) {
+            sum += tree[i];
+        }
+        return sum;
+    };
+
+    std::unordered_map<int, size_t> last_access;
+    long long distinct = 0;
+    for (size_t i = 0; i < trace.size(); ++i) {
+        auto found = last_access.find(trace[i]);
+        if (found == last_access.end()) {
+            histogram.cold_misses++;
+            distinct++;
+            last_access.emplace(trace[i], i);
+        } else {
+            // 上次访问之后出现过的不同页面数 + 自身
+            long long distance = distinct - prefix(found->second + 1) + 1;
+            if (static_cast<size_t>(distance) >= histogram.counts.size()) {
+                histogram.counts.resize(distance + 1, 0);
+            }
+            histogram.counts[distance]++;
+            add(found->second, -1);
+            found->second = i;
+        }
+        add(i, 1);
+    }
+    histogram.counts.resize(distinct + 1, 0);
+    return histogram;
+}
+
+// 由直方图得到各页框数的缺页次数：距离超过页框数的访问都缺页
+std::vector<long long> buildFaultCurve(const StackDistanceHistogram& histogram) {
+    std::vector<long long> faults(histogram.counts.size(), 0);
+    long long misses = histogram.cold_misses;
+    for (size_t frames = faults.size(); frames-- > 0;) {
+        faults[frames] = misses;
+        misses += histogram.counts[frames];
+    }
+    return faults;
+}
+
+} // namespace
+
+// 计算每次访问的下一次使用位置
+std::vector<size_t> PageTraceAnalyzer::computeNextUse(const std::vector<int>& trace) {
+    std::vector<size_t> next_use(trace.size(), kNeverUsed);
+    std::unordered_map<int, size_t> later;
+    for (size_t i = trace.size(); i-- > 0;) {
+        auto found = later.find(trace[i]);
+        if (found != later.end()) {
+            next_use[i] = found->second;
+            found->second = i;
+        } else {
+            later.emplace(trace[i], i);
+        }
+    }
+    return next_use;
+}
+
+// 计算OPT的缺页次数
+long long PageTraceAnalyzer::countOptimalFaults(const std::vector<int>& trace, size_t frames) {
+    if (frames == 0) {
+        throw std::invalid_argument("页框数必须大于0");
+    }
+
+    std::vector<size_t> next_use = computeNextUse(trace);
+
+    // 驻留页面 -> 其下一次使用位置；堆中(位置, 页面)与之一致的记录才有效
+    std::unordered_map<int, size_t> resident;
+    resident.reserve(frames * 2);
+    std::vector<std::pair<size_t, int>> heap;
+    heap.reserve(frames * 2 + 1);
+    long long faults = 0;
+
+    for (size_t i = 0; i < trace.size(); ++i) {
+        int page = trace[i];
+        auto found = resident.find(page);
+        if (found != resident.end()) {
+            found->second = next_use[i];
+        } else {
+            faults++;
+            if (resident.size() == frames) {
+                // 弹出下一次使用最远的有效记录
+                while (true) {
+                    std::pop_heap(heap.begin(), heap.end());
+                    std::pair<size_t, int> top = heap.back();
+                    heap.pop_back();
+                    auto victim = resident.find(top.second);
+                    if (victim != resident.end() && victim->second == top.first) {
+                        resident.erase(victim);
+                        break;
+                    }
+                }
+            }
+            resident.emplace(page, next_use[i]);
+        }
+
+        heap.emplace_back(next_use[i], page);
+        std::push_heap(heap.begin(), heap.end());
+        if (heap.size() > frames * 2) {
+            heap.clear();
+            for (const auto& entry : resident) {
+                heap.emplace_back(entry.second, entry.first);
+            }
+            std::make_heap(heap.begin(), heap.end());
+        }
+    }
+    return faults;
+}
+
+// 计算LRU在所有页框数下的缺页次数
+std::vector<long long> PageTraceAnalyzer::computeLruFaultCurve(const std::vector<int>& trace) {
+    return buildFaultCurve(buildHistogram(trace));
+}
+
+// 抽样近似计算LRU缺页曲线
+std::vector<long long> PageTraceAnalyzer::estimateLruFaultCurve(const std::vector<int>& trace,
+                                                                double sampling_rate) {
+    if (!(sampling_rate > 0.0 && sampling_rate <= 1.0)) {
+        throw std::invalid_argument("抽样比例必须在(0, 1]之间");
+    }
+
+    uint64_t threshold = static_cast<uint64_t>(std::llround(sampling_rate * kSampleModulus));
+    std::vector<int> sampled;
+    for (int page : trace) {
+        if (hashPage(page) % kSampleModulus < threshold) {
+            sampled.push_back(page);
+        }
+    }
+    StackDistanceHistogram histogram = buildHistogram(sampled);
+
+    // 子序列中的距离d对应原序列中约d/R，次数同样放大1/R
+    double scale = 1.0 / sampling_rate;
+    StackDistanceHistogram scaled;
+    scaled.cold_misses = std::llround(histogram.cold_misses * scale);
+    scaled.counts.assign(static_cast<size_t>(std::llround((histogram.counts.size() - 1) * scale)) + 1, 0);
+    for (size_t distance = 1; distance < histogram.counts.size(); ++distance) {
+        size_t bucket = std::min(scaled.counts.size() - 1, static_cast<size_t>(std::llround(distance * scale)));
+        scaled.counts[bucket] += std::llround(histogram.counts[distance] * scale);
+    }
+    // 少数热点页是否被抽中会让抽中的访问数偏离n*R，差额计入最小的距离（SHARDS_adj）
+    if (scaled.counts.size() > 1) {
+        long long total = scaled.cold_misses;
+        for (long long count : scaled.counts) {
+            total += count;
+        }
+        size_t first = std::min(scaled.counts.size() - 1, static_cast<size_t>(std::llround(scale)));
+        scaled.counts[first] += static_cast<long long>(trace.size()) - total;
+    }
+
+    // 页框数小于1/R时抽样分辨不出，估计值限制在[0, n]内，0个页框时每次访问都缺页
+    std::vector<long long> faults = buildFaultCurve(scaled);
+    long long references = static_cast<long long>(trace.size());
+    for (long long& count : faults) {
+        count = std::max(0LL, std::min(count, references));
+    }
+    faults[0] = references;
+    return faults;
+}
+
+} // namespace ZTS_OS
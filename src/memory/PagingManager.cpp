@@ -0,0 +1,466 @@
+#include "../../include/memory/PagingManager.h"
+#include <algorithm>
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * @file PagingManager.cpp
+ * @brief 分页内存管理器实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+constexpr int kBitsPerWord = 64;
+constexpr long long kUnknownCount = -1;  // 最小访问次数需要重新计算
+
+// 最低置位的下标（value不为0）
+int lowestBit64(uint64_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctzll(value);
+#endif
+}
+
+// 从bit位开始（含）到字尾的掩码
+uint64_t maskFrom(int bit) {
+    return ~static_cast<uint64_t>(0) << bit;
+}
+
+// 低count位的掩码
+uint64_t maskBelow(int count) {
+    return count >= kBitsPerWord ? ~static_cast<uint64_t>(0)
+                                 : (static_cast<uint64_t>(1) << count) - 1;
+}
+
+} // namespace
+
+// 构造函数
+PagingManager::PagingManager(size_t total_memory, size_t page_size,
+                             PageReplacementAlgorithm replacement_algorithm)
+    : total_memory_(total_memory), page_size_(page_size), total_frames_(0),
+      replacement_algorithm_(replacement_algorithm), lfu_min_count_(kUnknownCount), clock_pointer_(0),
+      page_fault_count_(0), access_count_(0), current_time_(0) {
+    if (page_size == 0 || total_memory < page_size) {
+        throw std::invalid_argument("页面大小必须为正数且不超过总内存大小");
+    }
+
+    total_frames_ = total_memory / page_size;
+    page_frames_.reserve(total_frames_);
+    for (size_t i = 0; i < total_frames_; ++i) {
+        page_frames_.emplace_back(static_cast<int>(i));
+        free_frames_.push(static_cast<int>(i));
+    }
+    lru_position_.resize(total_frames_);
+    lfu_position_.resize(total_frames_);
+    reference_bits_.assign((total_frames_ + kBitsPerWord - 1) / kBitsPerWord, 0);
+    policy_ = PageReplacementPolicy::create(replacement_algorithm, total_frames_);
+}
+
+// 分配页面给进程
+bool PagingManager::allocatePages(int process_id, size_t pages_needed) {
+    if (pages_needed == 0) {
+        return false;
+    }
+    std::vector<PageTableEntry>& table = page_tables_[process_id];
+    table.resize(table.size() + pages_needed);
+    for (size_t page = table.size() - pages_needed; page < table.size(); ++page) {
+        table[page].valid = true;
+    }
+    return true;
+}
+
+// 释放进程的所有页面
+int PagingManager::deallocatePages(int process_id) {
+    auto owner = page_tables_.find(process_id);
+    if (owner == page_tables_.end()) {
+        return 0;
+    }
+
+    for (auto& entry : owner->second) {
+        if (entry.present) {
+            int frame = entry.frame_number;
+            evictFrame(frame);
+            free_frames_.push(frame);
+        }
+    }
+    int released = static_cast<int>(owner->second.size());
+    page_tables_.erase(owner);
+    return released;
+}
+
+// 访问页面（地址转换）
+int PagingManager::accessPage(int process_id, size_t virtual_address, bool is_write) {
+    PageTableEntry& entry = pageEntry(process_id, virtual_address / page_size_);
+    access_count_++;
+    if (!entry.present) {
+        page_fault_count_++;
+        return -1;
+    }
+
+    entry.referenced = true;
+    if (is_write) {
+        entry.modified = true;
+    }
+    updatePageAccess(entry.frame_number, is_write);
+    return static_cast<int>(entry.frame_number * page_size_ + virtual_address % page_size_);
+}
+
+// 处理页错误
+int PagingManager::handlePageFault(int process_id, int page_number) {
+    if (page_number < 0) {
+        throw std::invalid_argument("页号不能为负数");
+    }
+    PageTableEntry& entry = pageEntry(process_id, static_cast<size_t>(page_number));
+    if (entry.present) {
+        return entry.frame_number;
+    }
+
+    int frame = -1;
+    if (!free_frames_.empty()) {
+        frame = free_frames_.front();
+        free_frames_.pop();
+    } else {
+        frame = replacePage(pageKey(process_id, page_number));
+        if (frame < 0) {
+            return -1;
+        }
+    }
+
+    // 调入页面，引起缺页的这次访问算作第一次访问
+    PageFrame& loaded = page_frames_[frame];
+    loaded.is_free = false;
+    loaded.process_id = process_id;
+    loaded.page_number = page_number;
+    loaded.load_time = ++current_time_;
+    loaded.access_time = current_time_;
+    loaded.access_count = 1;
+    reference_bits_[frame / kBitsPerWord] |= static_cast<uint64_t>(1) << (frame % kBitsPerWord);
+
+    entry.frame_number = frame;
+    entry.present = true;
+    entry.referenced = true;
+    entry.modified = false;
+    trackFrame(frame);
+    return frame;
+}
+
+// 页面置换
+int PagingManager::replaceePage() {
+    // 还有空闲页框时不需要置换，各算法的簿记中也只有已占用的页框
+    if (!free_frames_.empty()) {
+        return -1;
+    }
+    int victim = replacePage(PageReplacementPolicy::kNoPage);
+    if (victim >= 0) {
+        free_frames_.push(victim);
+    }
+    return victim;
+}
+
+// 按当前算法选出牺牲页框并换出
+int PagingManager::replacePage(long long incoming) {
+    if (free_frames_.size() == total_frames_) {
+        return -1;
+    }
+
+    // 带历史的策略在选出牺牲页框时已经更新了自己的簿记
+    if (policy_) {
+        int victim = policy_->evict(incoming);
+        releaseFrame(victim);
+        return victim;
+    }
+
+    int victim = -1;
+    switch (replacement_algorithm_) {
+        case PageReplacementAlgorithm::FIFO:
+            victim = fifoReplacement();
+            break;
+        case PageReplacementAlgorithm::LRU:
+            victim = lruReplacement();
+            break;
+        case PageReplacementAlgorithm::LFU:
+            victim = lfuReplacement();
+            break;
+        case PageReplacementAlgorithm::CLOCK:
+            victim = clockReplacement();
+            break;
+        default:
+            break;
+    }
+    evictFrame(victim);
+    return victim;
+}
+
+// 设置页面置换算法
+void PagingManager::setReplacementAlgorithm(PageReplacementAlgorithm algorithm) {
+    // 先按旧算法清空簿记，再按新算法依调入或访问的先后重新加入
+    std::vector<int> resident;
+    for (const auto& frame : page_frames_) {
+        if (!frame.is_free) {
+            untrackFrame(frame.frame_number);
+            resident.push_back(frame.frame_number);
+        }
+    }
+    replacement_algorithm_ = algorithm;
+    policy_ = PageReplacementPolicy::create(algorithm, total_frames_);
+
+    bool by_load = algorithm == PageReplacementAlgorithm::FIFO;
+    std::sort(resident.begin(), resident.end(), [this, by_load](int a, int b) {
+        return by_load ? page_frames_[a].load_time < page_frames_[b].load_time
+                       : page_frames_[a].access_time < page_frames_[b].access_time;
+    });
+    for (int frame : resident) {
+        trackFrame(frame);
+    }
+}
+
+// 获取内存使用率
+double PagingManager::getMemoryUtilization() const {
+    return static_cast<double>(total_frames_ - free_frames_.size()) / total_frames_ * 100.0;
+}
+
+// 获取缺页率
+double PagingManager::getPageFaultRate() const {
+    if (access_count_ == 0) return 0.0;
+    return static_cast<double>(page_fault_count_) / access_count_ * 100.0;
+}
+
+// 显示内存状态
+void PagingManager::displayMemoryStatus() const {
+    std::cout << "\n📊 分页内存状态：" << std::endl;
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
+    std::cout << "总内存大小: " << total_memory_ << " KB，页面大小: " << page_size_ << " KB" << std::endl;
+    std::cout << "页框: " << total_frames_ - free_frames_.size() << " / " << total_frames_
+              << " 已占用 (" << std::fixed << std::setprecision(1) << getMemoryUtilization() << "%)" << std::endl;
+    std::cout << "进程页表数: " << page_tables_.size() << std::endl;
+    std::cout << "访问次数: " << access_count_ << "，页错误: " << page_fault_count_
+              << "，缺页率: " << std::fixed << std::setprecision(2) << getPageFaultRate() << "%" << std::endl;
+}
+
+// 显示页表
+void PagingManager::displayPageTable(int process_id) const {
+    auto owner = page_tables_.find(process_id);
+    if (owner == page_tables_.end()) {
+        std::cout << "❌ 进程 " << process_id << " 没有页表" << std::endl;
+        return;
+    }
+
+    std::cout << "\n📄 进程 " << process_id << " 的页表：" << std::endl;
+    std::cout << "┌────────┬────────┬────────┬────────┬────────┐" << std::endl;
+    std::cout << "│  页号  │ 页框号 │ 在内存 │ 访问位 │ 修改位 │" << std::endl;
+    std::cout << "├────────┼────────┼────────┼────────┼────────┤" << std::endl;
+    const auto& table = owner->second;
+    for (size_t page = 0; page < table.size(); ++page) {
+        const PageTableEntry& entry = table[page];
+        std::cout << "│ " << std::setw(6) << page
+                  << " │ " << std::setw(6) << (entry.present ? std::to_string(entry.frame_number) : "-")
+                  << " │ " << std::setw(6) << (entry.present ? 1 : 0)
+                  << " │ " << std::setw(6) << (entry.referenced ? 1 : 0)
+                  << " │ " << std::setw(6) << (entry.modified ? 1 : 0)
+                  << " │" << std::endl;
+    }
+    std::cout << "└────────┴────────┴────────┴────────┴────────┘" << std::endl;
+}
+
+// 显示页框状态
+void PagingManager::displayPageFrames() const {
+    std::cout << "\n🗂️ 页框状态：" << std::endl;
+    std::cout << "┌────────┬────────┬────────┬────────┬──────────┬──────────┬────────┐" << std::endl;
+    std::cout << "│ 页框号 │  进程  │  页号  │ 引用位 │ 调入时间 │ 访问时间 │ 访问数 │" << std::endl;
+    std::cout << "├────────┼────────┼────────┼────────┼──────────┼──────────┼────────┤" << std::endl;
+    for (const auto& frame : page_frames_) {
+        std::cout << "│ " << std::setw(6) << frame.frame_number;
+        if (frame.is_free) {
+            std::cout << " │ " << std::setw(6) << "空闲" << "   │ " << std::setw(6) << "-"
+                      << " │ " << std::setw(6) << "-" << " │ " << std::setw(8) << "-"
+                      << " │ " << std::setw(8) << "-" << " │ " << std::setw(6) << "-";
+        } else {
+            std::cout << " │ " << std::setw(6) << frame.process_id
+                      << " │ " << std::setw(6) << frame.page_number
+                      << " │ " << std::setw(6) << (getReferenceBit(frame.frame_number) ? 1 : 0)
+                      << " │ " << std::setw(8) << frame.load_time
+                      << " │ " << std::setw(8) << frame.access_time
+                      << " │ " << std::setw(6) << frame.access_count;
+        }
+        std::cout << " │" << std::endl;
+    }
+    std::cout << "└────────┴────────┴────────┴────────┴──────────┴──────────┴────────┘" << std::endl;
+}
+
+// FIFO页面置换：淘汰最早调入的页框
+int PagingManager::fifoReplacement() {
+    return lru_list_.front();
+}
+
+// LRU页面置换：淘汰最久未访问的页框
+int PagingManager::lruReplacement() {
+    return lru_list_.front();
+}
+
+// LFU页面置换：淘汰访问次数最少的页框，次数相同时淘汰最早进入该桶的
+int PagingManager::lfuReplacement() {
+    // 最小桶被释放进程清空后才需要遍历各桶；缺页调入总会把最小次数重置为1
+    if (lfu_min_count_ == kUnknownCount) {
+        for (const auto& bucket : lfu_buckets_) {
+            if (lfu_min_count_ == kUnknownCount || bucket.first < lfu_min_count_) {
+                lfu_min_count_ = bucket.first;
+            }
+        }
+    }
+    return lfu_buckets_[lfu_min_count_].front();
+}
+
+// 时钟页面置换：跳过引用位为1的页框并清除其引用位，淘汰第一个引用位为0的页框
+int PagingManager::clockReplacement() {
+    // 置换只在没有空闲页框时发生，此时所有页框都被占用，指针无需跳过空闲页框
+    const int frames = static_cast<int>(total_frames_);
+    while (true) {
+        int word = clock_pointer_ / kBitsPerWord;
+        int bit = clock_pointer_ % kBitsPerWord;
+        uint64_t range = maskFrom(bit) & maskBelow(frames - word * kBitsPerWord);
+        uint64_t unreferenced = ~reference_bits_[word] & range;
+        if (unreferenced != 0) {
+            int victim = word * kBitsPerWord + lowestBit64(unreferenced);
+            reference_bits_[word] &= ~(range & maskBelow(victim - word * kBitsPerWord));
+            clock_pointer_ = victim + 1 < frames ? victim + 1 : 0;
+            return victim;
+        }
+        // 整段都被访问过：给它们第二次机会，指针移到下一个字
+        reference_bits_[word] &= ~range;
+        clock_pointer_ = (word + 1) * kBitsPerWord < frames ? (word + 1) * kBitsPerWord : 0;
+    }
+}
+
+// 更新页面访问信息
+void PagingManager::updatePageAccess(int frame_number, bool is_write) {
+    PageFrame& frame = page_frames_[frame_number];
+    frame.access_time = ++current_time_;
+    frame.access_count++;
+    reference_bits_[frame_number / kBitsPerWord] |= static_cast<uint64_t>(1) << (frame_number % kBitsPerWord);
+
+    if (policy_) {
+        policy_->onHit(frame_number, is_write);
+        return;
+    }
+    switch (replacement_algorithm_) {
+        case PageReplacementAlgorithm::LRU:
+            lru_list_.splice(lru_list_.end(), lru_list_, lru_position_[frame_number]);
+            break;
+        case PageReplacementAlgorithm::LFU: {
+            // 从count-1桶移到count桶的表尾，splice不分配节点，迭代器保持有效
+            // 插入新桶可能重新散列，只保留对链表的引用
+            long long count = frame.access_count;
+            std::list<int>& from = lfu_buckets_.find(count - 1)->second;
+            std::list<int>& to = lfu_buckets_[count];
+            to.splice(to.end(), from, lfu_position_[frame_number]);
+            if (from.empty()) {
+                lfu_buckets_.erase(count - 1);
+                if (lfu_min_count_ == count - 1) {
+                    lfu_min_count_ = count;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// 把刚调入的页框加入当前算法的簿记
+void PagingManager::trackFrame(int frame_number) {
+    if (policy_) {
+        const PageFrame& frame = page_frames_[frame_number];
+        policy_->onLoad(frame_number, pageKey(frame.process_id, frame.page_number));
+        return;
+    }
+    switch (replacement_algorithm_) {
+        case PageReplacementAlgorithm::FIFO:
+        case PageReplacementAlgorithm::LRU:
+            lru_position_[frame_number] = lru_list_.insert(lru_list_.end(), frame_number);
+            break;
+        case PageReplacementAlgorithm::LFU: {
+            long long count = page_frames_[frame_number].access_count;
+            std::list<int>& bucket = lfu_buckets_[count];
+            lfu_position_[frame_number] = bucket.insert(bucket.end(), frame_number);
+            // 刚调入的页框访问次数为1，必然是最小值，缺页时不必重新计算
+            if (count == 1 || lfu_buckets_.size() == 1
+                || (lfu_min_count_ != kUnknownCount && count < lfu_min_count_)) {
+                lfu_min_count_ = count;
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// 把页框从当前算法的簿记中移除
+void PagingManager::untrackFrame(int frame_number) {
+    if (policy_) {
+        policy_->onRemove(frame_number);
+        return;
+    }
+    switch (replacement_algorithm_) {
+        case PageReplacementAlgorithm::FIFO:
+        case PageReplacementAlgorithm::LRU:
+            lru_list_.erase(lru_position_[frame_number]);
+            break;
+        case PageReplacementAlgorithm::LFU: {
+            long long count = page_frames_[frame_number].access_count;
+            auto bucket = lfu_buckets_.find(count);
+            bucket->second.erase(lfu_position_[frame_number]);
+            if (bucket->second.empty()) {
+                lfu_buckets_.erase(bucket);
+                if (lfu_min_count_ == count) {
+                    lfu_min_count_ = kUnknownCount;
+                }
+            }
+            break;
+        }
+        default:
+            break;
+    }
+}
+
+// 换出页框中的页面
+void PagingManager::evictFrame(int frame_number) {
+    untrackFrame(frame_number);
+    releaseFrame(frame_number);
+}
+
+// 更新页框中页面的页表项并清空页框
+void PagingManager::releaseFrame(int frame_number) {
+    reference_bits_[frame_number / kBitsPerWord] &= ~(static_cast<uint64_t>(1) << (frame_number % kBitsPerWord));
+    PageFrame& frame = page_frames_[frame_number];
+    PageTableEntry& entry = page_tables_[frame.process_id][frame.page_number];
+    entry.present = false;
+    entry.frame_number = -1;
+    page_frames_[frame_number] = PageFrame(frame_number);
+}
+
+// 查找进程的页表项
+PageTableEntry& PagingManager::pageEntry(int process_id, size_t page_number) {
+    auto owner = page_tables_.find(process_id);
+    if (owner == page_tables_.end()) {
+        throw std::invalid_argument("进程没有页表: " + std::to_string(process_id));
+    }
+    if (page_number >= owner->second.size() || !owner->second[page_number].valid) {
+        throw std::invalid_argument("访问越界: 进程 " + std::to_string(process_id)
+                                    + " 的页号 " + std::to_string(page_number));
+    }
+    return owner->second[page_number];
+}
+
+} // namespace ZTS_OS
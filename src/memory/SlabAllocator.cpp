@@ -0,0 +1,310 @@
+#include "../../include/memory/SlabAllocator.h"
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+/**
+ * @file SlabAllocator.cpp
+ * @brief 固定大小对象缓存（slab分配器）实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+constexpr int kFullList = 0;     // 全满
+constexpr int kPartialList = 1;  // 部分使用
+constexpr int kEmptyList = 2;    // 空
+constexpr int kAllocated = -2;   // 空闲链表中表示对象已分配
+
+} // namespace
+
+// 构造函数
+SlabAllocator::SlabAllocator(MemoryManager& page_source, size_t slab_size, size_t max_empty_slabs)
+    : page_source_(page_source), slab_size_(slab_size), slab_bytes_(slab_size * 1024),
+      max_empty_slabs_(max_empty_slabs), slab_count_(0), active_bytes_(0) {
+    if (slab_size == 0) {
+        throw std::invalid_argument("slab大小必须为正数");
+    }
+}
+
+// 创建对象缓存
+int SlabAllocator::createCache(const std::string& name, size_t object_size) {
+    if (object_size == 0 || object_size > slab_bytes_) {
+        throw std::invalid_argument("对象大小必须在1到slab大小之间");
+    }
+
+    Cache cache;
+    cache.name = name;
+    cache.object_size = object_size;
+    cache.objects_per_slab = slab_bytes_ / object_size;
+    for (int list = 0; list < 3; ++list) {
+        cache.lists[list] = -1;
+        cache.list_sizes[list] = 0;
+    }
+    cache.active_objects = 0;
+    cache.counters.name = name;
+    cache.counters.object_size = object_size;
+    cache.counters.objects_per_slab = cache.objects_per_slab;
+    caches_.push_back(cache);
+    return static_cast<int>(caches_.size()) - 1;
+}
+
+// 从缓存分配一个对象
+long long SlabAllocator::allocate(int cache) {
+    checkCache(cache);
+
+    int slab = caches_[cache].lists[kPartialList];
+    if (slab < 0) {
+        slab = caches_[cache].lists[kEmptyList];
+    }
+    if (slab < 0) {
+        slab = growCache(cache);
+        if (slab < 0) {
+            caches_[cache].counters.failures++;
+            return -1;
+        }
+    }
+
+    // 从slab内的空闲链表头取出对象
+    Cache& owner = caches_[cache];
+    Slab& current = slabs_[slab];
+    int index = current.free_head;
+    current.free_head = current.next[index];
+    current.next[index] = kAllocated;
+    current.in_use++;
+
+    int target = current.in_use == owner.objects_per_slab ? kFullList : kPartialList;
+    if (current.list != target) {
+        unlinkSlab(slab);
+        linkSlab(slab, target);
+    }
+
+    owner.active_objects++;
+    owner.counters.allocations++;
+    active_bytes_ += owner.object_size;
+    return static_cast<long long>(current.base * 1024 + index * owner.object_size);
+}
+
+// 释放对象
+void SlabAllocator::deallocate(long long address) {
+    if (address < 0) {
+        throw std::invalid_argument("无效的对象地址");
+    }
+    auto page = page_owner_.find(static_cast<size_t>(address) / 1024);
+    if (page == page_owner_.end()) {
+        throw std::invalid_argument("地址不属于任何slab");
+    }
+
+    int slab = page->second;
+    Slab& current = slabs_[slab];
+    Cache& owner = caches_[current.cache];
+    size_t offset = static_cast<size_t>(address) - current.base * 1024;
+    size_t index = offset / owner.object_size;
+    if (offset % owner.object_size != 0 || index >= owner.objects_per_slab) {
+        throw std::invalid_argument("地址不是对象的起始地址");
+    }
+    if (current.next[index] != kAllocated) {
+        throw std::invalid_argument("对象已经释放");
+    }
+
+    // 放回slab内空闲链表的表头
+    current.next[index] = current.free_head;
+    current.free_head = static_cast<int>(index);
+    current.in_use--;
+    owner.active_objects--;
+    owner.counters.frees++;
+    active_bytes_ -= owner.object_size;
+
+    int target = current.in_use == 0 ? kEmptyList : kPartialList;
+    if (current.list != target) {
+        unlinkSlab(slab);
+        linkSlab(slab, target);
+    }
+    if (target == kEmptyList && owner.list_sizes[kEmptyList] > max_empty_slabs_) {
+        destroySlab(slab);
+    }
+}
+
+// 按大小分配对象
+long long SlabAllocator::kmalloc(size_t size) {
+    if (size == 0) {
+        throw std::invalid_argument("kmalloc大小必须为正数");
+    }
+
+    size_t class_size = kMinKmallocSize;
+    size_t class_index = 0;
+    while (class_size < size) {
+        class_size *= 2;
+        class_index++;
+    }
+    if (class_size > slab_bytes_) {
+        throw std::invalid_argument("kmalloc大小超过slab大小");
+    }
+
+    if (class_index >= kmalloc_caches_.size()) {
+        kmalloc_caches_.resize(class_index + 1, -1);
+    }
+    if (kmalloc_caches_[class_index] < 0) {
+        kmalloc_caches_[class_index] = createCache("kmalloc-" + std::to_string(class_size), class_size);
+    }
+    return allocate(kmalloc_caches_[class_index]);
+}
+
+// 把空slab还给页面来源
+size_t SlabAllocator::shrink() {
+    size_t released = 0;
+    for (auto& cache : caches_) {
+        while (cache.lists[kEmptyList] >= 0) {
+            destroySlab(cache.lists[kEmptyList]);
+            released++;
+        }
+    }
+    return released;
+}
+
+// 获取缓存统计
+SlabCacheStats SlabAllocator::getCacheStats(int cache) const {
+    checkCache(cache);
+    const Cache& owner = caches_[cache];
+    SlabCacheStats stats = owner.counters;
+    stats.full_slabs = owner.list_sizes[kFullList];
+    stats.partial_slabs = owner.list_sizes[kPartialList];
+    stats.empty_slabs = owner.list_sizes[kEmptyList];
+    size_t slabs = stats.full_slabs + stats.partial_slabs + stats.empty_slabs;
+    stats.active_objects = owner.active_objects;
+    stats.total_objects = slabs * owner.objects_per_slab;
+    stats.utilization = slabs == 0 ? 0.0
+        : static_cast<double>(owner.active_objects * owner.object_size) / (slabs * slab_bytes_) * 100.0;
+    return stats;
+}
+
+// 获取slab利用率
+double SlabAllocator::getSlabUtilization() const {
+    if (slab_count_ == 0) return 0.0;
+    return static_cast<double>(active_bytes_) / getSlabBytes() * 100.0;
+}
+
+// 显示各缓存的统计
+void SlabAllocator::displayStatus() const {
+    std::cout << "\n🧱 Slab对象缓存状态（slab大小 " << slab_size_ << " KB）：" << std::endl;
+    std::cout << "┌──────────────────┬────────┬────────┬────────────────┬─────────────────┬────────┬─────────────────┬─────────────┐" << std::endl;
+    std::cout << "│ 缓存             │ 对象   │ 每slab │ 满/部分/空     │ 活跃/总对象     │ 利用率 │ 分配/释放       │ 申请/归还   │" << std::endl;
+    std::cout << "├──────────────────┼────────┼────────┼────────────────┼─────────────────┼────────┼─────────────────┼─────────────┤" << std::endl;
+
+    for (int id = 0; id < getCacheCount(); ++id) {
+        SlabCacheStats stats = getCacheStats(id);
+        std::string lists = std::to_string(stats.full_slabs) + "/" + std::to_string(stats.partial_slabs)
+                          + "/" + std::to_string(stats.empty_slabs);
+        std::string objects = std::to_string(stats.active_objects) + "/" + std::to_string(stats.total_objects);
+        std::string calls = std::to_string(stats.allocations) + "/" + std::to_string(stats.frees);
+        std::string slabs = std::to_string(stats.slab_grows) + "/" + std::to_string(stats.slab_shrinks);
+        std::cout << "│ " << std::left << std::setw(16) << stats.name << std::right
+                  << " │ " << std::setw(6) << stats.object_size
+                  << " │ " << std::setw(6) << stats.objects_per_slab
+                  << " │ " << std::setw(14) << lists
+                  << " │ " << std::setw(15) << objects
+                  << " │ " << std::setw(5) << std::fixed << std::setprecision(1) << stats.utilization << "%"
+                  << " │ " << std::setw(15) << calls
+                  << " │ " << std::setw(11) << slabs
+                  << " │" << std::endl;
+    }
+    std::cout << "└──────────────────┴────────┴────────┴────────────────┴─────────────────┴────────┴─────────────────┴─────────────┘" << std::endl;
+
+    std::cout << "slab总数: " << slab_count_ << "，占用 " << getSlabBytes() / 1024 << " KB，已分配对象 "
+              << active_bytes_ << " 字节，slab利用率 " << std::fixed << std::setprecision(1)
+              << getSlabUtilization() << "%" << std::endl;
+}
+
+// 检查缓存ID
+void SlabAllocator::checkCache(int cache) const {
+    if (cache < 0 || cache >= getCacheCount()) {
+        throw std::invalid_argument("无效的缓存ID");
+    }
+}
+
+// 把slab挂到缓存的某条状态链表头部
+void SlabAllocator::linkSlab(int slab, int list) {
+    Slab& current = slabs_[slab];
+    Cache& owner = caches_[current.cache];
+    current.list = list;
+    current.prev_slab = -1;
+    current.next_slab = owner.lists[list];
+    if (owner.lists[list] >= 0) {
+        slabs_[owner.lists[list]].prev_slab = slab;
+    }
+    owner.lists[list] = slab;
+    owner.list_sizes[list]++;
+}
+
+// 把slab从所在的状态链表摘下
+void SlabAllocator::unlinkSlab(int slab) {
+    Slab& current = slabs_[slab];
+    Cache& owner = caches_[current.cache];
+    if (current.prev_slab >= 0) {
+        slabs_[current.prev_slab].next_slab = current.next_slab;
+    } else {
+        owner.lists[current.list] = current.next_slab;
+    }
+    if (current.next_slab >= 0) {
+        slabs_[current.next_slab].prev_slab = current.prev_slab;
+    }
+    owner.list_sizes[current.list]--;
+}
+
+// 向页面来源申请一个slab
+int SlabAllocator::growCache(int cache) {
+    int slab;
+    if (free_slab_ids_.empty()) {
+        slab = static_cast<int>(slabs_.size());
+    } else {
+        slab = free_slab_ids_.back();
+    }
+
+    int base = page_source_.allocateMemory(slab_size_, kSlabOwnerBase + slab, caches_[cache].name);
+    if (base < 0) {
+        return -1;
+    }
+    if (free_slab_ids_.empty()) {
+        slabs_.emplace_back();
+    } else {
+        free_slab_ids_.pop_back();
+    }
+
+    Cache& owner = caches_[cache];
+    Slab& created = slabs_[slab];
+    created.cache = cache;
+    created.base = static_cast<size_t>(base);
+    created.in_use = 0;
+    created.free_head = 0;
+    created.next.resize(owner.objects_per_slab);
+    for (size_t i = 0; i < owner.objects_per_slab; ++i) {
+        created.next[i] = i + 1 < owner.objects_per_slab ? static_cast<int>(i + 1) : -1;
+    }
+    for (size_t page = 0; page < slab_size_; ++page) {
+        page_owner_[created.base + page] = slab;
+    }
+    linkSlab(slab, kEmptyList);
+
+    owner.counters.slab_grows++;
+    slab_count_++;
+    return slab;
+}
+
+// 把空slab还给页面来源
+void SlabAllocator::destroySlab(int slab) {
+    unlinkSlab(slab);
+    Slab& current = slabs_[slab];
+    for (size_t page = 0; page < slab_size_; ++page) {
+        page_owner_.erase(current.base + page);
+    }
+    page_source_.deallocateMemory(kSlabOwnerBase + slab);
+    caches_[current.cache].counters.slab_shrinks++;
+    current.next.clear();
+    free_slab_ids_.push_back(slab);
+    slab_count_--;
+}
+
+} // namespace ZTS_OS
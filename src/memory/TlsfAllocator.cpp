@@ -0,0 +1,300 @@
+#include "../../include/memory/TlsfAllocator.h"
+#include <iostream>
+#include <iomanip>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+/**
+ * @file TlsfAllocator.cpp
+ * @brief TLSF（两级分离适配）分配器实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+// 最低置位的下标（value不为0）
+int lowestBit(uint32_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward(&index, value);
+    return static_cast<int>(index);
+#else
+    return __builtin_ctz(value);
+#endif
+}
+
+// 最高置位的下标（value不为0）
+int highestBit(uint32_t value) {
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse(&index, value);
+    return static_cast<int>(index);
+#else
+    return 31 - __builtin_clz(value);
+#endif
+}
+
+// 64位值的最高置位下标（value不为0）
+int highestBit64(uint64_t value) {
+    uint32_t high = static_cast<uint32_t>(value >> 32);
+    return high != 0 ? 32 + highestBit(high) : highestBit(static_cast<uint32_t>(value));
+}
+
+// 小于该大小的块按1KB一类放在第一级的0号类别
+constexpr size_t kSmallBlockSize = static_cast<size_t>(1) << TlsfAllocator::kSecondLevelLog2;
+
+} // namespace
+
+// 构造函数
+TlsfAllocator::TlsfAllocator(size_t total_size)
+    : MemoryManager(total_size), first_bitmap_(0), free_block_count_(0) {
+    if (total_size == 0) {
+        throw std::invalid_argument("TLSF的总内存大小必须为正数");
+    }
+    int first = 0;
+    int second = 0;
+    mapping(total_size, first, second);
+    if (first >= kFirstLevelCount) {
+        throw std::invalid_argument("总内存大小超出TLSF第一级类别的范围");
+    }
+    strategy_ = MemoryAllocationStrategy::FIRST_FIT;
+    rebuildFreeLists();
+}
+
+// 计算块大小所属的类别
+void TlsfAllocator::mapping(size_t size, int& first, int& second) {
+    if (size < kSmallBlockSize) {
+        first = 0;
+        second = static_cast<int>(size);
+        return;
+    }
+    int msb = highestBit64(size);
+    second = static_cast<int>((size >> (msb - kSecondLevelLog2)) ^ kSmallBlockSize);
+    first = msb - kSecondLevelLog2 + 1;
+}
+
+// 分配内存
+int TlsfAllocator::allocateMemory(size_t size, int process_id, const std::string& name) {
+    if (size == 0) return -1;
+
+    int block_id = findFreeBlock(size);
+    if (block_id == -1) {
+        trace() << "❌ 无法为进程 " << process_id << " 分配 " << size
+                << "KB 内存：空间不足" << std::endl;
+        return -1;
+    }
+
+    // 分割块，剩余部分按大小放回对应类别
+    removeFree(block_id);
+    if (memory_blocks_[block_id].size > size) {
+        splitBlock(block_id, size);
+        insertFree(memory_blocks_.next(block_id));
+    }
+
+    MemoryBlock& block = memory_blocks_[block_id];
+    block.is_free = false;
+    block.process_id = process_id;
+    block.name = name.empty() ? ("进程" + std::to_string(process_id)) : name;
+    used_size_ += block.size;
+    linkOwner(block_id);
+
+    trace() << "✅ 成功为进程 " << process_id << " (" << block.name
+            << ") 分配 " << size << "KB 内存，起始地址: " << block.start_address << std::endl;
+
+    return static_cast<int>(block.start_address);
+}
+
+// 释放内存
+bool TlsfAllocator::deallocateMemory(int process_id) {
+    auto owner = owner_heads_.find(process_id);
+    if (owner == owner_heads_.end()) {
+        trace() << "❌ 未找到进程 " << process_id << " 的内存分配" << std::endl;
+        return false;
+    }
+
+    int id = owner->second;
+    owner_heads_.erase(owner);
+    while (id >= 0) {
+        const MemoryBlock& block = memory_blocks_[id];
+        trace() << "✅ 释放进程 " << process_id << " (" << block.name
+                << ") 的内存：" << block.size << "KB" << std::endl;
+
+        // 合并可能回收当前块的句柄，先记下进程的下一块
+        int next_owned = block.owner_next;
+        releaseBlock(id);
+        id = next_owned;
+    }
+    return true;
+}
+
+// 内存压缩
+void TlsfAllocator::compactMemory() {
+    MemoryManager::compactMemory();
+    rebuildFreeLists();
+    rebuildOwnerIndex();
+}
+
+// 获取最大空闲块大小
+size_t TlsfAllocator::getLargestFreeBlock() const {
+    if (first_bitmap_ == 0) {
+        return 0;
+    }
+    int first = highestBit(first_bitmap_);
+    int second = highestBit(second_bitmaps_[first]);
+    size_t largest = 0;
+    for (int id = heads_[first][second]; id >= 0; id = free_next_[id]) {
+        if (memory_blocks_[id].size > largest) {
+            largest = memory_blocks_[id].size;
+        }
+    }
+    return largest;
+}
+
+// 显示内存状态
+void TlsfAllocator::displayMemoryStatus() const {
+    std::cout << "\n📊 内存状态信息（TLSF）：" << std::endl;
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
+    std::cout << "总内存大小: " << total_size_ << " KB" << std::endl;
+    std::cout << "已使用: " << getUsedSize() << " KB ("
+              << std::fixed << std::setprecision(1) << getMemoryUtilization() << "%)" << std::endl;
+    std::cout << "空闲: " << getFreeSize() << " KB" << std::endl;
+    std::cout << "碎片化程度: " << std::fixed << std::setprecision(1) << getFragmentation() << "%" << std::endl;
+    std::cout << "最大空闲块: " << getLargestFreeBlock() << " KB" << std::endl;
+    std::cout << "空闲块数量: " << getFreeBlockCount() << std::endl;
+
+    std::cout << "非空类别（第一级, 第二级）:";
+    for (int first = 0; first < kFirstLevelCount; ++first) {
+        if ((first_bitmap_ >> first) & 1u) {
+            for (int second = 0; second < kSecondLevelCount; ++second) {
+                if ((second_bitmaps_[first] >> second) & 1u) {
+                    std::cout << " (" << first << "," << second << ")";
+                }
+            }
+        }
+    }
+    std::cout << std::endl;
+
+    displayMemoryMap();
+}
+
+// 查找必然放得下size的空闲块
+int TlsfAllocator::findFreeBlock(size_t size) {
+    // 向上取整到所在类别的上界，找到的类别中任何块都不小于size
+    if (size >= kSmallBlockSize) {
+        size_t round = (static_cast<size_t>(1) << (highestBit64(size) - kSecondLevelLog2)) - 1;
+        if (size > SIZE_MAX - round) {
+            return -1;
+        }
+        size += round;
+    }
+    int first = 0;
+    int second = 0;
+    mapping(size, first, second);
+    if (first >= kFirstLevelCount) {
+        return -1;
+    }
+
+    uint32_t second_map = second_bitmaps_[first] & (~0u << second);
+    if (second_map == 0) {
+        uint32_t first_map = first + 1 < kFirstLevelCount ? first_bitmap_ & (~0u << (first + 1)) : 0;
+        if (first_map == 0) {
+            return -1;
+        }
+        first = lowestBit(first_map);
+        second_map = second_bitmaps_[first];
+    }
+    second = lowestBit(second_map);
+    return heads_[first][second];
+}
+
+// 把空闲块加入所属类别的链表头部
+void TlsfAllocator::insertFree(int block) {
+    if (block >= static_cast<int>(free_next_.size())) {
+        free_next_.resize(block + 1, -1);
+        free_prev_.resize(block + 1, -1);
+    }
+    int first = 0;
+    int second = 0;
+    mapping(memory_blocks_[block].size, first, second);
+
+    int head = heads_[first][second];
+    free_prev_[block] = -1;
+    free_next_[block] = head;
+    if (head >= 0) {
+        free_prev_[head] = block;
+    }
+    heads_[first][second] = block;
+    first_bitmap_ |= 1u << first;
+    second_bitmaps_[first] |= 1u << second;
+    free_block_count_++;
+}
+
+// 把空闲块从所属类别的链表中摘下
+void TlsfAllocator::removeFree(int block) {
+    int first = 0;
+    int second = 0;
+    mapping(memory_blocks_[block].size, first, second);
+
+    int before = free_prev_[block];
+    int after = free_next_[block];
+    if (before >= 0) {
+        free_next_[before] = after;
+    } else {
+        heads_[first][second] = after;
+        if (after < 0) {
+            second_bitmaps_[first] &= ~(1u << second);
+            if (second_bitmaps_[first] == 0) {
+                first_bitmap_ &= ~(1u << first);
+            }
+        }
+    }
+    if (after >= 0) {
+        free_prev_[after] = before;
+    }
+    free_block_count_--;
+}
+
+// 释放一个已分配块并与相邻空闲块合并
+void TlsfAllocator::releaseBlock(int block) {
+    MemoryBlock& released = memory_blocks_[block];
+    used_size_ -= released.size;
+    released.is_free = true;
+    released.process_id = -1;
+    released.name = "空闲";
+
+    // 相邻的空闲块要并入，先从各自的类别中摘下
+    int before = memory_blocks_.prev(block);
+    int after = memory_blocks_.next(block);
+    if (before >= 0 && memory_blocks_[before].is_free) {
+        removeFree(before);
+    }
+    if (after >= 0 && memory_blocks_[after].is_free) {
+        removeFree(after);
+    }
+    insertFree(coalesceBlock(block));
+}
+
+// 按块链表重建空闲链表和位图
+void TlsfAllocator::rebuildFreeLists() {
+    first_bitmap_ = 0;
+    for (int first = 0; first < kFirstLevelCount; ++first) {
+        second_bitmaps_[first] = 0;
+        for (int second = 0; second < kSecondLevelCount; ++second) {
+            heads_[first][second] = -1;
+        }
+    }
+    free_block_count_ = 0;
+    for (int id = memory_blocks_.head(); id >= 0; id = memory_blocks_.next(id)) {
+        if (memory_blocks_[id].is_free) {
+            insertFree(id);
+        }
+    }
+}
+
+} // namespace ZTS_OS
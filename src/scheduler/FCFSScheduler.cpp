@@ -14,69 +14,17 @@ namespace ZTS_OS {
 
 // 构造函数
 FCFSScheduler::FCFSScheduler() 
-    : Scheduler("FCFS", "先来先服务调度算法 - 按进程到达时间顺序执行，非抢占式") {
+    : BasicScheduler("FCFS", "先来先服务调度算法 - 按进程到达时间顺序执行，非抢占式") {
 }
 
-// 执行FCFS调度算法
-SchedulingResult FCFSScheduler::schedule(const ProcessList& processes) {
-    // 验证输入
-    validateProcesses(processes);
+// 在工作区中执行FCFS调度
+const SchedulingResult& FCFSScheduler::scheduleInto(const ProcessList& processes,
+                                                    SchedulerWorkspace& workspace) {
+    // 结果按到达时间（相同时按PID）排列，便于按顺序显示甘特图
+    workspace.staging.assign(processes.begin(), processes.end());
+    sortByArrivalTime(workspace.staging);
     
-    // 创建进程副本用于调度
-    ProcessList scheduled_processes = processes;
-    resetProcesses(scheduled_processes);
-    
-    // 按到达时间排序
-    sortByArrivalTime(scheduled_processes);
-    
-    // 执行调度
-    int current_time = 0;
-    
-    std::cout << "\n=== FCFS调度过程演示 ===" << std::endl;
-    std::cout << "======================================" << std::endl;
-    
-    for (auto& process : scheduled_processes) {
-        // 等待进程到达
-        if (current_time < process.getArrivalTime()) {
-            std::cout << "时间 " << current_time << "-" << process.getArrivalTime() 
-                      << ": CPU空闲，等待进程到达" << std::endl;
-            current_time = process.getArrivalTime();
-        }
-        
-        // 设置进程开始时间和响应时间
-        process.setStartTime(current_time);
-        process.setResponseTime(current_time - process.getArrivalTime());
-        
-        std::cout << "时间 " << current_time << ": 开始执行进程 P" << process.getPID() 
-                  << " (" << process.getName() << ")" << std::endl;
-        std::cout << "  到达时间: " << process.getArrivalTime() << std::endl;
-        std::cout << "  执行时间: " << process.getBurstTime() << std::endl;
-        std::cout << "  响应时间: " << process.getResponseTime() << std::endl;
-        
-        // 执行进程
-        process.setState(ProcessState::RUNNING);
-        current_time += process.getBurstTime();
-        
-        // 完成进程
-        process.setState(ProcessState::TERMINATED);
-        process.setCompletionTime(current_time);
-        process.calculateTimes(current_time);
-        
-        std::cout << "时间 " << current_time << ": 进程 P" << process.getPID() 
-                  << " 执行完成" << std::endl;
-        std::cout << "  完成时间: " << process.getCompletionTime() << std::endl;
-        std::cout << "  周转时间: " << process.getTurnaroundTime() << std::endl;
-        std::cout << "  等待时间: " << process.getWaitingTime() << std::endl;
-        std::cout << std::endl;
-    }
-    
-    // 计算并返回结果
-    SchedulingResult result = calculateStatistics(scheduled_processes, current_time);
-    
-    std::cout << "=== FCFS调度完成！总执行时间: " << current_time << " 时间单位 ===" << std::endl;
-    std::cout << "======================================" << std::endl;
-    
-    return result;
+    return BasicScheduler::scheduleInto(workspace.staging, workspace);
 }
 
 // 获取算法类型
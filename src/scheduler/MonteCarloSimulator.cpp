@@ -0,0 +1,290 @@
+#include "../../include/algorithms/MonteCarloSimulator.h"
+#include "../../include/algorithms/SchedulerWorkspace.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <exception>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <thread>
+
+/**
+ * @file MonteCarloSimulator.cpp
+ * @brief 调度算法的蒙特卡洛批量模拟实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+// SplitMix64：把(种子, 重复序号)打散成互不相关的子种子
+uint64_t splitMix64(uint64_t value) {
+    value += 0x9E3779B97F4A7C15ull;
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ull;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBull;
+    return value ^ (value >> 31);
+}
+
+// 打印一行指标估计
+void printEstimate(const std::string& name, const MetricEstimate& metric) {
+    std::cout << "  " << std::left << std::setw(14) << name << std::right
+              << std::setw(12) << metric.mean
+              << "   95% CI [" << metric.lower() << ", " << metric.upper() << "]"
+              << "  ±" << metric.half_width << std::endl;
+}
+
+} // namespace
+
+// 构造函数
+MonteCarloSimulator::MonteCarloSimulator(const WorkloadSpec& spec, uint64_t seed)
+    : spec_(spec), seed_(seed), replications_(0), converged_(false) {
+    if (spec.process_count == 0) {
+        throw std::invalid_argument("每个负载的进程数必须大于0");
+    }
+    if (spec.mean_interarrival < 0) {
+        throw std::invalid_argument("到达间隔均值不能为负数");
+    }
+    if (spec.min_burst <= 0 || spec.max_burst < spec.min_burst) {
+        throw std::invalid_argument("执行时间范围无效");
+    }
+    if (spec.burst_distribution == WorkloadSpec::BurstDistribution::EXPONENTIAL && spec.mean_burst <= 0) {
+        throw std::invalid_argument("执行时间均值必须大于0");
+    }
+    if (spec.min_priority < static_cast<int>(ProcessPriority::HIGHEST) ||
+        spec.max_priority > static_cast<int>(ProcessPriority::LOWEST) ||
+        spec.max_priority < spec.min_priority) {
+        throw std::invalid_argument("优先级范围无效");
+    }
+}
+
+// 注册一个调度器
+void MonteCarloSimulator::addScheduler(const std::string& label, SchedulerMaker maker) {
+    if (!maker) {
+        throw std::invalid_argument("调度器工厂不能为空");
+    }
+    labels_.push_back(label);
+    makers_.push_back(std::move(maker));
+}
+
+// 按类型注册一个调度器
+void MonteCarloSimulator::addScheduler(SchedulerFactory::SchedulerType type, int time_quantum) {
+    addScheduler(SchedulerFactory::getSchedulerTypeName(type), [type, time_quantum]() {
+        return SchedulerFactory::createScheduler(type, time_quantum);
+    });
+}
+
+// 生成第k次重复使用的负载
+ProcessList MonteCarloSimulator::generateWorkload(size_t replication) const {
+    std::mt19937_64 rng(splitMix64(seed_ ^ splitMix64(static_cast<uint64_t>(replication))));
+    std::exponential_distribution<double> interarrival(
+        spec_.mean_interarrival > 0 ? 1.0 / spec_.mean_interarrival : 1.0);
+    std::uniform_int_distribution<int> uniform_burst(spec_.min_burst, spec_.max_burst);
+    std::exponential_distribution<double> exponential_burst(1.0 / std::max(spec_.mean_burst, 1e-9));
+    std::uniform_int_distribution<int> priority(spec_.min_priority, spec_.max_priority);
+
+    ProcessList processes;
+    processes.reserve(spec_.process_count);
+    double arrival = 0.0;
+    for (size_t i = 0; i < spec_.process_count; ++i) {
+        int burst;
+        if (spec_.burst_distribution == WorkloadSpec::BurstDistribution::UNIFORM) {
+            burst = uniform_burst(rng);
+        } else {
+            double value = std::round(exponential_burst(rng));
+            burst = static_cast<int>(std::min<double>(std::max<double>(value, spec_.min_burst), spec_.max_burst));
+        }
+
+        processes.emplace_back(static_cast<int>(i + 1), "P" + std::to_string(i + 1),
+                               static_cast<int>(std::llround(arrival)), burst,
+                               static_cast<ProcessPriority>(priority(rng)));
+
+        if (spec_.mean_interarrival > 0) {
+            arrival += interarrival(rng);
+        }
+    }
+    return processes;
+}
+
+// 运行模拟
+std::vector<MonteCarloReport> MonteCarloSimulator::run(const MonteCarloOptions& options) {
+    if (makers_.empty()) {
+        throw std::logic_error("至少需要注册一个调度器");
+    }
+    if (options.min_replications < 2 || options.max_replications < options.min_replications) {
+        throw std::invalid_argument("重复次数范围无效（至少2次）");
+    }
+
+    unsigned int threads = options.threads;
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    const size_t scheduler_count = makers_.size();
+    std::vector<std::vector<Sample>> samples(scheduler_count);
+    std::vector<MonteCarloReport> reports(scheduler_count);
+    size_t done = 0;
+    size_t batch = options.min_replications;
+    converged_ = false;
+
+    while (true) {
+        size_t target = std::min(done + batch, options.max_replications);
+        for (auto& per_scheduler : samples) {
+            per_scheduler.resize(target);
+        }
+
+        // 并行运行[done, target)：每个线程有自己的调度器实例和工作区，样本按序号写入互不重叠
+        std::atomic<size_t> next(done);
+        std::exception_ptr failure;
+        std::atomic<bool> failed(false);
+        auto worker = [&]() {
+            try {
+                std::vector<SchedulerPtr> schedulers;
+                for (const auto& maker : makers_) {
+                    schedulers.push_back(maker());
+                    schedulers.back()->setTraceEnabled(false);
+                }
+                SchedulerWorkspace workspace;
+                for (size_t k = next++; k < target && !failed; k = next++) {
+                    ProcessList workload = generateWorkload(k);
+                    for (size_t s = 0; s < scheduler_count; ++s) {
+                        const SchedulingResult& result = schedulers[s]->scheduleInto(workload, workspace);
+                        samples[s][k] = {result.average_waiting_time, result.average_turnaround_time,
+                                         result.average_response_time, result.cpu_utilization,
+                                         result.throughput};
+                    }
+                }
+            } catch (...) {
+                if (!failed.exchange(true)) {
+                    failure = std::current_exception();
+                }
+            }
+        };
+
+        size_t worker_count = std::min<size_t>(threads, target - done);
+        std::vector<std::thread> pool;
+        for (size_t t = 1; t < worker_count; ++t) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : pool) {
+            thread.join();
+        }
+        if (failure) {
+            std::rethrow_exception(failure);
+        }
+        done = target;
+
+        // 汇总并检查精度
+        bool precise = true;
+        for (size_t s = 0; s < scheduler_count; ++s) {
+            std::vector<double> waiting, turnaround, response, utilization, throughput;
+            for (const auto& sample : samples[s]) {
+                waiting.push_back(sample.waiting_time);
+                turnaround.push_back(sample.turnaround_time);
+                response.push_back(sample.response_time);
+                utilization.push_back(sample.cpu_utilization);
+                throughput.push_back(sample.throughput);
+            }
+
+            MonteCarloReport& report = reports[s];
+            report.scheduler = labels_[s];
+            report.waiting_time = estimate(waiting);
+            report.turnaround_time = estimate(turnaround);
+            report.response_time = estimate(response);
+            report.cpu_utilization = estimate(utilization);
+            report.throughput = estimate(throughput);
+
+            precise = precise &&
+                      isPrecise(report.waiting_time, options) &&
+                      isPrecise(report.turnaround_time, options) &&
+                      isPrecise(report.response_time, options) &&
+                      isPrecise(report.cpu_utilization, options) &&
+                      isPrecise(report.throughput, options);
+        }
+
+        if (precise) {
+            converged_ = true;
+            break;
+        }
+        if (done >= options.max_replications) {
+            break;
+        }
+        // 每轮把样本量扩大一半；批次大小与线程数无关，停止时的重复次数因此也与线程数无关
+        batch = std::max<size_t>(done / 2, 1);
+    }
+
+    replications_ = done;
+    return reports;
+}
+
+// 打印统计结果
+void MonteCarloSimulator::displayReports(const std::vector<MonteCarloReport>& reports) const {
+    std::cout << "\n📊 蒙特卡洛模拟结果（" << replications_ << " 次重复，"
+              << (converged_ ? "已达到目标精度" : "达到最大重复次数") << "）：" << std::endl;
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(3);
+    for (const auto& report : reports) {
+        std::cout << report.scheduler << std::endl;
+        printEstimate("平均等待时间", report.waiting_time);
+        printEstimate("平均周转时间", report.turnaround_time);
+        printEstimate("平均响应时间", report.response_time);
+        printEstimate("CPU利用率(%)", report.cpu_utilization);
+        printEstimate("吞吐率", report.throughput);
+    }
+}
+
+// 由样本计算均值与置信区间
+MetricEstimate MonteCarloSimulator::estimate(const std::vector<double>& values) {
+    MetricEstimate metric;
+    metric.samples = values.size();
+    if (values.empty()) {
+        return metric;
+    }
+
+    double sum = 0.0;
+    for (double value : values) {
+        sum += value;
+    }
+    metric.mean = sum / values.size();
+
+    if (values.size() > 1) {
+        double squares = 0.0;
+        for (double value : values) {
+            squares += (value - metric.mean) * (value - metric.mean);
+        }
+        metric.std_dev = std::sqrt(squares / (values.size() - 1));
+        metric.half_width = tCritical(values.size() - 1) * metric.std_dev / std::sqrt(static_cast<double>(values.size()));
+    }
+    return metric;
+}
+
+// 95%置信水平下Student t分布的双侧临界值
+double MonteCarloSimulator::tCritical(size_t degrees) {
+    static const double kTable[] = {
+        12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+        2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086,
+        2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052, 2.048, 2.045, 2.042
+    };
+    if (degrees == 0) {
+        return kTable[0];
+    }
+    if (degrees <= 30) {
+        return kTable[degrees - 1];
+    }
+    // 自由度较大时用正态分位数加一阶修正
+    const double z = 1.959964;
+    return z + (z * z * z + z) / (4.0 * static_cast<double>(degrees));
+}
+
+// 置信区间是否已足够窄
+bool MonteCarloSimulator::isPrecise(const MetricEstimate& metric, const MonteCarloOptions& options) {
+    return metric.half_width <= options.relative_precision * std::fabs(metric.mean) ||
+           metric.half_width <= options.absolute_precision;
+}
+
+} // namespace ZTS_OS
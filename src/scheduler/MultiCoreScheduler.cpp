@@ -0,0 +1,642 @@
+#include "../../include/algorithms/MultiCoreScheduler.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+/**
+ * @file MultiCoreScheduler.cpp
+ * @brief 异构多核调度模拟与功耗模型实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+// 就绪队列元素：(出队键, 次序键, 进程下标)，三者依次比较
+struct ReadyEntry {
+    double key;
+    long long tie;
+    size_t index;
+
+    bool operator>(const ReadyEntry& other) const {
+        if (key != other.key) {
+            return key > other.key;
+        }
+        if (tie != other.tie) {
+            return tie > other.tie;
+        }
+        return index > other.index;
+    }
+};
+
+// ondemand调节器直接升到最高频率的利用率阈值
+const double kOndemandUpThreshold = 0.8;
+
+// schedutil调节器的频率余量
+const double kSchedutilHeadroom = 1.25;
+
+// 一段运行结束的原因
+enum class SegmentEnd {
+    FINISH,  // 进程完成
+    SLICE,   // 时间片用完
+    TICK     // 调节器采样，进程继续在原核心上运行
+};
+
+// 核心运行状态
+struct CoreState {
+    bool busy;           // 是否正在运行进程
+    size_t process;      // 正在运行的进程下标
+    double event_time;   // 本段运行结束的时刻
+    double run_time;     // 本段执行时间（不含迁移开销）
+    double overhead;     // 本段迁移开销
+    SegmentEnd end;      // 本段结束原因
+    double slice_left;   // 当前时间片剩余时间
+    size_t frequency;    // 当前频率状态下标
+    double utilization;  // 忙闲状态的指数滑动平均
+    double idle_since;   // 进入空闲的时刻
+};
+
+} // namespace
+
+// 构造函数
+MultiCoreScheduler::MultiCoreScheduler(SchedulerFactory::SchedulerType order, PlacementPolicy placement,
+                                       int time_quantum)
+    : order_(order), placement_(placement), time_quantum_(time_quantum), migration_cost_(0.0),
+      governor_(FrequencyGovernor::RACE_TO_IDLE), sampling_period_(4.0) {
+    if (time_quantum <= 0) {
+        throw std::invalid_argument("时间片大小必须大于0");
+    }
+}
+
+// 按立方功率曲线生成频率状态
+std::vector<PerformanceState> CpuCore::cubicPowerCurve(const std::vector<double>& frequencies,
+                                                       double max_power, double static_power) {
+    if (frequencies.empty()) {
+        throw std::invalid_argument("频率列表不能为空");
+    }
+    if (static_power < 0 || max_power < static_power) {
+        throw std::invalid_argument("功率参数无效");
+    }
+    double max_frequency = *std::max_element(frequencies.begin(), frequencies.end());
+    std::vector<PerformanceState> states;
+    for (double frequency : frequencies) {
+        double ratio = frequency / max_frequency;
+        states.push_back({frequency, static_power + (max_power - static_power) * ratio * ratio * ratio});
+    }
+    return states;
+}
+
+// 添加一个核心
+void MultiCoreScheduler::addCore(const CpuCore& core) {
+    if (!(core.speed > 0)) {
+        throw std::invalid_argument("核心速度倍率必须大于0");
+    }
+    for (const auto& existing : cores_) {
+        if (existing.id == core.id) {
+            throw std::invalid_argument("核心编号重复: " + std::to_string(core.id));
+        }
+    }
+
+    CpuCore added = core;
+    for (const auto& state : added.performance_states) {
+        if (!(state.frequency > 0) || state.power < 0) {
+            throw std::invalid_argument("频率状态无效：频率必须大于0，功率不能为负数");
+        }
+    }
+    for (const auto& state : added.idle_states) {
+        if (state.power < 0 || state.target_residency < 0) {
+            throw std::invalid_argument("空闲状态无效：功率和目标驻留时间不能为负数");
+        }
+    }
+    std::sort(added.performance_states.begin(), added.performance_states.end(),
+              [](const PerformanceState& a, const PerformanceState& b) { return a.frequency < b.frequency; });
+    std::stable_sort(added.idle_states.begin(), added.idle_states.end(),
+                     [](const IdleState& a, const IdleState& b) { return a.target_residency < b.target_residency; });
+    // 有频率状态时满载功耗以最高频率为准
+    if (!added.performance_states.empty()) {
+        added.active_power = added.performance_states.back().power;
+    }
+    if (!(added.active_power > 0)) {
+        throw std::invalid_argument("核心功耗必须大于0");
+    }
+    cores_.push_back(added);
+}
+
+// 添加一组相同的核心
+void MultiCoreScheduler::addCores(const std::string& core_class, size_t count, double speed, double active_power) {
+    int next_id = 0;
+    for (const auto& core : cores_) {
+        next_id = std::max(next_id, core.id + 1);
+    }
+    for (size_t i = 0; i < count; ++i) {
+        addCore(CpuCore(next_id++, core_class, speed, active_power));
+    }
+}
+
+// 设置迁移开销
+void MultiCoreScheduler::setMigrationCost(double cost) {
+    if (cost < 0) {
+        throw std::invalid_argument("迁移开销不能为负数");
+    }
+    migration_cost_ = cost;
+}
+
+// 设置频率调节器
+void MultiCoreScheduler::setGovernor(FrequencyGovernor governor, double sampling_period) {
+    if (!(sampling_period > 0)) {
+        throw std::invalid_argument("采样周期必须大于0");
+    }
+    governor_ = governor;
+    sampling_period_ = sampling_period;
+}
+
+// 核心满载时单位工作量的能耗
+double MultiCoreScheduler::energyPerWork(size_t core) const {
+    const CpuCore& cpu = cores_[core];
+    double frequency = cpu.performance_states.empty() ? 1.0 : cpu.performance_states.back().frequency;
+    return cpu.active_power / (cpu.speed * frequency);
+}
+
+// 由调节器为核心选择频率状态
+size_t MultiCoreScheduler::chooseFrequency(size_t core, double utilization) const {
+    const auto& states = cores_[core].performance_states;
+    if (states.size() <= 1) {
+        return 0;
+    }
+    const size_t top = states.size() - 1;
+    const double min_frequency = states.front().frequency;
+    const double max_frequency = states.back().frequency;
+
+    double target = max_frequency;
+    switch (governor_) {
+        case FrequencyGovernor::RACE_TO_IDLE:
+            return top;
+        case FrequencyGovernor::ONDEMAND:
+            if (utilization >= kOndemandUpThreshold) {
+                return top;
+            }
+            target = min_frequency + utilization * (max_frequency - min_frequency);
+            break;
+        case FrequencyGovernor::SCHEDUTIL:
+            target = kSchedutilHeadroom * utilization * max_frequency;
+            break;
+    }
+
+    // 取不低于目标频率的最低状态
+    for (size_t i = 0; i < top; ++i) {
+        if (states[i].frequency >= target) {
+            return i;
+        }
+    }
+    return top;
+}
+
+// 为进程选择空闲核心
+size_t MultiCoreScheduler::choosePlacement(const std::vector<bool>& idle, int last_core) const {
+    const size_t none = cores_.size();
+    size_t best = none;
+
+    // 候选核心是否优于当前最佳：各策略的比较键，最后按核心顺序
+    auto faster = [this](size_t a, size_t b) {
+        return cores_[a].speed > cores_[b].speed;
+    };
+    auto cheaper = [this](size_t a, size_t b) {
+        double energy_a = energyPerWork(a);
+        double energy_b = energyPerWork(b);
+        if (energy_a != energy_b) {
+            return energy_a < energy_b;
+        }
+        return cores_[a].speed > cores_[b].speed;
+    };
+
+    switch (placement_) {
+        case PlacementPolicy::FASTEST_AVAILABLE:
+            for (size_t c = 0; c < cores_.size(); ++c) {
+                if (idle[c] && (best == none || faster(c, best))) {
+                    best = c;
+                }
+            }
+            break;
+
+        case PlacementPolicy::ENERGY_AWARE:
+            for (size_t c = 0; c < cores_.size(); ++c) {
+                if (idle[c] && (best == none || cheaper(c, best))) {
+                    best = c;
+                }
+            }
+            break;
+
+        case PlacementPolicy::AFFINITY_PRESERVING: {
+            if (last_core >= 0 && idle[static_cast<size_t>(last_core)]) {
+                return static_cast<size_t>(last_core);
+            }
+            // 上次的核心忙时，优先同类别核心（共享缓存的可能性更大），其次最快的核心
+            auto same_class = [this, last_core](size_t c) {
+                return last_core >= 0 && cores_[c].core_class == cores_[static_cast<size_t>(last_core)].core_class;
+            };
+            for (size_t c = 0; c < cores_.size(); ++c) {
+                if (!idle[c]) {
+                    continue;
+                }
+                if (best == none || (same_class(c) && !same_class(best)) ||
+                    (same_class(c) == same_class(best) && faster(c, best))) {
+                    best = c;
+                }
+            }
+            break;
+        }
+    }
+    return best;
+}
+
+// 执行调度
+MultiCoreResult MultiCoreScheduler::schedule(const ProcessList& processes) const {
+    if (cores_.empty()) {
+        throw std::logic_error("至少需要添加一个核心");
+    }
+    if (processes.empty()) {
+        throw std::invalid_argument("进程列表不能为空");
+    }
+    for (const auto& process : processes) {
+        if (process.getBurstTime() <= 0) {
+            throw std::invalid_argument("进程执行时间必须大于0");
+        }
+        if (process.getArrivalTime() < 0) {
+            throw std::invalid_argument("进程到达时间不能为负数");
+        }
+    }
+
+    const size_t count = processes.size();
+    const size_t core_count = cores_.size();
+    const bool time_sliced = order_ == SchedulerFactory::SchedulerType::ROUND_ROBIN;
+
+    MultiCoreResult result;
+    result.processes.resize(count);
+    std::vector<double> remaining(count);
+    std::vector<int> last_core(count, -1);
+    for (size_t i = 0; i < count; ++i) {
+        ProcessRunRecord& record = result.processes[i];
+        record.pid = processes[i].getPID();
+        record.name = processes[i].getName();
+        record.arrival_time = processes[i].getArrivalTime();
+        record.burst_time = processes[i].getBurstTime();
+        remaining[i] = processes[i].getBurstTime();
+    }
+
+    // 每个核心实际使用的频率状态和空闲状态：未配置时分别是(1.0, active_power)和功率为0的空闲
+    std::vector<std::vector<PerformanceState>> performance_states(core_count);
+    std::vector<std::vector<IdleState>> idle_states(core_count);
+    result.cores.resize(core_count);
+    for (size_t c = 0; c < core_count; ++c) {
+        const CpuCore& cpu = cores_[c];
+        performance_states[c] = cpu.performance_states;
+        if (performance_states[c].empty()) {
+            performance_states[c].push_back({1.0, cpu.active_power});
+        }
+        idle_states[c] = cpu.idle_states;
+        if (idle_states[c].empty()) {
+            idle_states[c].push_back({"idle", 0.0, 0.0});
+        }
+
+        CoreReport& report = result.cores[c];
+        report = {cpu.id, cpu.core_class, cpu.speed, 0.0, 0.0, 0.0, 0, 0.0, 0, {}, {}};
+        for (const auto& state : performance_states[c]) {
+            report.frequency_residency.emplace_back(state.frequency, 0.0);
+        }
+        for (const auto& state : idle_states[c]) {
+            report.idle_residency.emplace_back(state.name, 0.0);
+        }
+    }
+
+    // 到达序列：按(到达时间, 下标)排序
+    std::vector<size_t> arrivals(count);
+    std::iota(arrivals.begin(), arrivals.end(), 0);
+    std::sort(arrivals.begin(), arrivals.end(), [&processes](size_t a, size_t b) {
+        int arrival_a = processes[a].getArrivalTime();
+        int arrival_b = processes[b].getArrivalTime();
+        return arrival_a != arrival_b ? arrival_a < arrival_b : a < b;
+    });
+
+    std::priority_queue<ReadyEntry, std::vector<ReadyEntry>, std::greater<ReadyEntry>> ready;
+    long long enqueue_sequence = 0;
+    auto makeReady = [&](size_t index) {
+        switch (order_) {
+            case SchedulerFactory::SchedulerType::FCFS:
+                // 与FCFSScheduler(Process::compareArrivalTime)一致：到达时间相同时按PID
+                ready.push({static_cast<double>(processes[index].getArrivalTime()),
+                            processes[index].getPID(), index});
+                break;
+            case SchedulerFactory::SchedulerType::ROUND_ROBIN:
+                ready.push({0.0, enqueue_sequence++, index});
+                break;
+            case SchedulerFactory::SchedulerType::SJF:
+                ready.push({remaining[index], 0, index});
+                break;
+            case SchedulerFactory::SchedulerType::PRIORITY:
+                ready.push({static_cast<double>(static_cast<int>(processes[index].getPriority())), 0, index});
+                break;
+        }
+    };
+
+    std::vector<CoreState> states(core_count);
+    for (size_t c = 0; c < core_count; ++c) {
+        states[c] = CoreState{false, 0, 0.0, 0.0, 0.0, SegmentEnd::FINISH, 0.0,
+                              performance_states[c].size() - 1, 0.0, 0.0};
+    }
+    std::vector<bool> idle(core_count, true);
+    size_t idle_count = core_count;
+    size_t next_arrival = 0;
+    size_t completed = 0;
+    double now = 0.0;
+
+    // 利用率滑动平均：经过duration时间、期间忙(1)或闲(0)
+    auto decayUtilization = [this](CoreState& state, double duration, double busy) {
+        if (duration > 0) {
+            state.utilization = busy + (state.utilization - busy) * std::exp(-duration / sampling_period_);
+        }
+    };
+    // 结算一段空闲：计入时间允许进入的功率最低的空闲状态
+    auto accountIdle = [&](size_t c, double duration) {
+        if (duration <= 0) {
+            return;
+        }
+        size_t chosen = 0;
+        for (size_t s = 1; s < idle_states[c].size(); ++s) {
+            if (idle_states[c][s].target_residency <= duration &&
+                idle_states[c][s].power < idle_states[c][chosen].power) {
+                chosen = s;
+            }
+        }
+        result.cores[c].idle_residency[chosen].second += duration;
+        result.cores[c].energy += idle_states[c][chosen].power * duration;
+        decayUtilization(states[c], duration, 0.0);
+    };
+    // 开始一段运行：由调节器选择频率，运行到完成、时间片用完或下一次采样为止
+    auto startSegment = [&](size_t c, double overhead) {
+        CoreState& state = states[c];
+        size_t frequency = chooseFrequency(c, state.utilization);
+        if (frequency != state.frequency) {
+            state.frequency = frequency;
+            result.cores[c].frequency_changes++;
+        }
+        double speed = cores_[c].speed * performance_states[c][frequency].frequency;
+        state.overhead = overhead;
+        state.run_time = remaining[state.process] / speed;
+        state.end = SegmentEnd::FINISH;
+        if (time_sliced && state.slice_left < state.run_time) {
+            state.run_time = state.slice_left;
+            state.end = SegmentEnd::SLICE;
+        }
+        bool governed = performance_states[c].size() > 1 && governor_ != FrequencyGovernor::RACE_TO_IDLE;
+        if (governed && sampling_period_ < state.run_time) {
+            state.run_time = sampling_period_;
+            state.end = SegmentEnd::TICK;
+        }
+        state.event_time = now + state.overhead + state.run_time;
+    };
+
+    while (completed < count) {
+        while (next_arrival < count && processes[arrivals[next_arrival]].getArrivalTime() <= now) {
+            makeReady(arrivals[next_arrival++]);
+        }
+
+        // 分派：依次取出就绪进程，放到放置策略选中的空闲核心上
+        while (!ready.empty() && idle_count > 0) {
+            size_t index = ready.top().index;
+            ready.pop();
+            size_t c = choosePlacement(idle, last_core[index]);
+
+            ProcessRunRecord& record = result.processes[index];
+            if (last_core[index] < 0) {
+                record.start_time = now;
+                record.response_time = now - record.arrival_time;
+            }
+
+            CoreState& state = states[c];
+            accountIdle(c, now - state.idle_since);
+            double overhead = 0.0;
+            if (last_core[index] >= 0 && static_cast<size_t>(last_core[index]) != c) {
+                overhead = migration_cost_;
+                record.migrations++;
+                result.migrations++;
+            }
+            state.busy = true;
+            state.process = index;
+            state.slice_left = time_quantum_;
+            startSegment(c, overhead);
+
+            last_core[index] = static_cast<int>(c);
+            idle[c] = false;
+            idle_count--;
+            result.cores[c].dispatches++;
+            result.scheduling_decisions++;
+        }
+
+        // 推进到下一个事件：新进程到达或某个核心的一段运行结束
+        double next_time = std::numeric_limits<double>::infinity();
+        if (next_arrival < count) {
+            next_time = processes[arrivals[next_arrival]].getArrivalTime();
+        }
+        for (const auto& state : states) {
+            if (state.busy) {
+                next_time = std::min(next_time, state.event_time);
+            }
+        }
+        now = next_time;
+
+        // 先结算本时刻结束的运行段，时间片用完的进程排在同时刻到达的进程之后
+        std::vector<size_t> expired;
+        for (size_t c = 0; c < core_count; ++c) {
+            CoreState& state = states[c];
+            if (!state.busy || state.event_time > now) {
+                continue;
+            }
+            size_t index = state.process;
+            double duration = state.overhead + state.run_time;
+            double work = state.run_time * cores_[c].speed * performance_states[c][state.frequency].frequency;
+            CoreReport& report = result.cores[c];
+            report.busy_time += duration;
+            report.energy += performance_states[c][state.frequency].power * duration;
+            report.frequency_residency[state.frequency].second += duration;
+            report.work_done += state.end == SegmentEnd::FINISH ? remaining[index] : work;
+            result.processes[index].service_time += state.run_time;
+            decayUtilization(state, duration, 1.0);
+
+            if (state.end == SegmentEnd::TICK) {
+                remaining[index] -= work;
+                state.slice_left -= state.run_time;
+                startSegment(c, 0.0);
+                continue;
+            }
+            if (state.end == SegmentEnd::FINISH) {
+                remaining[index] = 0.0;
+                ProcessRunRecord& record = result.processes[index];
+                record.completion_time = now;
+                record.completion_core = cores_[c].id;
+                record.completion_class = cores_[c].core_class;
+                completed++;
+            } else {
+                remaining[index] -= work;
+                expired.push_back(index);
+            }
+            state.busy = false;
+            state.idle_since = now;
+            idle[c] = true;
+            idle_count++;
+        }
+        while (next_arrival < count && processes[arrivals[next_arrival]].getArrivalTime() <= now) {
+            makeReady(arrivals[next_arrival++]);
+        }
+        for (size_t index : expired) {
+            makeReady(index);
+        }
+    }
+
+    // 汇总统计
+    result.makespan = now;
+    for (size_t c = 0; c < core_count; ++c) {
+        accountIdle(c, result.makespan - states[c].idle_since);
+    }
+
+    double total_waiting = 0.0;
+    double total_turnaround = 0.0;
+    double total_response = 0.0;
+    for (auto& record : result.processes) {
+        record.turnaround_time = record.completion_time - record.arrival_time;
+        record.waiting_time = record.turnaround_time - record.service_time;
+        total_waiting += record.waiting_time;
+        total_turnaround += record.turnaround_time;
+        total_response += record.response_time;
+    }
+    result.average_waiting_time = total_waiting / count;
+    result.average_turnaround_time = total_turnaround / count;
+    result.average_response_time = total_response / count;
+    result.throughput = result.makespan > 0 ? count / result.makespan : 0.0;
+
+    double total_busy = 0.0;
+    double total_work = 0.0;
+    for (auto& core : result.cores) {
+        core.utilization = result.makespan > 0 ? core.busy_time / result.makespan * 100.0 : 0.0;
+        total_busy += core.busy_time;
+        total_work += core.work_done;
+        result.energy += core.energy;
+    }
+    result.cpu_utilization = result.makespan > 0 ? total_busy / (result.makespan * core_count) * 100.0 : 0.0;
+    result.energy_delay_product = result.energy * result.makespan;
+    result.performance_per_watt = result.energy > 0 ? total_work / result.energy : 0.0;
+
+    for (const auto& core : result.cores) {
+        auto it = std::find_if(result.classes.begin(), result.classes.end(),
+                               [&core](const CoreClassReport& report) { return report.core_class == core.core_class; });
+        if (it == result.classes.end()) {
+            result.classes.push_back({core.core_class, 0, 0.0, 0.0, 0.0, 0.0, 0, 0.0, 0.0});
+            it = result.classes.end() - 1;
+        }
+        it->core_count++;
+        it->busy_time += core.busy_time;
+        it->work_done += core.work_done;
+        it->energy += core.energy;
+    }
+    for (const auto& record : result.processes) {
+        for (auto& report : result.classes) {
+            if (report.core_class == record.completion_class) {
+                report.completed++;
+                report.average_completion_time += record.completion_time;
+                report.average_turnaround_time += record.turnaround_time;
+                break;
+            }
+        }
+    }
+    for (auto& report : result.classes) {
+        report.utilization = result.makespan > 0 ? report.busy_time / (result.makespan * report.core_count) * 100.0 : 0.0;
+        if (report.completed > 0) {
+            report.average_completion_time /= report.completed;
+            report.average_turnaround_time /= report.completed;
+        }
+    }
+
+    return result;
+}
+
+// 打印调度结果
+void MultiCoreScheduler::displayResult(const MultiCoreResult& result) {
+    std::cout << "\n📊 多核调度结果统计：" << std::endl;
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "平均等待时间: " << result.average_waiting_time << " 时间单位" << std::endl;
+    std::cout << "平均周转时间: " << result.average_turnaround_time << " 时间单位" << std::endl;
+    std::cout << "平均响应时间: " << result.average_response_time << " 时间单位" << std::endl;
+    std::cout << "CPU利用率: " << result.cpu_utilization << "%" << std::endl;
+    std::cout << "吞吐率: " << result.throughput << " 进程/时间单位" << std::endl;
+    std::cout << "总执行时间: " << result.makespan << " 时间单位" << std::endl;
+    std::cout << "迁移次数: " << result.migrations << std::endl;
+    if (result.energy > 0) {
+        std::cout << "能耗: " << result.energy << std::endl;
+        std::cout << "能耗延迟积: " << result.energy_delay_product << std::endl;
+        std::cout << "能效: " << result.performance_per_watt << " 工作量/能耗" << std::endl;
+    }
+
+    std::cout << "\n🖥️  各核心：" << std::endl;
+    for (const auto& core : result.cores) {
+        std::cout << "  CPU" << std::setw(3) << std::left << core.core_id << std::right
+                  << " [" << core.core_class << " x" << core.speed << "]"
+                  << "  利用率 " << std::setw(6) << core.utilization << "%"
+                  << "  完成工作量 " << std::setw(8) << core.work_done
+                  << "  分派 " << core.dispatches << " 次"
+                  << "  能耗 " << core.energy << std::endl;
+        if (core.frequency_residency.size() > 1) {
+            std::cout << "         频率驻留:";
+            for (const auto& residency : core.frequency_residency) {
+                std::cout << " " << residency.first << "→" << residency.second;
+            }
+            std::cout << "  (切换 " << core.frequency_changes << " 次)" << std::endl;
+        }
+        std::cout << "         空闲驻留:";
+        for (const auto& residency : core.idle_residency) {
+            std::cout << " " << residency.first << "→" << residency.second;
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "\n🧩 各核心类别：" << std::endl;
+    for (const auto& report : result.classes) {
+        std::cout << "  " << std::setw(8) << std::left << report.core_class << std::right
+                  << " " << report.core_count << " 核"
+                  << "  利用率 " << std::setw(6) << report.utilization << "%"
+                  << "  能耗 " << std::setw(8) << report.energy
+                  << "  完成进程 " << std::setw(5) << report.completed
+                  << "  平均完成时间 " << std::setw(8) << report.average_completion_time
+                  << "  平均周转时间 " << report.average_turnaround_time << std::endl;
+    }
+}
+
+// 获取放置策略名称
+std::string MultiCoreScheduler::getPlacementPolicyName(PlacementPolicy placement) {
+    switch (placement) {
+        case PlacementPolicy::FASTEST_AVAILABLE:   return "最快空闲核心";
+        case PlacementPolicy::ENERGY_AWARE:        return "能耗感知";
+        case PlacementPolicy::AFFINITY_PRESERVING: return "亲和性保持";
+    }
+    return "未知";
+}
+
+// 获取频率调节器名称
+std::string MultiCoreScheduler::getGovernorName(FrequencyGovernor governor) {
+    switch (governor) {
+        case FrequencyGovernor::RACE_TO_IDLE: return "race-to-idle";
+        case FrequencyGovernor::ONDEMAND:     return "ondemand";
+        case FrequencyGovernor::SCHEDUTIL:    return "schedutil";
+    }
+    return "未知";
+}
+
+} // namespace ZTS_OS
@@ -0,0 +1,330 @@
+#include "../../include/algorithms/OnlineScheduler.h"
+#include <algorithm>
+#include <functional>
+#include <stdexcept>
+#include <climits>
+
+/**
+ * @file OnlineScheduler.cpp
+ * @brief 在线(增量)调度器实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+// 小顶堆比较器：键小者优先，键相同时句柄小者优先
+using MinHeapCompare = std::greater<std::pair<long long, size_t>>;
+
+// 根据算法类型生成调度器名称
+std::string onlineName(SchedulerFactory::SchedulerType type, bool preemptive) {
+    switch (type) {
+        case SchedulerFactory::SchedulerType::FCFS:        return "Online FCFS";
+        case SchedulerFactory::SchedulerType::ROUND_ROBIN: return "Online Round Robin";
+        case SchedulerFactory::SchedulerType::SJF:         return preemptive ? "Online SRTF" : "Online SJF";
+        case SchedulerFactory::SchedulerType::PRIORITY:    return preemptive ? "Online 抢占式优先级" : "Online 非抢占式优先级";
+    }
+    return "Online";
+}
+
+} // namespace
+
+// 构造函数
+OnlineScheduler::OnlineScheduler(SchedulerFactory::SchedulerType type, bool preemptive, int time_quantum)
+    : Scheduler(onlineName(type, preemptive), "在线调度器 - 支持增量提交进程并逐步推进时钟"),
+      type_(type),
+      preemptive_(preemptive && (type == SchedulerFactory::SchedulerType::SJF ||
+                                 type == SchedulerFactory::SchedulerType::PRIORITY)),
+      time_quantum_(time_quantum),
+      poll_cursor_(0), clock_(0), running_(-1), slice_left_(0), completed_count_(0), decisions_(0) {
+    if (time_quantum <= 0) {
+        throw std::invalid_argument("时间片大小必须大于0");
+    }
+}
+
+// 提交一个进程
+size_t OnlineScheduler::submit(const Process& process) {
+    if (process.getArrivalTime() < clock_) {
+        throw std::invalid_argument("进程到达时间不能早于当前时钟");
+    }
+
+    size_t index = processes_.size();
+    processes_.push_back(process);
+    processes_.back().reset();
+
+    pending_.emplace_back(process.getArrivalTime(), index);
+    std::push_heap(pending_.begin(), pending_.end(), MinHeapCompare());
+
+    return index;
+}
+
+// 修改一个尚未到达的进程
+bool OnlineScheduler::revise(size_t handle, const Process& process) {
+    if (handle >= processes_.size()) {
+        throw std::out_of_range("无效的进程句柄");
+    }
+    if (process.getArrivalTime() < clock_) {
+        throw std::invalid_argument("进程到达时间不能早于当前时钟");
+    }
+
+    auto it = std::find_if(pending_.begin(), pending_.end(),
+                           [handle](const HeapEntry& entry) { return entry.second == handle; });
+    if (it == pending_.end()) {
+        return false;
+    }
+
+    processes_[handle] = process;
+    processes_[handle].reset();
+    it->first = process.getArrivalTime();
+    std::make_heap(pending_.begin(), pending_.end(), MinHeapCompare());
+    return true;
+}
+
+// 推进模拟时钟到指定时刻
+void OnlineScheduler::advanceTo(int time) {
+    if (time < clock_) {
+        throw std::invalid_argument("目标时刻不能早于当前时钟");
+    }
+    simulate(time, false);
+}
+
+// 运行直到系统空闲
+int OnlineScheduler::runUntilIdle() {
+    simulate(INT_MAX, true);
+    return clock_;
+}
+
+// 取出自上次调用以来完成的进程
+std::vector<Process> OnlineScheduler::pollCompletions() {
+    std::vector<Process> completed;
+    completed.reserve(completions_.size() - poll_cursor_);
+    for (; poll_cursor_ < completions_.size(); ++poll_cursor_) {
+        completed.push_back(processes_[completions_[poll_cursor_]]);
+    }
+    return completed;
+}
+
+// 清空全部状态
+void OnlineScheduler::clear() {
+    processes_.clear();
+    pending_.clear();
+    fifo_.clear();
+    ready_heap_.clear();
+    completions_.clear();
+    poll_cursor_ = 0;
+    clock_ = 0;
+    running_ = -1;
+    slice_left_ = 0;
+    completed_count_ = 0;
+    decisions_ = 0;
+}
+
+// 系统是否空闲
+bool OnlineScheduler::isIdle() const {
+    return completed_count_ == processes_.size();
+}
+
+// 按当前已完成的进程计算统计结果
+SchedulingResult OnlineScheduler::getResult() const {
+    SchedulingResult result = calculateStatistics(processes_, clock_);
+    result.scheduling_decisions = decisions_;
+    return result;
+}
+
+// 批处理接口
+SchedulingResult OnlineScheduler::schedule(const ProcessList& processes) {
+    validateProcesses(processes);
+
+    clear();
+    processes_.reserve(processes.size());
+    pending_.reserve(processes.size());
+    for (const auto& process : processes) {
+        submit(process);
+    }
+    runUntilIdle();
+
+    return getResult();
+}
+
+// 获取算法类型
+std::string OnlineScheduler::getAlgorithmType() const {
+    switch (type_) {
+        case SchedulerFactory::SchedulerType::FCFS:
+            return "在线先来先服务 (Online FCFS)";
+        case SchedulerFactory::SchedulerType::ROUND_ROBIN:
+            return "在线时间片轮转 (Online Round Robin)";
+        case SchedulerFactory::SchedulerType::SJF:
+            return preemptive_ ? "在线最短剩余时间优先 (Online SRTF)" : "在线最短作业优先 (Online SJF)";
+        case SchedulerFactory::SchedulerType::PRIORITY:
+            return preemptive_ ? "在线抢占式优先级调度 (Online Preemptive Priority)"
+                               : "在线非抢占式优先级调度 (Online Non-Preemptive Priority)";
+    }
+    return "未知";
+}
+
+// 是否为抢占式调度
+bool OnlineScheduler::isPreemptive() const {
+    return preemptive_ || type_ == SchedulerFactory::SchedulerType::ROUND_ROBIN;
+}
+
+// 是否使用FIFO就绪队列
+bool OnlineScheduler::usesFifo() const {
+    return type_ == SchedulerFactory::SchedulerType::FCFS ||
+           type_ == SchedulerFactory::SchedulerType::ROUND_ROBIN;
+}
+
+// 计算进程在就绪堆中的排序键
+long long OnlineScheduler::readyKey(size_t index) const {
+    const Process& process = processes_[index];
+    if (type_ == SchedulerFactory::SchedulerType::PRIORITY) {
+        return static_cast<int>(process.getPriority());
+    }
+    // SJF按总执行时间，SRTF按剩余时间
+    return preemptive_ ? process.getRemainingTime() : process.getBurstTime();
+}
+
+// 将进程放入就绪结构
+void OnlineScheduler::pushReady(size_t index) {
+    processes_[index].setState(ProcessState::READY);
+    if (usesFifo()) {
+        fifo_.push_back(index);
+    } else {
+        ready_heap_.emplace_back(readyKey(index), index);
+        std::push_heap(ready_heap_.begin(), ready_heap_.end(), MinHeapCompare());
+    }
+}
+
+// 从就绪结构取出下一个进程
+size_t OnlineScheduler::popReady() {
+    size_t index;
+    if (usesFifo()) {
+        index = fifo_.front();
+        fifo_.pop_front();
+    } else {
+        std::pop_heap(ready_heap_.begin(), ready_heap_.end(), MinHeapCompare());
+        index = ready_heap_.back().second;
+        ready_heap_.pop_back();
+    }
+    return index;
+}
+
+// 将已到达的进程移入就绪结构
+void OnlineScheduler::admitArrivals() {
+    while (!pending_.empty() && pending_.front().first <= clock_) {
+        std::pop_heap(pending_.begin(), pending_.end(), MinHeapCompare());
+        size_t index = pending_.back().second;
+        pending_.pop_back();
+        pushReady(index);
+    }
+}
+
+// 抢占式策略下检查是否有更优的就绪进程
+bool OnlineScheduler::shouldPreempt() const {
+    if (ready_heap_.empty()) {
+        return false;
+    }
+    HeapEntry current(readyKey(static_cast<size_t>(running_)), static_cast<size_t>(running_));
+    return ready_heap_.front() < current;
+}
+
+// 让下一个就绪进程上CPU
+void OnlineScheduler::dispatch() {
+    running_ = static_cast<int>(popReady());
+    Process& process = processes_[running_];
+
+    if (process.isFirstRun()) {
+        process.setStartTime(clock_);
+        process.setResponseTime(clock_ - process.getArrivalTime());
+        process.setFirstRun(false);
+    }
+    process.setState(ProcessState::RUNNING);
+    slice_left_ = time_quantum_;
+    decisions_++;
+}
+
+// 将当前进程放回就绪结构
+void OnlineScheduler::requeueRunning() {
+    pushReady(static_cast<size_t>(running_));
+    running_ = -1;
+}
+
+// 处理当前进程的完成
+void OnlineScheduler::completeRunning() {
+    Process& process = processes_[running_];
+    process.setState(ProcessState::TERMINATED);
+    process.setCompletionTime(clock_);
+    process.calculateTimes(clock_);
+
+    completions_.push_back(static_cast<size_t>(running_));
+    completed_count_++;
+    running_ = -1;
+}
+
+// 模拟到指定时刻
+void OnlineScheduler::simulate(int limit, bool stop_when_idle) {
+    const bool round_robin = type_ == SchedulerFactory::SchedulerType::ROUND_ROBIN;
+
+    while (true) {
+        admitArrivals();
+
+        if (running_ != -1 && preemptive_ && shouldPreempt()) {
+            requeueRunning();
+        }
+
+        if (running_ == -1) {
+            if (getReadyCount() == 0) {
+                // CPU空闲：跳到下一个到达时刻或目标时刻
+                if (pending_.empty()) {
+                    if (!stop_when_idle) {
+                        clock_ = std::max(clock_, limit);
+                    }
+                    return;
+                }
+                int next_arrival = static_cast<int>(pending_.front().first);
+                if (next_arrival > limit) {
+                    clock_ = limit;
+                    return;
+                }
+                clock_ = next_arrival;
+                continue;
+            }
+            if (clock_ >= limit) {
+                // 到达目标时刻后不再派发，同一时刻可能还有进程提交
+                return;
+            }
+            dispatch();
+        }
+
+        // 运行到完成、时间片用完、下一个可能抢占的到达或目标时刻中最早者
+        Process& process = processes_[running_];
+        long long run_time = process.getRemainingTime();
+        if (round_robin) {
+            run_time = std::min<long long>(run_time, slice_left_);
+        }
+        if (preemptive_ && !pending_.empty()) {
+            run_time = std::min<long long>(run_time, pending_.front().first - clock_);
+        }
+        run_time = std::min<long long>(run_time, static_cast<long long>(limit) - clock_);
+        if (run_time <= 0) {
+            return;
+        }
+
+        process.execute(static_cast<int>(run_time));
+        clock_ += static_cast<int>(run_time);
+        slice_left_ -= static_cast<int>(run_time);
+
+        if (process.isCompleted()) {
+            completeRunning();
+        } else if (round_robin && slice_left_ <= 0) {
+            // 时间片用完：先接纳新到达的进程，再回到队尾
+            admitArrivals();
+            requeueRunning();
+        } else {
+            process.setState(ProcessState::RUNNING);
+        }
+    }
+}
+
+} // namespace ZTS_OS
@@ -1,4 +1,9 @@
 #include "../../include/algorithms/Scheduler.h"
+#include "../../include/algorithms/FCFSScheduler.h"
+#include "../../include/algorithms/RoundRobinScheduler.h"
+#include "../../include/algorithms/SJFScheduler.h"
+#include "../../include/algorithms/PriorityScheduler.h"
+#include "../../include/algorithms/SchedulerWorkspace.h"
 #include <iostream>
 #include <iomanip>
 #include <algorithm>
@@ -15,7 +20,24 @@ namespace ZTS_OS {
 
 // 构造函数
 Scheduler::Scheduler(const std::string& name, const std::string& description)
-    : name_(name), description_(description) {
+    : name_(name), description_(description), trace_enabled_(true),
+      active_power_(0.0), idle_power_(0.0) {
+}
+
+// 设置单CPU功耗模型
+void Scheduler::setPowerModel(double active_power, double idle_power) {
+    if (active_power < 0 || idle_power < 0) {
+        throw std::invalid_argument("功率不能为负数");
+    }
+    active_power_ = active_power;
+    idle_power_ = idle_power;
+}
+
+// 获取调度过程跟踪输出流
+std::ostream& Scheduler::trace() const {
+    // 没有缓冲区的流处于badbit状态，所有输出操作都会被直接跳过
+    static std::ostream null_stream(nullptr);
+    return trace_enabled_ ? std::cout : null_stream;
 }
 
 // 显示调度器信息
@@ -43,6 +65,10 @@ void Scheduler::displayResult(const SchedulingResult& result) {
     std::cout << "CPU利用率: " << result.cpu_utilization << "%" << std::endl;
     std::cout << "吞吐率: " << result.throughput << " 进程/时间单位" << std::endl;
     std::cout << "总执行时间: " << result.total_time << " 时间单位" << std::endl;
+    if (result.energy > 0) {
+        std::cout << "能耗: " << result.energy << std::endl;
+        std::cout << "能耗延迟积: " << result.energy_delay_product << std::endl;
+    }
     
     // 显示进程详细信息
     displayStatistics(result);
@@ -88,11 +114,32 @@ void Scheduler::displayGanttChart(const SchedulingResult& result) {
     std::cout << std::endl;
 }
 
+// 使用可复用的工作区执行调度
+const SchedulingResult& Scheduler::scheduleInto(const ProcessList& processes, SchedulerWorkspace& workspace) {
+    workspace.result = schedule(processes);
+    return workspace.result;
+}
+
 // 计算调度结果统计信息
 SchedulingResult Scheduler::calculateStatistics(const ProcessList& processes, int total_time) const {
     SchedulingResult result;
     result.processes = processes;
+    fillStatistics(result, total_time);
+    return result;
+}
+
+// 按result.processes就地计算统计信息
+void Scheduler::fillStatistics(SchedulingResult& result, int total_time) const {
+    const ProcessList& processes = result.processes;
+    result.average_waiting_time = 0;
+    result.average_turnaround_time = 0;
+    result.average_response_time = 0;
+    result.cpu_utilization = 0;
+    result.throughput = 0;
     result.total_time = total_time;
+    result.scheduling_decisions = 0;
+    result.energy = 0;
+    result.energy_delay_product = 0;
     
     double total_waiting_time = 0;
     double total_turnaround_time = 0;
@@ -120,9 +167,12 @@ SchedulingResult Scheduler::calculateStatistics(const ProcessList& processes, in
             total_burst_time += process.getBurstTime();
         }
         result.cpu_utilization = (static_cast<double>(total_burst_time) / total_time) * 100.0;
+        
+        // 单CPU能耗：运行时间按运行功率，其余时间按空闲功率
+        double idle_time = std::max(0, total_time - total_burst_time);
+        result.energy = total_burst_time * active_power_ + idle_time * idle_power_;
+        result.energy_delay_product = result.energy * total_time;
     }
-    
-    return result;
 }
 
 // 验证进程列表
@@ -160,4 +210,42 @@ int Scheduler::findNextProcess(const ProcessList& processes, int current_time) c
     return -1;
 }
 
-} // namespace ZTS_OS 
\ No newline at end of file
+// ==================== SchedulerFactory ====================
+
+// 创建调度器
+SchedulerPtr SchedulerFactory::createScheduler(SchedulerType type, int time_quantum) {
+    switch (type) {
+        case SchedulerType::FCFS:
+            return std::make_unique<FCFSScheduler>();
+        case SchedulerType::ROUND_ROBIN:
+            return std::make_unique<RoundRobinScheduler>(time_quantum);
+        case SchedulerType::SJF:
+            return std::make_unique<SJFScheduler>(false);
+        case SchedulerType::PRIORITY:
+            return std::make_unique<PriorityScheduler>(false);
+    }
+    throw std::invalid_argument("未知的调度器类型");
+}
+
+// 获取调度器类型名称
+std::string SchedulerFactory::getSchedulerTypeName(SchedulerType type) {
+    switch (type) {
+        case SchedulerType::FCFS:        return "FCFS";
+        case SchedulerType::ROUND_ROBIN: return "Round Robin";
+        case SchedulerType::SJF:         return "SJF";
+        case SchedulerType::PRIORITY:    return "Priority";
+    }
+    return "Unknown";
+}
+
+// 获取所有可用的调度器类型
+std::vector<SchedulerFactory::SchedulerType> SchedulerFactory::getAvailableTypes() {
+    return {
+        SchedulerType::FCFS,
+        SchedulerType::ROUND_ROBIN,
+        SchedulerType::SJF,
+        SchedulerType::PRIORITY
+    };
+}
+
+} // namespace ZTS_OS
\ No newline at end of file
@@ -0,0 +1,431 @@
+#include "../../include/algorithms/SchedulerCheckpoint.h"
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @file SchedulerCheckpoint.cpp
+ * @brief 调度器状态的二进制检查点与恢复实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+const char kCheckpointMagic[8] = {'Z', 'T', 'S', 'C', 'K', 'P', 'T', '\0'};
+const uint32_t kCheckpointVersion = 2;
+
+// 文件头；各段依次为：进程记录、待到达堆、就绪队列、完成序列、名称区
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t type;
+    uint32_t preemptive;
+    int32_t time_quantum;
+    int32_t clock;
+    int32_t running;
+    int32_t slice_left;
+    uint32_t reserved;
+    uint64_t process_count;
+    uint64_t pending_count;
+    uint64_t ready_count;
+    uint64_t completion_count;
+    uint64_t poll_cursor;
+    uint64_t completed_count;
+    uint64_t names_size;
+    uint64_t decisions;
+};
+
+// 每个进程的计数器
+struct ProcessRecord {
+    int32_t pid;
+    int32_t arrival_time;
+    int32_t burst_time;
+    int32_t remaining_time;
+    int32_t waiting_time;
+    int32_t turnaround_time;
+    int32_t response_time;
+    int32_t start_time;
+    int32_t completion_time;
+    uint8_t state;
+    uint8_t priority;
+    uint8_t first_run;
+    uint8_t reserved;
+    uint32_t name_length;
+    uint32_t reserved2;
+    uint64_t name_offset;
+};
+
+// 堆/队列元素；FIFO就绪队列的键恒为0
+struct EntryRecord {
+    int64_t key;
+    uint64_t index;
+};
+
+static_assert(sizeof(CheckpointHeader) % 8 == 0, "检查点头部必须8字节对齐");
+static_assert(sizeof(ProcessRecord) % 8 == 0, "进程记录必须8字节对齐");
+static_assert(sizeof(EntryRecord) % 8 == 0, "堆元素记录必须8字节对齐");
+
+// 从映射内存中读取一条记录（不要求对齐）
+template <typename T>
+T readRecord(const char* base, size_t index) {
+    T record;
+    std::memcpy(&record, base + index * sizeof(T), sizeof(T));
+    return record;
+}
+
+// 各段是否恰好铺满文件头之后的数据：逐段与剩余字节数比较，计数再大也不会溢出
+bool sectionsMatchSize(const CheckpointHeader& header, size_t size) {
+    const std::pair<uint64_t, uint64_t> sections[] = {
+        {header.process_count, sizeof(ProcessRecord)},
+        {header.pending_count, sizeof(EntryRecord)},
+        {header.ready_count, sizeof(EntryRecord)},
+        {header.completion_count, sizeof(uint64_t)},
+        {header.names_size, 1}
+    };
+    uint64_t remaining = size - sizeof(CheckpointHeader);
+    for (const auto& section : sections) {
+        if (section.first > remaining / section.second) {
+            return false;
+        }
+        remaining -= section.first * section.second;
+    }
+    return remaining == 0;
+}
+
+// 读取并校验文件头
+CheckpointHeader readHeader(const char* data, size_t size) {
+    if (data == nullptr || size < sizeof(CheckpointHeader)) {
+        throw std::runtime_error("检查点数据过短");
+    }
+    CheckpointHeader header = readRecord<CheckpointHeader>(data, 0);
+    if (std::memcmp(header.magic, kCheckpointMagic, sizeof(kCheckpointMagic)) != 0) {
+        throw std::runtime_error("不是有效的调度器检查点");
+    }
+    if (header.version != kCheckpointVersion) {
+        throw std::runtime_error("不支持的检查点版本");
+    }
+    if (!sectionsMatchSize(header, size)) {
+        throw std::runtime_error("检查点数据长度不匹配，文件可能已损坏");
+    }
+    return header;
+}
+
+} // namespace
+
+// ==================== MappedFile ====================
+
+#ifdef _WIN32
+
+// 构造函数（Windows）
+MappedFile::MappedFile(const std::string& path)
+    : data_(nullptr), size_(0), file_handle_(INVALID_HANDLE_VALUE), mapping_handle_(nullptr) {
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        throw std::runtime_error("无法打开检查点文件: " + path);
+    }
+    file_handle_ = file;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        CloseHandle(file);
+        throw std::runtime_error("检查点文件为空: " + path);
+    }
+    size_ = static_cast<size_t>(file_size.QuadPart);
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        CloseHandle(file);
+        throw std::runtime_error("无法映射检查点文件: " + path);
+    }
+    mapping_handle_ = mapping;
+
+    data_ = static_cast<const char*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+    if (data_ == nullptr) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        throw std::runtime_error("无法映射检查点文件: " + path);
+    }
+}
+
+// 析构函数（Windows）
+MappedFile::~MappedFile() {
+    UnmapViewOfFile(data_);
+    CloseHandle(static_cast<HANDLE>(mapping_handle_));
+    CloseHandle(static_cast<HANDLE>(file_handle_));
+}
+
+#else
+
+// 构造函数（POSIX）
+MappedFile::MappedFile(const std::string& path)
+    : data_(nullptr), size_(0), fd_(-1) {
+    fd_ = ::open(path.c_str(), O_RDONLY);
+    if (fd_ < 0) {
+        throw std::runtime_error("无法打开检查点文件: " + path);
+    }
+
+    struct stat st;
+    if (::fstat(fd_, &st) != 0 || st.st_size == 0) {
+        ::close(fd_);
+        throw std::runtime_error("检查点文件为空: " + path);
+    }
+    size_ = static_cast<size_t>(st.st_size);
+
+    void* address = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd_, 0);
+    if (address == MAP_FAILED) {
+        ::close(fd_);
+        throw std::runtime_error("无法映射检查点文件: " + path);
+    }
+    ::madvise(address, size_, MADV_SEQUENTIAL);
+    data_ = static_cast<const char*>(address);
+}
+
+// 析构函数（POSIX）
+MappedFile::~MappedFile() {
+    ::munmap(const_cast<char*>(data_), size_);
+    ::close(fd_);
+}
+
+#endif
+
+// ==================== SchedulerCheckpoint ====================
+
+// 将调度器状态序列化到内存缓冲区
+SchedulerCheckpoint::Buffer SchedulerCheckpoint::capture(const OnlineScheduler& scheduler) {
+    CheckpointHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, kCheckpointMagic, sizeof(kCheckpointMagic));
+    header.version = kCheckpointVersion;
+    header.type = static_cast<uint32_t>(scheduler.type_);
+    header.preemptive = scheduler.preemptive_ ? 1 : 0;
+    header.time_quantum = scheduler.time_quantum_;
+    header.clock = scheduler.clock_;
+    header.running = scheduler.running_;
+    header.slice_left = scheduler.slice_left_;
+    header.process_count = scheduler.processes_.size();
+    header.pending_count = scheduler.pending_.size();
+    header.ready_count = scheduler.getReadyCount();
+    header.completion_count = scheduler.completions_.size();
+    header.poll_cursor = scheduler.poll_cursor_;
+    header.completed_count = scheduler.completed_count_;
+    header.decisions = static_cast<uint64_t>(scheduler.decisions_);
+    for (const auto& process : scheduler.processes_) {
+        header.names_size += process.getName().size();
+    }
+
+    Buffer buffer(sizeof(CheckpointHeader) +
+                  scheduler.processes_.size() * sizeof(ProcessRecord) +
+                  (scheduler.pending_.size() + header.ready_count) * sizeof(EntryRecord) +
+                  scheduler.completions_.size() * sizeof(uint64_t) +
+                  header.names_size);
+    char* out = buffer.data();
+    std::memcpy(out, &header, sizeof(header));
+    out += sizeof(header);
+
+    // 进程记录，名称统一放在末尾的名称区
+    char* names = buffer.data() + buffer.size() - header.names_size;
+    uint64_t name_offset = 0;
+    for (const auto& process : scheduler.processes_) {
+        const std::string& name = process.getName();
+        ProcessRecord record;
+        std::memset(&record, 0, sizeof(record));
+        record.pid = process.getPID();
+        record.arrival_time = process.getArrivalTime();
+        record.burst_time = process.getBurstTime();
+        record.remaining_time = process.getRemainingTime();
+        record.waiting_time = process.getWaitingTime();
+        record.turnaround_time = process.getTurnaroundTime();
+        record.response_time = process.getResponseTime();
+        record.start_time = process.getStartTime();
+        record.completion_time = process.getCompletionTime();
+        record.state = static_cast<uint8_t>(process.getState());
+        record.priority = static_cast<uint8_t>(process.getPriority());
+        record.first_run = process.isFirstRun() ? 1 : 0;
+        record.name_length = static_cast<uint32_t>(name.size());
+        record.name_offset = name_offset;
+        std::memcpy(out, &record, sizeof(record));
+        out += sizeof(record);
+
+        std::memcpy(names + name_offset, name.data(), name.size());
+        name_offset += name.size();
+    }
+
+    // 待到达堆按数组原样保存，恢复后无需重新建堆
+    for (const auto& entry : scheduler.pending_) {
+        EntryRecord record = {entry.first, entry.second};
+        std::memcpy(out, &record, sizeof(record));
+        out += sizeof(record);
+    }
+
+    // 就绪结构：FIFO按队列顺序保存，堆按数组原样保存
+    for (size_t index : scheduler.fifo_) {
+        EntryRecord record = {0, index};
+        std::memcpy(out, &record, sizeof(record));
+        out += sizeof(record);
+    }
+    for (const auto& entry : scheduler.ready_heap_) {
+        EntryRecord record = {entry.first, entry.second};
+        std::memcpy(out, &record, sizeof(record));
+        out += sizeof(record);
+    }
+
+    for (size_t index : scheduler.completions_) {
+        uint64_t value = index;
+        std::memcpy(out, &value, sizeof(value));
+        out += sizeof(value);
+    }
+
+    return buffer;
+}
+
+// 从内存中的检查点恢复调度器状态
+void SchedulerCheckpoint::restore(OnlineScheduler& scheduler, const char* data, size_t size) {
+    CheckpointHeader header = readHeader(data, size);
+    if (header.type != static_cast<uint32_t>(scheduler.type_) ||
+        (header.preemptive != 0) != scheduler.preemptive_ ||
+        header.time_quantum != scheduler.time_quantum_) {
+        throw std::runtime_error("检查点的调度算法配置与当前调度器不一致");
+    }
+
+    const uint64_t process_count = header.process_count;
+    if (header.running < -1 || (header.running >= 0 && static_cast<uint64_t>(header.running) >= process_count) ||
+        header.poll_cursor > header.completion_count || header.completed_count > process_count) {
+        throw std::runtime_error("检查点数据已损坏");
+    }
+
+    const char* process_base = data + sizeof(CheckpointHeader);
+    const char* pending_base = process_base + process_count * sizeof(ProcessRecord);
+    const char* ready_base = pending_base + header.pending_count * sizeof(EntryRecord);
+    const char* completion_base = ready_base + header.ready_count * sizeof(EntryRecord);
+    const char* names = completion_base + header.completion_count * sizeof(uint64_t);
+
+    auto checkIndex = [process_count](uint64_t index) {
+        if (index >= process_count) {
+            throw std::runtime_error("检查点数据已损坏");
+        }
+        return static_cast<size_t>(index);
+    };
+
+    // 先在临时对象中重建，全部成功后再替换，避免半途失败破坏原状态
+    ProcessList processes;
+    processes.reserve(process_count);
+    for (uint64_t i = 0; i < process_count; ++i) {
+        ProcessRecord record = readRecord<ProcessRecord>(process_base, i);
+        // 写成不会回绕的形式：name_offset接近2^64时相加会溢出而绕过检查
+        if (record.name_length > header.names_size ||
+            record.name_offset > header.names_size - record.name_length ||
+            record.priority < static_cast<uint8_t>(ProcessPriority::HIGHEST) ||
+            record.priority > static_cast<uint8_t>(ProcessPriority::LOWEST) ||
+            record.state > static_cast<uint8_t>(ProcessState::TERMINATED)) {
+            throw std::runtime_error("检查点数据已损坏");
+        }
+
+        processes.emplace_back(record.pid,
+                               std::string(names + record.name_offset, record.name_length),
+                               record.arrival_time, record.burst_time,
+                               static_cast<ProcessPriority>(record.priority));
+        Process& process = processes.back();
+        process.setState(static_cast<ProcessState>(record.state));
+        process.setRemainingTime(record.remaining_time);
+        process.setWaitingTime(record.waiting_time);
+        process.setTurnaroundTime(record.turnaround_time);
+        process.setResponseTime(record.response_time);
+        process.setStartTime(record.start_time);
+        process.setCompletionTime(record.completion_time);
+        process.setFirstRun(record.first_run != 0);
+    }
+
+    std::vector<OnlineScheduler::HeapEntry> pending;
+    pending.reserve(header.pending_count);
+    for (uint64_t i = 0; i < header.pending_count; ++i) {
+        EntryRecord record = readRecord<EntryRecord>(pending_base, i);
+        pending.emplace_back(record.key, checkIndex(record.index));
+    }
+
+    std::deque<size_t> fifo;
+    std::vector<OnlineScheduler::HeapEntry> ready_heap;
+    if (scheduler.usesFifo()) {
+        for (uint64_t i = 0; i < header.ready_count; ++i) {
+            fifo.push_back(checkIndex(readRecord<EntryRecord>(ready_base, i).index));
+        }
+    } else {
+        ready_heap.reserve(header.ready_count);
+        for (uint64_t i = 0; i < header.ready_count; ++i) {
+            EntryRecord record = readRecord<EntryRecord>(ready_base, i);
+            ready_heap.emplace_back(record.key, checkIndex(record.index));
+        }
+    }
+
+    std::vector<size_t> completions;
+    completions.reserve(header.completion_count);
+    for (uint64_t i = 0; i < header.completion_count; ++i) {
+        completions.push_back(checkIndex(readRecord<uint64_t>(completion_base, i)));
+    }
+
+    scheduler.processes_ = std::move(processes);
+    scheduler.pending_ = std::move(pending);
+    scheduler.fifo_ = std::move(fifo);
+    scheduler.ready_heap_ = std::move(ready_heap);
+    scheduler.completions_ = std::move(completions);
+    scheduler.poll_cursor_ = static_cast<size_t>(header.poll_cursor);
+    scheduler.clock_ = header.clock;
+    scheduler.running_ = header.running;
+    scheduler.slice_left_ = header.slice_left;
+    scheduler.completed_count_ = static_cast<size_t>(header.completed_count);
+    scheduler.decisions_ = static_cast<long long>(header.decisions);
+}
+
+// 保存检查点到文件
+void SchedulerCheckpoint::save(const OnlineScheduler& scheduler, const std::string& path) {
+    Buffer buffer = capture(scheduler);
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out) {
+        throw std::runtime_error("无法创建检查点文件: " + path);
+    }
+    out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    if (!out) {
+        throw std::runtime_error("写入检查点文件失败: " + path);
+    }
+}
+
+// 通过内存映射从文件恢复调度器状态
+void SchedulerCheckpoint::load(OnlineScheduler& scheduler, const std::string& path) {
+    MappedFile file(path);
+    restore(scheduler, file.data(), file.size());
+}
+
+// 通过内存映射从文件创建并恢复调度器
+std::unique_ptr<OnlineScheduler> SchedulerCheckpoint::load(const std::string& path) {
+    MappedFile file(path);
+    auto scheduler = createFor(file.data(), file.size());
+    restore(*scheduler, file.data(), file.size());
+    return scheduler;
+}
+
+// 按检查点头部创建调度器
+std::unique_ptr<OnlineScheduler> SchedulerCheckpoint::createFor(const char* data, size_t size) {
+    CheckpointHeader header = readHeader(data, size);
+    if (header.type > static_cast<uint32_t>(SchedulerFactory::SchedulerType::PRIORITY)) {
+        throw std::runtime_error("检查点中的调度算法类型未知");
+    }
+    return std::make_unique<OnlineScheduler>(
+        static_cast<SchedulerFactory::SchedulerType>(header.type),
+        header.preemptive != 0, header.time_quantum);
+}
+
+} // namespace ZTS_OS
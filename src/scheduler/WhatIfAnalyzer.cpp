@@ -0,0 +1,282 @@
+#include "../../include/algorithms/WhatIfAnalyzer.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @file WhatIfAnalyzer.cpp
+ * @brief 基于自动检查点的增量假设分析实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 构造函数
+WhatIfAnalyzer::WhatIfAnalyzer(SchedulerFactory::SchedulerType type, bool preemptive,
+                               int time_quantum, int checkpoint_interval)
+    : type_(type), preemptive_(preemptive), time_quantum_(time_quantum),
+      checkpoint_interval_(checkpoint_interval),
+      work_(type, preemptive, time_quantum), has_baseline_(false), arrival_cursor_(0) {
+    if (checkpoint_interval <= 0) {
+        throw std::invalid_argument("检查点间隔必须大于0");
+    }
+}
+
+// 运行基线模拟并保存自动检查点
+const SchedulingResult& WhatIfAnalyzer::runBaseline(const ProcessList& processes) {
+    if (processes.empty()) {
+        throw std::invalid_argument("进程列表不能为空");
+    }
+    for (const auto& process : processes) {
+        if (process.getArrivalTime() < 0) {
+            throw std::invalid_argument("进程到达时间不能为负数");
+        }
+        if (process.getBurstTime() <= 0) {
+            throw std::invalid_argument("进程执行时间必须大于0");
+        }
+    }
+
+    OnlineScheduler baseline(type_, preemptive_, time_quantum_);
+    for (const auto& process : processes) {
+        baseline.submit(process);
+    }
+
+    // 初始检查点：尚未接纳任何进程
+    checkpoints_.clear();
+    checkpoints_.push_back(captureLive(baseline, -1));
+
+    while (!baseline.isIdle()) {
+        baseline.advanceTo(baseline.getCurrentTime() + checkpoint_interval_);
+        if (baseline.isIdle()) {
+            break;
+        }
+        checkpoints_.push_back(captureLive(baseline, baseline.getCurrentTime()));
+    }
+
+    // 时钟可能越过最后一次完成，总时间以最后完成时刻为准
+    baseline.clock_ = lastCompletion(baseline.processes_);
+
+    trace_ = processes;
+    baseline_final_ = baseline.processes_;
+    baseline_result_ = baseline.getResult();
+    has_baseline_ = true;
+
+    arrival_order_.clear();
+    arrival_order_.reserve(processes.size());
+    for (size_t i = 0; i < processes.size(); ++i) {
+        arrival_order_.emplace_back(processes[i].getArrivalTime(), i);
+    }
+    std::sort(arrival_order_.begin(), arrival_order_.end());
+
+    // 工作调度器的进程表从基线终值开始，之后每次查询只撤销自己改写过的表项
+    work_.clear();
+    work_.processes_ = baseline_final_;
+    touched_.clear();
+
+    return baseline_result_;
+}
+
+// 修改一个作业并增量重新模拟
+WhatIfResult WhatIfAnalyzer::query(size_t job_index, const Process& modified) {
+    if (!has_baseline_) {
+        throw std::logic_error("必须先运行基线模拟");
+    }
+    if (job_index >= trace_.size()) {
+        throw std::out_of_range("作业下标超出范围");
+    }
+    // Process的构造函数已经拒绝这些值，这里再检查一次，保证下面的检查点查找不会越界
+    if (modified.getArrivalTime() < 0) {
+        throw std::invalid_argument("进程到达时间不能为负数");
+    }
+    if (modified.getBurstTime() <= 0) {
+        throw std::invalid_argument("进程执行时间必须大于0");
+    }
+
+    // 找到该作业（原到达时间与新到达时间中较早者）之前最近的检查点
+    const int earliest_arrival = std::min(trace_[job_index].getArrivalTime(), modified.getArrivalTime());
+    auto it = std::lower_bound(checkpoints_.begin(), checkpoints_.end(), earliest_arrival,
+                               [](const LiveCheckpoint& checkpoint, int time) {
+                                   return checkpoint.admitted_through < time;
+                               });
+    // 初始检查点的admitted_through为-1，到达时间非负时总能找到；仍然兜底到初始检查点
+    size_t start = it == checkpoints_.begin() ? 0 : static_cast<size_t>(it - checkpoints_.begin()) - 1;
+
+    WhatIfResult what_if;
+    what_if.restored_from = checkpoints_[start].clock;
+
+    restoreInto(checkpoints_[start]);
+    // 检查点在该作业到达之前，直接替换并放入待到达堆，原始记录在放入到达进程时跳过
+    work_.processes_[job_index] = modified;
+    work_.processes_[job_index].reset();
+    work_.pending_.emplace_back(modified.getArrivalTime(), job_index);
+    std::push_heap(work_.pending_.begin(), work_.pending_.end(),
+                   std::greater<OnlineScheduler::HeapEntry>());
+    touched_.push_back(job_index);
+
+    // 在后续检查点处比较运行状态，一致即可提前结束
+    size_t converged_index = start;
+    for (size_t i = start + 1; i < checkpoints_.size(); ++i) {
+        const LiveCheckpoint& reference = checkpoints_[i];
+        feedArrivals(reference.clock, job_index);
+        work_.advanceTo(reference.clock);
+        what_if.checkpoints_checked++;
+
+        if (!work_.processes_[job_index].isCompleted() ||
+            baseline_final_[job_index].getCompletionTime() > reference.clock) {
+            continue;
+        }
+
+        LiveCheckpoint current = captureLive(work_, reference.clock);
+        if (current.running == reference.running &&
+            current.slice_left == reference.slice_left &&
+            current.ready == reference.ready &&
+            current.live == reference.live) {
+            what_if.converged_at = reference.clock;
+            converged_index = i;
+            break;
+        }
+    }
+
+    if (what_if.converged_at >= 0) {
+        what_if.resimulated_until = what_if.converged_at;
+        mergeWithBaseline(checkpoints_[converged_index]);
+        // 收敛之后的决策与基线相同
+        work_.decisions_ += baseline_result_.scheduling_decisions - checkpoints_[converged_index].decisions;
+    } else {
+        feedArrivals(std::numeric_limits<long long>::max(), job_index);
+        work_.runUntilIdle();
+        what_if.resimulated_until = work_.clock_;
+    }
+
+    work_.clock_ = lastCompletion(work_.processes_);
+    what_if.result = work_.getResult();
+    return what_if;
+}
+
+// 采集调度器当前的活跃状态
+WhatIfAnalyzer::LiveCheckpoint WhatIfAnalyzer::captureLive(const OnlineScheduler& scheduler,
+                                                           int admitted_through) const {
+    LiveCheckpoint checkpoint;
+    checkpoint.clock = scheduler.clock_;
+    checkpoint.admitted_through = admitted_through;
+    checkpoint.running = scheduler.running_;
+    checkpoint.decisions = scheduler.decisions_;
+    checkpoint.completed = scheduler.completed_count_;
+    // 时间片剩余只对运行中的RR进程有意义，其余情况归一化为0以免误判
+    checkpoint.slice_left = (type_ == SchedulerFactory::SchedulerType::ROUND_ROBIN && scheduler.running_ != -1)
+                                ? scheduler.slice_left_ : 0;
+
+    if (scheduler.usesFifo()) {
+        checkpoint.ready.reserve(scheduler.fifo_.size());
+        for (size_t index : scheduler.fifo_) {
+            checkpoint.ready.emplace_back(0, index);
+        }
+    } else {
+        // 堆的数组布局与历史有关，出队顺序只取决于内容
+        checkpoint.ready = scheduler.ready_heap_;
+        std::sort(checkpoint.ready.begin(), checkpoint.ready.end());
+    }
+
+    checkpoint.live.reserve(checkpoint.ready.size() + 1);
+    auto addLive = [&](size_t index) {
+        const Process& process = scheduler.processes_[index];
+        checkpoint.live.push_back({index, process.getRemainingTime(), process.getStartTime(),
+                                   process.getResponseTime(), process.isFirstRun()});
+    };
+    for (const auto& entry : checkpoint.ready) {
+        addLive(entry.second);
+    }
+    if (scheduler.running_ != -1) {
+        addLive(static_cast<size_t>(scheduler.running_));
+    }
+    std::sort(checkpoint.live.begin(), checkpoint.live.end(),
+              [](const LiveProcess& a, const LiveProcess& b) { return a.index < b.index; });
+
+    return checkpoint;
+}
+
+// 把工作调度器恢复到指定检查点
+void WhatIfAnalyzer::restoreInto(const LiveCheckpoint& checkpoint) {
+    // 撤销上一次查询的改写，进程表回到基线终值：检查点前完成的进程本就是终值，
+    // 未到达的进程在放入待到达堆时才还原为初始状态
+    for (size_t index : touched_) {
+        work_.processes_[index] = baseline_final_[index];
+    }
+    touched_.clear();
+
+    work_.pending_.clear();
+    work_.fifo_.clear();
+    work_.ready_heap_.clear();
+    auto first_pending = std::upper_bound(arrival_order_.begin(), arrival_order_.end(),
+                                          OnlineScheduler::HeapEntry(checkpoint.admitted_through,
+                                                                     std::numeric_limits<size_t>::max()));
+    arrival_cursor_ = static_cast<size_t>(first_pending - arrival_order_.begin());
+
+    for (const auto& record : checkpoint.live) {
+        Process& process = work_.processes_[record.index];
+        process.reset();
+        process.setRemainingTime(record.remaining_time);
+        process.setStartTime(record.start_time);
+        process.setResponseTime(record.response_time);
+        process.setFirstRun(record.first_run);
+        process.setState(static_cast<int>(record.index) == checkpoint.running
+                             ? ProcessState::RUNNING : ProcessState::READY);
+        touched_.push_back(record.index);
+    }
+
+    if (work_.usesFifo()) {
+        for (const auto& entry : checkpoint.ready) {
+            work_.fifo_.push_back(entry.second);
+        }
+    } else {
+        // 按内容升序排列的数组本身就是合法的小顶堆
+        work_.ready_heap_ = checkpoint.ready;
+    }
+
+    // 查询只看进程表，完成顺序只记录恢复之后的部分
+    work_.completions_.clear();
+    work_.poll_cursor_ = 0;
+    work_.completed_count_ = checkpoint.completed;
+
+    work_.clock_ = checkpoint.clock;
+    work_.running_ = checkpoint.running;
+    work_.slice_left_ = checkpoint.slice_left;
+    work_.decisions_ = checkpoint.decisions;
+}
+
+// 放入到达时间不超过limit的进程
+void WhatIfAnalyzer::feedArrivals(long long limit, size_t skip) {
+    for (; arrival_cursor_ < arrival_order_.size() && arrival_order_[arrival_cursor_].first <= limit;
+         ++arrival_cursor_) {
+        size_t index = arrival_order_[arrival_cursor_].second;
+        if (index == skip) {
+            continue;
+        }
+        work_.processes_[index].reset();
+        work_.pending_.push_back(arrival_order_[arrival_cursor_]);
+        std::push_heap(work_.pending_.begin(), work_.pending_.end(),
+                       std::greater<OnlineScheduler::HeapEntry>());
+        touched_.push_back(index);
+    }
+}
+
+// 收敛后用基线终值补齐尚未完成的进程
+void WhatIfAnalyzer::mergeWithBaseline(const LiveCheckpoint& checkpoint) {
+    // 放入过的进程到收敛时要么已完成，要么活跃；从未放入的进程仍是基线终值
+    for (const auto& record : checkpoint.live) {
+        work_.processes_[record.index] = baseline_final_[record.index];
+    }
+}
+
+// 计算进程列表的最后完成时间
+int WhatIfAnalyzer::lastCompletion(const ProcessList& processes) {
+    int last = 0;
+    for (const auto& process : processes) {
+        last = std::max(last, process.getCompletionTime());
+    }
+    return last;
+}
+
+} // namespace ZTS_OS
@@ -0,0 +1,40 @@
+#include "../../include/synchronization/condition_variable.h"
+
+/**
+ * @file condition_variable.cpp
+ * @brief 模拟条件变量实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 构造函数
+ConditionVariable::ConditionVariable(int id, const std::string& name)
+    : SyncPrimitive(id, name), lost_signals_(0) {
+}
+
+// 进程开始等待条件
+void ConditionVariable::wait(int pid, int now) {
+    enqueue(pid, now);
+}
+
+// 唤醒一个等待者
+int ConditionVariable::signal(int now) {
+    if (getWaiters().empty()) {
+        lost_signals_++;
+        return -1;
+    }
+    return dequeue(now).pid;
+}
+
+// 唤醒全部等待者
+std::vector<int> ConditionVariable::broadcast(int now) {
+    std::vector<int> woken;
+    while (!getWaiters().empty()) {
+        woken.push_back(dequeue(now).pid);
+    }
+    return woken;
+}
+
+} // namespace ZTS_OS
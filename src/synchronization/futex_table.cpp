@@ -0,0 +1,63 @@
+#include "../../include/synchronization/futex_table.h"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @file futex_table.cpp
+ * @brief 散列等待队列实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 构造函数
+FutexTable::FutexTable(size_t buckets) : shift_(64) {
+    if (buckets == 0) {
+        throw std::invalid_argument("散列等待队列的桶数必须为正数");
+    }
+    size_t size = 1;
+    while (size < buckets) {
+        size <<= 1;
+        shift_--;
+    }
+    buckets_.resize(size);
+}
+
+// 斐波那契散列：乘以2^64/φ后取高位
+size_t FutexTable::bucketOf(std::uintptr_t address) const {
+    if (buckets_.size() == 1) {
+        return 0;
+    }
+    std::uint64_t hash = static_cast<std::uint64_t>(address) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash >> shift_);
+}
+
+// 在地址上等待
+void FutexTable::wait(std::uintptr_t address, int tid) {
+    auto& bucket = buckets_[bucketOf(address)];
+    bucket.emplace_back(address, tid);
+    stats_.waits++;
+    stats_.max_bucket_length = std::max(stats_.max_bucket_length, bucket.size());
+}
+
+// 唤醒地址上的等待者
+std::vector<int> FutexTable::wake(std::uintptr_t address, int count) {
+    std::vector<int> woken;
+    auto& bucket = buckets_[bucketOf(address)];
+    stats_.wake_calls++;
+    for (auto it = bucket.begin(); it != bucket.end() && static_cast<int>(woken.size()) < count;) {
+        stats_.scanned++;
+        if (it->first == address) {
+            woken.push_back(it->second);
+            it = bucket.erase(it);
+        } else {
+            stats_.collisions++;
+            ++it;
+        }
+    }
+    stats_.woken += static_cast<long long>(woken.size());
+    return woken;
+}
+
+} // namespace ZTS_OS
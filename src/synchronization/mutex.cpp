@@ -0,0 +1,63 @@
+#include "../../include/synchronization/mutex.h"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @file mutex.cpp
+ * @brief 模拟互斥锁实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 构造函数
+Mutex::Mutex(int id, const std::string& name)
+    : SyncPrimitive(id, name), owner_(-1), acquired_at_(0), convoy_(0) {
+}
+
+// 尝试加锁
+bool Mutex::tryLock(int pid, int now) {
+    if (owner_ != -1) {
+        return false;
+    }
+    owner_ = pid;
+    acquired_at_ = now;
+    convoy_ = 0;
+    stats_.acquisitions++;
+    return true;
+}
+
+// 加锁失败后进入等待队列
+void Mutex::block(int pid, int now) {
+    enqueue(pid, now);
+}
+
+// 解锁
+int Mutex::unlock(int pid, int now) {
+    if (owner_ != pid) {
+        throw std::runtime_error("进程P" + std::to_string(pid) + "试图释放不属于它的互斥锁" + getName());
+    }
+
+    int hold_time = now - acquired_at_;
+    stats_.total_hold_time += hold_time;
+    stats_.max_hold_time = std::max(stats_.max_hold_time, hold_time);
+
+    if (getWaiters().empty()) {
+        owner_ = -1;
+        convoy_ = 0;
+        return -1;
+    }
+
+    // 直接交接给等待最久的进程
+    owner_ = dequeue(now).pid;
+    acquired_at_ = now;
+    convoy_++;
+    stats_.longest_convoy = std::max(stats_.longest_convoy, convoy_);
+    if (!getWaiters().empty()) {
+        stats_.convoy_handoffs++;
+    }
+    return owner_;
+}
+
+} // namespace ZTS_OS
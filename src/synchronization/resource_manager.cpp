@@ -0,0 +1,574 @@
+#include "../../include/synchronization/resource_manager.h"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @file resource_manager.cpp
+ * @brief 多类资源管理实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 把进程的正分量加入索引
+void ResourceManager::ReductionIndex::insert(int slot, const std::vector<int>& amounts) {
+    int positive = 0;
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        if (amounts[type] > 0) {
+            std::vector<std::pair<int, int>>& entries = by_type[type];
+            std::pair<int, int> key(amounts[type], slot);
+            entries.insert(std::lower_bound(entries.begin(), entries.end(), key), key);
+            positive++;
+        }
+    }
+    if (static_cast<size_t>(slot) >= positive_types.size()) {
+        positive_types.resize(slot + 1, 0);
+    }
+    positive_types[slot] = positive;
+    if (positive == 0) {
+        zero.insert(slot);
+    }
+}
+
+// 把进程的正分量移出索引
+void ResourceManager::ReductionIndex::erase(int slot, const std::vector<int>& amounts) {
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        if (amounts[type] > 0) {
+            std::vector<std::pair<int, int>>& entries = by_type[type];
+            entries.erase(std::lower_bound(entries.begin(), entries.end(), std::make_pair(amounts[type], slot)));
+        }
+    }
+    zero.erase(slot);
+    positive_types[slot] = 0;
+}
+
+// 构造函数
+ResourceManager::ResourceManager(AllocationPolicy policy)
+    : policy_(policy), next_order_(0) {
+}
+
+// 添加资源类型
+int ResourceManager::addResourceType(const std::string& name, int instances) {
+    if (instances < 0) {
+        throw std::invalid_argument("资源实例数不能为负数");
+    }
+    if (!processes_.empty()) {
+        throw std::logic_error("必须在添加进程之前添加资源类型");
+    }
+    names_.push_back(name);
+    totals_.push_back(instances);
+    available_.push_back(instances);
+    waiting_held_.push_back(0);
+    need_index_.by_type.emplace_back();
+    request_index_.by_type.emplace_back();
+    int type = static_cast<int>(totals_.size() - 1);
+    if (policy_ == AllocationPolicy::DETECTION) {
+        order_[resourceNode(type)] = next_order_++;
+    }
+    return type;
+}
+
+// 检查向量长度
+void ResourceManager::checkLength(const std::vector<int>& amounts) const {
+    if (amounts.size() != totals_.size()) {
+        throw std::invalid_argument("资源向量长度应为" + std::to_string(totals_.size()));
+    }
+}
+
+// 查找进程
+ResourceManager::ProcessEntry& ResourceManager::entry(int pid) {
+    auto it = processes_.find(pid);
+    if (it == processes_.end()) {
+        throw std::invalid_argument("进程不存在: " + std::to_string(pid));
+    }
+    return it->second;
+}
+
+// 查找进程
+const ResourceManager::ProcessEntry& ResourceManager::entry(int pid) const {
+    auto it = processes_.find(pid);
+    if (it == processes_.end()) {
+        throw std::invalid_argument("进程不存在: " + std::to_string(pid));
+    }
+    return it->second;
+}
+
+// 添加进程
+void ResourceManager::addProcess(int pid, const std::vector<int>& max_claim) {
+    checkLength(max_claim);
+    if (processes_.count(pid) != 0) {
+        throw std::invalid_argument("进程已存在: " + std::to_string(pid));
+    }
+    for (size_t type = 0; type < max_claim.size(); ++type) {
+        if (max_claim[type] < 0 || max_claim[type] > totals_[type]) {
+            throw std::invalid_argument("进程" + std::to_string(pid) + "对" + names_[type] + "的最大需求超出范围");
+        }
+    }
+
+    ProcessEntry process;
+    process.allocation.assign(totals_.size(), 0);
+    process.need = max_claim;
+    process.pending.assign(totals_.size(), 0);
+    process.waiting = false;
+    if (free_slots_.empty()) {
+        process.slot = static_cast<int>(slot_pids_.size());
+        slot_pids_.push_back(pid);
+    } else {
+        process.slot = free_slots_.back();
+        free_slots_.pop_back();
+        slot_pids_[process.slot] = pid;
+    }
+    processes_.emplace(pid, process);
+    if (policy_ == AllocationPolicy::BANKER) {
+        need_index_.insert(process.slot, max_claim);
+    } else {
+        order_[processNode(pid)] = next_order_++;
+    }
+}
+
+// 移除进程
+std::vector<int> ResourceManager::removeProcess(int pid) {
+    ProcessEntry& process = entry(pid);
+    if (process.waiting) {
+        stopWaiting(pid);
+        wait_queue_.erase(std::find(wait_queue_.begin(), wait_queue_.end(), pid));
+    }
+    if (policy_ == AllocationPolicy::BANKER) {
+        need_index_.erase(process.slot, process.need);
+    }
+    for (size_t type = 0; type < totals_.size(); ++type) {
+        int held = process.allocation[type];
+        if (held > 0) {
+            changeAllocation(pid, static_cast<int>(type), -held);
+            available_[type] += held;
+        }
+    }
+
+    slot_pids_[process.slot] = -1;
+    free_slots_.push_back(process.slot);
+    processes_.erase(pid);
+    order_.erase(processNode(pid));
+    successors_.erase(processNode(pid));
+    predecessors_.erase(processNode(pid));
+    return retryWaiting();
+}
+
+// 申请资源
+RequestResult ResourceManager::request(int pid, const std::vector<int>& amounts) {
+    checkLength(amounts);
+    ProcessEntry& process = entry(pid);
+    if (process.waiting) {
+        throw std::logic_error("进程" + std::to_string(pid) + "正在等待，不能再次申请资源");
+    }
+    bool available = true;
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        if (amounts[type] < 0 || amounts[type] > process.need[type]) {
+            throw std::invalid_argument("进程" + std::to_string(pid) + "对" + names_[type] + "的申请超出剩余需求");
+        }
+        available = available && amounts[type] <= available_[type];
+    }
+    stats_.requests++;
+
+    if (!available) {
+        startWaiting(pid, amounts);
+        stats_.blocked_unavailable++;
+        return RequestResult::BLOCKED_UNAVAILABLE;
+    }
+    if (policy_ == AllocationPolicy::BANKER && !canGrantSafely(pid, amounts)) {
+        startWaiting(pid, amounts);
+        stats_.blocked_unsafe++;
+        return RequestResult::BLOCKED_UNSAFE;
+    }
+    grant(pid, amounts);
+    return RequestResult::GRANTED;
+}
+
+// 释放资源
+std::vector<int> ResourceManager::release(int pid, const std::vector<int>& amounts) {
+    checkLength(amounts);
+    ProcessEntry& process = entry(pid);
+    if (process.waiting) {
+        throw std::logic_error("进程" + std::to_string(pid) + "正在等待，不能释放资源");
+    }
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        if (amounts[type] < 0 || amounts[type] > process.allocation[type]) {
+            throw std::invalid_argument("进程" + std::to_string(pid) + "释放的" + names_[type] + "超过持有量");
+        }
+    }
+
+    if (policy_ == AllocationPolicy::BANKER) {
+        need_index_.erase(process.slot, process.need);
+    }
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        if (amounts[type] > 0) {
+            changeAllocation(pid, static_cast<int>(type), -amounts[type]);
+            process.need[type] += amounts[type];
+            available_[type] += amounts[type];
+        }
+    }
+    if (policy_ == AllocationPolicy::BANKER) {
+        need_index_.insert(process.slot, process.need);
+    }
+    return retryWaiting();
+}
+
+// 归约：判断target能否完成
+bool ResourceManager::reduce(std::vector<int> work, const ReductionIndex& index, int target,
+                             std::vector<char>& finished) {
+    const size_t types = totals_.size();
+    const std::vector<int>* target_need = target >= 0 ? &processes_.at(slot_pids_[target]).need : nullptr;
+    auto targetFits = [&]() {
+        for (size_t type = 0; type < types; ++type) {
+            if ((*target_need)[type] > work[type]) {
+                return false;
+            }
+        }
+        return true;
+    };
+
+    finished.assign(slot_pids_.size(), 0);
+    std::vector<int> satisfied(slot_pids_.size(), 0);
+    std::vector<int> ready(index.zero.begin(), index.zero.end());
+    std::vector<size_t> cursor(types, 0);
+    std::vector<size_t> dirty(types);
+    for (size_t type = 0; type < types; ++type) {
+        dirty[type] = type;
+    }
+
+    // 把第type类资源上需求量不超过work的进程计为满足，所有正分量都满足的进程可以完成
+    auto advance = [&](size_t type) {
+        const std::vector<std::pair<int, int>>& entries = index.by_type[type];
+        while (cursor[type] < entries.size() && entries[cursor[type]].first <= work[type]) {
+            int slot = entries[cursor[type]].second;
+            if (++satisfied[slot] == index.positive_types[slot]) {
+                ready.push_back(slot);
+            }
+            ++cursor[type];
+        }
+    };
+
+    // 惰性推进：先完成已就绪的进程，每当可用量增加就先看申请进程是否已能完成
+    while (true) {
+        if (target_need != nullptr && targetFits()) {
+            return true;
+        }
+        if (!ready.empty()) {
+            int slot = ready.back();
+            ready.pop_back();
+            stats_.safety_visits++;
+            if (slot == target) {
+                return true;
+            }
+            finished[slot] = 1;
+            const std::vector<int>& allocation = processes_.at(slot_pids_[slot]).allocation;
+            for (size_t type = 0; type < types; ++type) {
+                if (allocation[type] > 0) {
+                    work[type] += allocation[type];
+                    dirty.push_back(type);
+                }
+            }
+        } else if (!dirty.empty()) {
+            size_t type = dirty.back();
+            dirty.pop_back();
+            advance(type);
+        } else {
+            break;
+        }
+    }
+    return target < 0;
+}
+
+// 银行家算法：假设分配后，申请进程能否在归约中完成
+bool ResourceManager::canGrantSafely(int pid, const std::vector<int>& amounts) {
+    stats_.safety_checks++;
+    ProcessEntry& process = processes_.at(pid);
+
+    // 当前状态安全，所以只要申请进程能完成，它释放的资源足以让其余进程按原来的安全序列完成。
+    // 索引中申请进程的剩余需求不更新：旧需求更大，它被满足时targetFits早已成立
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        process.need[type] -= amounts[type];
+        available_[type] -= amounts[type];
+    }
+
+    std::vector<char> finished;
+    bool safe = reduce(available_, need_index_, process.slot, finished);
+
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        process.need[type] += amounts[type];
+        available_[type] += amounts[type];
+    }
+    return safe;
+}
+
+// 分配资源
+void ResourceManager::grant(int pid, const std::vector<int>& amounts) {
+    ProcessEntry& process = processes_.at(pid);
+    if (policy_ == AllocationPolicy::BANKER) {
+        need_index_.erase(process.slot, process.need);
+    }
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        if (amounts[type] > 0) {
+            available_[type] -= amounts[type];
+            process.need[type] -= amounts[type];
+            changeAllocation(pid, static_cast<int>(type), amounts[type]);
+        }
+    }
+    if (policy_ == AllocationPolicy::BANKER) {
+        need_index_.insert(process.slot, process.need);
+    }
+    stats_.granted++;
+}
+
+// 进程开始等待：登记请求并在资源分配图中指向所请求的资源类型
+void ResourceManager::startWaiting(int pid, const std::vector<int>& amounts) {
+    ProcessEntry& process = processes_.at(pid);
+    process.pending = amounts;
+    process.waiting = true;
+    wait_queue_.push_back(pid);
+    request_index_.insert(process.slot, amounts);
+    for (size_t type = 0; type < amounts.size(); ++type) {
+        waiting_held_[type] += process.allocation[type];
+        if (amounts[type] > 0 && policy_ == AllocationPolicy::DETECTION) {
+            addEdge(processNode(pid), resourceNode(static_cast<int>(type)));
+        }
+    }
+}
+
+// 进程结束等待（不修改等待队列）
+void ResourceManager::stopWaiting(int pid) {
+    ProcessEntry& process = processes_.at(pid);
+    request_index_.erase(process.slot, process.pending);
+    for (size_t type = 0; type < process.pending.size(); ++type) {
+        waiting_held_[type] -= process.allocation[type];
+        if (process.pending[type] > 0 && policy_ == AllocationPolicy::DETECTION) {
+            removeEdge(processNode(pid), resourceNode(static_cast<int>(type)));
+        }
+    }
+    std::fill(process.pending.begin(), process.pending.end(), 0);
+    process.waiting = false;
+}
+
+// 修改分配量，并维护资源分配图中资源类型指向持有者的边
+void ResourceManager::changeAllocation(int pid, int type, int delta) {
+    ProcessEntry& process = processes_.at(pid);
+    int before = process.allocation[type];
+    int after = before + delta;
+    process.allocation[type] = after;
+    if (process.waiting) {
+        waiting_held_[type] += delta;
+    }
+
+    if (policy_ != AllocationPolicy::DETECTION) {
+        return;
+    }
+    if (before == 0 && after > 0) {
+        addEdge(resourceNode(type), processNode(pid));
+    } else if (before > 0 && after == 0) {
+        removeEdge(resourceNode(type), processNode(pid));
+    }
+}
+
+// 按先来先服务重试等待中的请求
+std::vector<int> ResourceManager::retryWaiting() {
+    std::vector<int> granted;
+    std::deque<int> still_waiting;
+    for (int pid : wait_queue_) {
+        const ProcessEntry& process = processes_.at(pid);
+        bool available = true;
+        for (size_t type = 0; type < totals_.size() && available; ++type) {
+            available = process.pending[type] <= available_[type];
+        }
+        if (available && (policy_ == AllocationPolicy::DETECTION || canGrantSafely(pid, process.pending))) {
+            std::vector<int> amounts = process.pending;
+            stopWaiting(pid);
+            grant(pid, amounts);
+            granted.push_back(pid);
+        } else {
+            still_waiting.push_back(pid);
+        }
+    }
+    wait_queue_.swap(still_waiting);
+    return granted;
+}
+
+// 资源分配图中加边
+void ResourceManager::addEdge(long long from, long long to) {
+    edges_.insert({from, to});
+    insertOrderedEdge(from, to);
+}
+
+// 资源分配图中删边；删除后重试暂存的成环边
+void ResourceManager::removeEdge(long long from, long long to) {
+    edges_.erase({from, to});
+    if (deferred_.erase({from, to}) != 0) {
+        return;
+    }
+    successors_[from].erase(to);
+    predecessors_[to].erase(from);
+
+    // 暂存边(u, v)成环是因为已排序子图中v可达u，路径上的序号严格递增，
+    // 只有满足 序号(v) <= 序号(from) 且 序号(to) <= 序号(u) 的暂存边才可能因此不再成环
+    const int from_order = order_.at(from);
+    const int to_order = order_.at(to);
+    std::vector<std::pair<long long, long long>> retry;
+    for (const auto& edge : deferred_) {
+        if (order_.at(edge.second) <= from_order && to_order <= order_.at(edge.first)) {
+            retry.push_back(edge);
+        }
+    }
+    for (const auto& edge : retry) {
+        deferred_.erase(edge);
+        insertOrderedEdge(edge.first, edge.second);
+    }
+}
+
+// Pearce-Kelly：插入边并维护拓扑序，会形成环的边暂存
+void ResourceManager::insertOrderedEdge(long long from, long long to) {
+    stats_.edge_insertions++;
+    const int lower = order_.at(to);
+    const int upper = order_.at(from);
+    if (lower > upper) {
+        successors_[from].insert(to);
+        predecessors_[to].insert(from);
+        return;
+    }
+    stats_.order_searches++;
+
+    // 从to向前搜索序号小于upper的结点，遇到from即成环
+    std::vector<long long> forward;
+    std::unordered_set<long long> seen{to};
+    std::vector<long long> stack{to};
+    while (!stack.empty()) {
+        long long node = stack.back();
+        stack.pop_back();
+        forward.push_back(node);
+        stats_.search_visits++;
+        for (long long next : successors_[node]) {
+            if (next == from) {
+                deferred_.insert({from, to});
+                return;
+            }
+            if (order_.at(next) < upper && seen.insert(next).second) {
+                stack.push_back(next);
+            }
+        }
+    }
+
+    // 从from向后搜索序号大于lower的结点
+    std::vector<long long> backward;
+    seen = {from};
+    stack = {from};
+    while (!stack.empty()) {
+        long long node = stack.back();
+        stack.pop_back();
+        backward.push_back(node);
+        stats_.search_visits++;
+        for (long long previous : predecessors_[node]) {
+            if (order_.at(previous) > lower && seen.insert(previous).second) {
+                stack.push_back(previous);
+            }
+        }
+    }
+
+    // 受影响结点的序号重新分配：能到达from的结点整体排在从to出发可达的结点之前
+    auto byOrder = [this](long long a, long long b) { return order_.at(a) < order_.at(b); };
+    std::sort(backward.begin(), backward.end(), byOrder);
+    std::sort(forward.begin(), forward.end(), byOrder);
+    std::vector<int> slots;
+    for (long long node : backward) {
+        slots.push_back(order_.at(node));
+    }
+    for (long long node : forward) {
+        slots.push_back(order_.at(node));
+    }
+    std::sort(slots.begin(), slots.end());
+    size_t slot = 0;
+    for (long long node : backward) {
+        order_[node] = slots[slot++];
+    }
+    for (long long node : forward) {
+        order_[node] = slots[slot++];
+    }
+
+    successors_[from].insert(to);
+    predecessors_[to].insert(from);
+}
+
+// 检测死锁
+std::vector<int> ResourceManager::detectDeadlock() {
+    std::vector<int> deadlocked;
+    if (!hasWaitCycle()) {
+        return deadlocked;
+    }
+    stats_.detections++;
+
+    // 不在等待的进程终将释放资源，归约从它们之外的可用量开始
+    std::vector<int> work(totals_.size());
+    for (size_t type = 0; type < totals_.size(); ++type) {
+        work[type] = totals_[type] - waiting_held_[type];
+    }
+    std::vector<char> finished;
+    reduce(work, request_index_, -1, finished);
+    for (int pid : wait_queue_) {
+        if (!finished[processes_.at(pid).slot]) {
+            deadlocked.push_back(pid);
+        }
+    }
+    std::sort(deadlocked.begin(), deadlocked.end());
+    return deadlocked;
+}
+
+// 教科书式安全性检查
+bool ResourceManager::isSafeFullScan() const {
+    std::vector<int> work = available_;
+    std::unordered_set<int> finished;
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        for (const auto& item : processes_) {
+            if (finished.count(item.first) != 0) {
+                continue;
+            }
+            const ProcessEntry& process = item.second;
+            bool can_finish = true;
+            for (size_t type = 0; type < work.size() && can_finish; ++type) {
+                can_finish = process.need[type] <= work[type];
+            }
+            if (can_finish) {
+                for (size_t type = 0; type < work.size(); ++type) {
+                    work[type] += process.allocation[type];
+                }
+                finished.insert(item.first);
+                progress = true;
+            }
+        }
+    }
+    return finished.size() == processes_.size();
+}
+
+// 获取进程已分配的资源
+const std::vector<int>& ResourceManager::getAllocation(int pid) const {
+    return entry(pid).allocation;
+}
+
+// 获取进程的剩余需求
+const std::vector<int>& ResourceManager::getNeed(int pid) const {
+    return entry(pid).need;
+}
+
+// 进程是否在等待
+bool ResourceManager::isWaiting(int pid) const {
+    return entry(pid).waiting;
+}
+
+// 获取分配策略名称
+std::string ResourceManager::getPolicyName(AllocationPolicy policy) {
+    switch (policy) {
+        case AllocationPolicy::DETECTION: return "死锁检测";
+        case AllocationPolicy::BANKER:    return "银行家算法";
+    }
+    return "未知策略";
+}
+
+} // namespace ZTS_OS
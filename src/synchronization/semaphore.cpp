@@ -0,0 +1,45 @@
+#include "../../include/synchronization/semaphore.h"
+#include <stdexcept>
+
+/**
+ * @file semaphore.cpp
+ * @brief 模拟计数信号量实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 构造函数
+Semaphore::Semaphore(int id, const std::string& name, int initial_count)
+    : SyncPrimitive(id, name), count_(initial_count) {
+    if (initial_count < 0) {
+        throw std::invalid_argument("信号量初始计数不能为负数");
+    }
+}
+
+// 尝试P操作
+bool Semaphore::tryWait(int /* pid */, int /* now */) {
+    if (count_ == 0) {
+        return false;
+    }
+    count_--;
+    stats_.acquisitions++;
+    return true;
+}
+
+// P操作失败后进入等待队列
+void Semaphore::block(int pid, int now) {
+    enqueue(pid, now);
+}
+
+// V操作
+int Semaphore::signal(int now) {
+    if (getWaiters().empty()) {
+        count_++;
+        return -1;
+    }
+    return dequeue(now).pid;
+}
+
+} // namespace ZTS_OS
@@ -0,0 +1,393 @@
+#include "../../include/synchronization/smp_lock_simulator.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+#include <utility>
+
+/**
+ * @file smp_lock_simulator.cpp
+ * @brief 多核上自旋-休眠锁的竞争模拟实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+// 模拟锁的地址：每把锁独占一个64字节的缓存行
+const std::uintptr_t kLockBaseAddress = 0x10000;
+const std::uintptr_t kLockStride = 64;
+
+// 线程所处的阶段
+enum class Phase {
+    OUTSIDE,   // 执行临界区外的工作
+    ACQUIRE,   // 下一个时间单位开始时尝试加锁
+    SPINNING,  // 在核心上自旋等锁
+    PARKING,   // 执行futex_wait系统调用
+    CRITICAL,  // 执行临界区
+    WAKING,    // 释放锁后执行futex_wake系统调用
+    PARKED,    // 在散列等待队列中休眠
+    DONE       // 全部迭代完成
+};
+
+// 线程状态
+struct ThreadState {
+    Phase phase;          // 当前阶段
+    int remaining;        // 当前阶段剩余时间
+    int spin_left;        // 本次自旋剩余预算
+    int iterations_left;  // 剩余迭代次数
+    int lock;             // 使用的锁
+    bool contended;       // 本次加锁是否失败过
+    bool was_woken;       // 是否刚被唤醒、尚未重新尝试加锁
+    int woken_at;         // 被唤醒的时刻，-1表示未被唤醒
+    int quantum_used;     // 本次上核后已运行的时间
+};
+
+// 锁状态
+struct LockState {
+    int owner;                  // 持有者，-1表示空闲
+    int parked;                 // 休眠的等待者数
+    std::uintptr_t address;     // 模拟地址
+};
+
+} // namespace
+
+// 构造函数
+SmpLockSimulator::SmpLockSimulator(int cores, int spin_budget)
+    : cores_(cores), spin_budget_(0), buckets_(256) {
+    if (cores <= 0) {
+        throw std::invalid_argument("核心数必须为正数");
+    }
+    setSpinBudget(spin_budget);
+}
+
+// 设置自旋预算
+void SmpLockSimulator::setSpinBudget(int spin_budget) {
+    if (spin_budget < kSpinForever) {
+        throw std::invalid_argument("自旋预算不能小于-1");
+    }
+    spin_budget_ = spin_budget;
+}
+
+// 设置各环节开销
+void SmpLockSimulator::setCosts(const SpinParkCosts& costs) {
+    if (costs.park_cost < 0 || costs.wake_cost < 0 || costs.wakeup_latency < 0 || costs.context_switch < 0) {
+        throw std::invalid_argument("锁操作开销不能为负数");
+    }
+    if (costs.time_quantum <= 0) {
+        throw std::invalid_argument("时间片必须为正数");
+    }
+    costs_ = costs;
+}
+
+// 设置散列等待队列的桶数
+void SmpLockSimulator::setFutexBuckets(size_t buckets) {
+    if (buckets == 0) {
+        throw std::invalid_argument("散列等待队列的桶数必须为正数");
+    }
+    buckets_ = buckets;
+}
+
+// 运行模拟
+SmpLockResult SmpLockSimulator::run(const LockWorkload& workload) const {
+    if (workload.threads <= 0 || workload.iterations <= 0 || workload.locks <= 0) {
+        throw std::invalid_argument("线程数、迭代次数和锁数必须为正数");
+    }
+    if (workload.critical_time <= 0 || workload.non_critical_time < 0) {
+        throw std::invalid_argument("临界区长度必须为正数，临界区外工作不能为负数");
+    }
+
+    SmpLockResult result;
+    result.cores = cores_;
+    result.threads = workload.threads;
+    result.spin_budget = spin_budget_;
+
+    FutexTable futex(buckets_);
+    std::vector<LockState> locks(workload.locks);
+    for (int id = 0; id < workload.locks; ++id) {
+        locks[id] = {-1, 0, kLockBaseAddress + kLockStride * static_cast<std::uintptr_t>(id)};
+    }
+
+    std::vector<ThreadState> threads(workload.threads);
+    std::deque<int> ready;
+    for (int tid = 0; tid < workload.threads; ++tid) {
+        ThreadState& thread = threads[tid];
+        thread.phase = workload.non_critical_time > 0 ? Phase::OUTSIDE : Phase::ACQUIRE;
+        thread.remaining = workload.non_critical_time;
+        thread.spin_left = 0;
+        thread.iterations_left = workload.iterations;
+        thread.lock = tid % workload.locks;
+        thread.contended = false;
+        thread.was_woken = false;
+        thread.woken_at = -1;
+        thread.quantum_used = 0;
+        ready.push_back(tid);
+    }
+
+    // 被唤醒、等待进入就绪队列的线程：(进入时刻, 线程ID)
+    std::priority_queue<std::pair<int, int>, std::vector<std::pair<int, int>>,
+                        std::greater<std::pair<int, int>>> waking;
+    std::vector<int> running(cores_, -1);
+    std::vector<int> switching(cores_, 0);
+    std::vector<char> ran(cores_, 0);
+    std::vector<int> latencies;
+    std::vector<std::pair<int, int>> releases;
+    int finished = 0;
+    int time = 0;
+
+    // 完成一次迭代
+    auto finishIteration = [&](ThreadState& thread) {
+        thread.contended = false;
+        if (--thread.iterations_left == 0) {
+            thread.phase = Phase::DONE;
+            finished++;
+        } else if (workload.non_critical_time > 0) {
+            thread.phase = Phase::OUTSIDE;
+            thread.remaining = workload.non_critical_time;
+        } else {
+            thread.phase = Phase::ACQUIRE;
+        }
+    };
+
+    // futex_wait返回：锁仍被持有则休眠，否则回去重新加锁
+    auto completePark = [&](int tid) {
+        ThreadState& thread = threads[tid];
+        LockState& lock = locks[thread.lock];
+        if (lock.owner < 0) {
+            thread.phase = Phase::ACQUIRE;
+            return;
+        }
+        futex.wait(lock.address, tid);
+        lock.parked++;
+        result.parks++;
+        thread.phase = Phase::PARKED;
+    };
+
+    // 开始进入休眠
+    auto beginPark = [&](int tid) {
+        ThreadState& thread = threads[tid];
+        if (costs_.park_cost == 0) {
+            completePark(tid);
+        } else {
+            thread.phase = Phase::PARKING;
+            thread.remaining = costs_.park_cost;
+        }
+    };
+
+    while (finished < workload.threads) {
+        // 唤醒延迟已过的线程进入就绪队列
+        while (!waking.empty() && waking.top().first <= time) {
+            ready.push_back(waking.top().second);
+            waking.pop();
+        }
+
+        // 空闲核心从就绪队列取线程
+        for (int core = 0; core < cores_ && !ready.empty(); ++core) {
+            if (running[core] >= 0) {
+                continue;
+            }
+            int tid = ready.front();
+            ready.pop_front();
+            running[core] = tid;
+            switching[core] = costs_.context_switch;
+            threads[tid].quantum_used = 0;
+            result.context_switches++;
+            if (threads[tid].woken_at >= 0) {
+                latencies.push_back(time + costs_.context_switch - threads[tid].woken_at);
+                threads[tid].woken_at = -1;
+            }
+        }
+
+        // 每个核心执行一个时间单位；锁在本单位结束时才释放，所有核心看到的锁状态一致
+        releases.clear();
+        for (int core = 0; core < cores_; ++core) {
+            int tid = running[core];
+            ran[core] = 0;
+            if (tid < 0) {
+                result.idle_time++;
+                continue;
+            }
+            if (switching[core] > 0) {
+                switching[core]--;
+                result.switch_time++;
+                continue;
+            }
+
+            ran[core] = 1;
+            ThreadState& thread = threads[tid];
+            LockState& lock = locks[thread.lock];
+            if (thread.phase == Phase::ACQUIRE || (thread.phase == Phase::SPINNING && lock.owner < 0)) {
+                if (lock.owner < 0) {
+                    lock.owner = tid;
+                    if (thread.phase == Phase::SPINNING) {
+                        result.acquired_spinning++;
+                    } else if (!thread.contended) {
+                        result.uncontended++;
+                    }
+                    thread.phase = Phase::CRITICAL;
+                    thread.remaining = workload.critical_time;
+                } else {
+                    if (thread.was_woken) {
+                        result.futile_wakeups++;
+                    }
+                    thread.contended = true;
+                    if (spin_budget_ == 0) {
+                        beginPark(tid);
+                    } else {
+                        thread.phase = Phase::SPINNING;
+                        thread.spin_left = spin_budget_;
+                    }
+                }
+                thread.was_woken = false;
+            }
+
+            switch (thread.phase) {
+                case Phase::OUTSIDE:
+                    result.useful_time++;
+                    if (--thread.remaining == 0) {
+                        thread.phase = Phase::ACQUIRE;
+                    }
+                    break;
+                case Phase::SPINNING:
+                    result.spin_time++;
+                    if (spin_budget_ > 0 && --thread.spin_left == 0) {
+                        beginPark(tid);
+                    }
+                    break;
+                case Phase::PARKING:
+                    result.park_time++;
+                    if (--thread.remaining == 0) {
+                        completePark(tid);
+                    }
+                    break;
+                case Phase::CRITICAL:
+                    result.useful_time++;
+                    if (--thread.remaining == 0) {
+                        releases.emplace_back(tid, core);
+                    }
+                    break;
+                case Phase::WAKING:
+                    result.wake_time++;
+                    if (--thread.remaining == 0) {
+                        finishIteration(thread);
+                    }
+                    break;
+                default:
+                    // 不耗时间就进入了休眠，核心本单位剩余时间空闲
+                    result.idle_time++;
+                    break;
+            }
+            // 休眠的线程立即让出核心：本单位结束时的释放可能马上把它唤醒
+            if (thread.phase == Phase::PARKED) {
+                running[core] = -1;
+            }
+        }
+
+        // 本单位结束时释放锁；有休眠的等待者就唤醒一个
+        for (const auto& release : releases) {
+            ThreadState& thread = threads[release.first];
+            LockState& lock = locks[thread.lock];
+            lock.owner = -1;
+            result.critical_sections++;
+            if (lock.parked == 0) {
+                finishIteration(thread);
+                continue;
+            }
+            for (int woken : futex.wake(lock.address, 1)) {
+                lock.parked--;
+                result.wakeups++;
+                threads[woken].phase = Phase::ACQUIRE;
+                threads[woken].was_woken = true;
+                threads[woken].woken_at = time + 1;
+                waking.emplace(time + 1 + costs_.wakeup_latency, woken);
+            }
+            if (costs_.wake_cost > 0) {
+                thread.phase = Phase::WAKING;
+                thread.remaining = costs_.wake_cost;
+            } else {
+                finishIteration(thread);
+            }
+        }
+
+        // 完成的线程让出核心；时间片到期且有线程就绪时被抢占。上下文切换的时间不计入时间片
+        for (int core = 0; core < cores_; ++core) {
+            int tid = running[core];
+            if (tid < 0 || !ran[core]) {
+                continue;
+            }
+            ThreadState& thread = threads[tid];
+            if (thread.phase == Phase::DONE) {
+                running[core] = -1;
+                continue;
+            }
+            if (++thread.quantum_used >= costs_.time_quantum && !ready.empty()) {
+                if (thread.phase == Phase::CRITICAL) {
+                    result.holder_preemptions++;
+                }
+                ready.push_back(tid);
+                running[core] = -1;
+            }
+        }
+        time++;
+    }
+
+    result.makespan = time;
+    result.throughput = time > 0 ? result.critical_sections * 1000.0 / time : 0.0;
+    result.spin_share = time > 0 ? result.spin_time * 100.0 / (static_cast<double>(cores_) * time) : 0.0;
+    if (!latencies.empty()) {
+        std::sort(latencies.begin(), latencies.end());
+        size_t rank = static_cast<size_t>(std::ceil(0.95 * latencies.size()));
+        result.average_wakeup_latency =
+            std::accumulate(latencies.begin(), latencies.end(), 0.0) / latencies.size();
+        result.p95_wakeup_latency = latencies[rank - 1];
+        result.max_wakeup_latency = latencies.back();
+    }
+    result.futex = futex.getStats();
+    return result;
+}
+
+// 打印模拟结果
+void SmpLockSimulator::displayResult(const SmpLockResult& result) {
+    std::cout << "\n🔐 SMP锁竞争统计（" << result.cores << "核, " << result.threads << "线程, "
+              << getStrategyName(result.spin_budget) << "）：" << std::endl;
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
+
+    double core_time = static_cast<double>(result.cores) * result.makespan;
+    auto share = [core_time](long long part) { return core_time > 0 ? part * 100.0 / core_time : 0.0; };
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "总时间: " << result.makespan << "  完成临界区: " << result.critical_sections
+              << "  吞吐率: " << result.throughput << " 临界区/千时间单位" << std::endl;
+    std::cout << "核心时间分布: 有效工作 " << share(result.useful_time) << "%，自旋 " << share(result.spin_time)
+              << "%，休眠调用 " << share(result.park_time) << "%，唤醒调用 " << share(result.wake_time)
+              << "%，上下文切换 " << share(result.switch_time) << "%，空闲 " << share(result.idle_time) << "%" << std::endl;
+    std::cout << "加锁: 直接成功 " << result.uncontended << " 次，自旋中成功 " << result.acquired_spinning
+              << " 次，休眠 " << result.parks << " 次，被唤醒 " << result.wakeups
+              << " 次（其中锁又被抢走 " << result.futile_wakeups << " 次）" << std::endl;
+    std::cout << "持锁者在临界区内被抢占 " << result.holder_preemptions << " 次，上下文切换 "
+              << result.context_switches << " 次" << std::endl;
+    std::cout << "唤醒延迟: 平均 " << result.average_wakeup_latency << "，P95 " << result.p95_wakeup_latency
+              << "，最长 " << result.max_wakeup_latency << std::endl;
+    std::cout << "散列等待队列: 唤醒调用 " << result.futex.wake_calls << " 次，扫描 " << result.futex.scanned
+              << " 项（冲突 " << result.futex.collisions << "），最长桶 " << result.futex.max_bucket_length << std::endl;
+}
+
+// 获取自旋策略名称
+std::string SmpLockSimulator::getStrategyName(int spin_budget) {
+    if (spin_budget == kSpinForever) {
+        return "纯自旋";
+    }
+    if (spin_budget == 0) {
+        return "直接休眠";
+    }
+    return "自旋" + std::to_string(spin_budget) + "后休眠";
+}
+
+} // namespace ZTS_OS
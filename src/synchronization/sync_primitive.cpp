@@ -0,0 +1,67 @@
+#include "../../include/synchronization/sync_primitive.h"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @file sync_primitive.cpp
+ * @brief 模拟同步原语基类实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 构造函数
+SyncPrimitive::SyncPrimitive(int id, const std::string& name)
+    : id_(id), name_(name), contended_since_(0) {
+}
+
+// 模拟结束时结算仍未结束的竞争区间
+void SyncPrimitive::finish(int now) {
+    if (!waiters_.empty()) {
+        stats_.contended_time += now - contended_since_;
+        contended_since_ = now;
+    }
+}
+
+// 把等待者移到队首
+void SyncPrimitive::promoteWaiter(int pid) {
+    auto it = std::find_if(waiters_.begin(), waiters_.end(),
+                           [pid](const Waiter& waiter) { return waiter.pid == pid; });
+    if (it == waiters_.end()) {
+        throw std::logic_error("进程P" + std::to_string(pid) + "不在" + name_ + "的等待队列中");
+    }
+    Waiter waiter = *it;
+    waiters_.erase(it);
+    waiters_.push_front(waiter);
+}
+
+// 进程进入等待队列
+void SyncPrimitive::enqueue(int pid, int now) {
+    if (waiters_.empty()) {
+        contended_since_ = now;
+    }
+    waiters_.push_back({pid, now});
+    stats_.max_queue_length = std::max(stats_.max_queue_length, waiters_.size());
+}
+
+// 队首进程离开等待队列
+Waiter SyncPrimitive::dequeue(int now) {
+    if (waiters_.empty()) {
+        throw std::logic_error("等待队列为空");
+    }
+    Waiter waiter = waiters_.front();
+    waiters_.pop_front();
+    if (waiters_.empty()) {
+        stats_.contended_time += now - contended_since_;
+    }
+
+    int wait_time = now - waiter.since;
+    stats_.acquisitions++;
+    stats_.contended++;
+    stats_.total_wait_time += wait_time;
+    stats_.max_wait_time = std::max(stats_.max_wait_time, wait_time);
+    return waiter;
+}
+
+} // namespace ZTS_OS
@@ -0,0 +1,759 @@
+#include "../../include/synchronization/sync_scheduler.h"
+#include "../../include/synchronization/mutex.h"
+#include "../../include/synchronization/semaphore.h"
+#include "../../include/synchronization/condition_variable.h"
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <set>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+/**
+ * @file sync_scheduler.cpp
+ * @brief 带同步原语的单CPU调度模拟实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+namespace {
+
+// 没有进程在运行
+const size_t kIdle = static_cast<size_t>(-1);
+
+// 就绪队列元素：(出队键, 进程下标, 版本)
+using ReadyEntry = std::tuple<long long, size_t, unsigned>;
+
+// 同步操作的名称
+const char* actionName(SyncActionType type) {
+    switch (type) {
+        case SyncActionType::LOCK:         return "加锁";
+        case SyncActionType::UNLOCK:       return "解锁";
+        case SyncActionType::SEM_WAIT:     return "P操作";
+        case SyncActionType::SEM_SIGNAL:   return "V操作";
+        case SyncActionType::CV_WAIT:      return "等待条件";
+        case SyncActionType::CV_SIGNAL:    return "唤醒一个";
+        case SyncActionType::CV_BROADCAST: return "唤醒全部";
+    }
+    return "未知操作";
+}
+
+} // namespace
+
+// 构造函数
+SyncScheduler::SyncScheduler(SchedulerFactory::SchedulerType type, bool preemptive, int time_quantum)
+    : Scheduler("同步调度", "进程在执行过程中操作互斥锁、信号量和条件变量"),
+      type_(type), preemptive_(preemptive), time_quantum_(time_quantum),
+      protocol_(LockProtocol::NONE), priority_waits_(false) {
+    if (time_quantum <= 0) {
+        throw std::invalid_argument("时间片大小必须大于0");
+    }
+}
+
+// 添加互斥锁
+int SyncScheduler::addMutex(const std::string& name) {
+    specs_.push_back({PrimitiveKind::MUTEX, name, 0});
+    return static_cast<int>(specs_.size() - 1);
+}
+
+// 添加信号量
+int SyncScheduler::addSemaphore(const std::string& name, int initial_count) {
+    if (initial_count < 0) {
+        throw std::invalid_argument("信号量初始计数不能为负数");
+    }
+    specs_.push_back({PrimitiveKind::SEMAPHORE, name, initial_count});
+    return static_cast<int>(specs_.size() - 1);
+}
+
+// 添加条件变量
+int SyncScheduler::addConditionVariable(const std::string& name) {
+    specs_.push_back({PrimitiveKind::CONDITION_VARIABLE, name, 0});
+    return static_cast<int>(specs_.size() - 1);
+}
+
+// 检查原语编号和类型
+void SyncScheduler::checkPrimitive(int id, PrimitiveKind kind) const {
+    if (id < 0 || static_cast<size_t>(id) >= specs_.size()) {
+        throw std::invalid_argument("同步原语编号不存在: " + std::to_string(id));
+    }
+    if (specs_[id].kind != kind) {
+        throw std::invalid_argument("同步原语" + specs_[id].name + "的类型与操作不符");
+    }
+}
+
+// 设置进程的同步脚本
+void SyncScheduler::setScript(int pid, const std::vector<SyncAction>& actions) {
+    std::vector<SyncAction> script = actions;
+    std::stable_sort(script.begin(), script.end(),
+                     [](const SyncAction& a, const SyncAction& b) { return a.at < b.at; });
+
+    // 按脚本顺序跟踪持有的锁，保证加解锁配对
+    std::set<int> held;
+    for (const auto& action : script) {
+        if (action.at < 0) {
+            throw std::invalid_argument("同步操作时刻不能为负数");
+        }
+        switch (action.type) {
+            case SyncActionType::LOCK:
+                checkPrimitive(action.object, PrimitiveKind::MUTEX);
+                if (!held.insert(action.object).second) {
+                    throw std::invalid_argument("进程P" + std::to_string(pid) + "重复加锁" + specs_[action.object].name);
+                }
+                break;
+            case SyncActionType::UNLOCK:
+                checkPrimitive(action.object, PrimitiveKind::MUTEX);
+                if (held.erase(action.object) == 0) {
+                    throw std::invalid_argument("进程P" + std::to_string(pid) + "释放了未持有的锁" + specs_[action.object].name);
+                }
+                break;
+            case SyncActionType::SEM_WAIT:
+            case SyncActionType::SEM_SIGNAL:
+                checkPrimitive(action.object, PrimitiveKind::SEMAPHORE);
+                break;
+            case SyncActionType::CV_WAIT:
+                checkPrimitive(action.object, PrimitiveKind::CONDITION_VARIABLE);
+                checkPrimitive(action.mutex, PrimitiveKind::MUTEX);
+                if (held.count(action.mutex) == 0) {
+                    throw std::invalid_argument("进程P" + std::to_string(pid) + "等待条件变量时必须持有锁" + specs_[action.mutex].name);
+                }
+                break;
+            case SyncActionType::CV_SIGNAL:
+            case SyncActionType::CV_BROADCAST:
+                checkPrimitive(action.object, PrimitiveKind::CONDITION_VARIABLE);
+                break;
+        }
+    }
+    if (!held.empty()) {
+        throw std::invalid_argument("进程P" + std::to_string(pid) + "结束时仍持有锁" + specs_[*held.begin()].name);
+    }
+
+    scripts_[pid] = script;
+}
+
+// 按定义创建全部原语
+std::vector<std::unique_ptr<SyncPrimitive>> SyncScheduler::createPrimitives() const {
+    std::vector<std::unique_ptr<SyncPrimitive>> primitives;
+    for (size_t id = 0; id < specs_.size(); ++id) {
+        const PrimitiveSpec& spec = specs_[id];
+        int object_id = static_cast<int>(id);
+        switch (spec.kind) {
+            case PrimitiveKind::MUTEX:
+                primitives.push_back(std::make_unique<Mutex>(object_id, spec.name));
+                break;
+            case PrimitiveKind::SEMAPHORE:
+                primitives.push_back(std::make_unique<Semaphore>(object_id, spec.name, spec.initial_count));
+                break;
+            case PrimitiveKind::CONDITION_VARIABLE:
+                primitives.push_back(std::make_unique<ConditionVariable>(object_id, spec.name));
+                break;
+        }
+    }
+    return primitives;
+}
+
+// 执行调度
+SchedulingResult SyncScheduler::schedule(const ProcessList& processes) {
+    return run(processes).scheduling;
+}
+
+// 执行调度并返回同步统计
+SyncSimulationResult SyncScheduler::run(const ProcessList& processes) {
+    validateProcesses(processes);
+
+    ProcessList scheduled = processes;
+    resetProcesses(scheduled);
+    const size_t count = scheduled.size();
+
+    std::unordered_map<int, size_t> index_of;
+    std::vector<const std::vector<SyncAction>*> scripts(count, nullptr);
+    for (size_t i = 0; i < count; ++i) {
+        const Process& process = scheduled[i];
+        if (!index_of.emplace(process.getPID(), i).second) {
+            throw std::invalid_argument("进程ID重复: " + std::to_string(process.getPID()));
+        }
+        auto it = scripts_.find(process.getPID());
+        if (it == scripts_.end()) {
+            continue;
+        }
+        for (const auto& action : it->second) {
+            if (action.at > process.getBurstTime()) {
+                throw std::invalid_argument("进程P" + std::to_string(process.getPID()) + "的同步操作时刻超出执行时间");
+            }
+            bool blocking = action.type == SyncActionType::LOCK || action.type == SyncActionType::SEM_WAIT ||
+                            action.type == SyncActionType::CV_WAIT;
+            if (blocking && action.at == process.getBurstTime()) {
+                throw std::invalid_argument("进程P" + std::to_string(process.getPID()) + "不能在执行结束时进行可能阻塞的操作");
+            }
+        }
+        scripts[i] = &it->second;
+    }
+
+    std::vector<std::unique_ptr<SyncPrimitive>> primitives = createPrimitives();
+    auto mutexAt = [&primitives](int id) -> Mutex& { return static_cast<Mutex&>(*primitives[id]); };
+    auto semaphoreAt = [&primitives](int id) -> Semaphore& { return static_cast<Semaphore&>(*primitives[id]); };
+    auto conditionAt = [&primitives](int id) -> ConditionVariable& {
+        return static_cast<ConditionVariable&>(*primitives[id]);
+    };
+    auto baseOf = [&scheduled](size_t index) { return static_cast<int>(scheduled[index].getPriority()); };
+    auto ownerOf = [&](int mutex_id) -> size_t {
+        int pid = mutexAt(mutex_id).getOwner();
+        return pid < 0 ? kIdle : index_of.at(pid);
+    };
+
+    SyncSimulationResult result;
+    result.protocol = protocol_;
+    result.processes.resize(count);
+    for (size_t i = 0; i < count; ++i) {
+        result.processes[i] = {scheduled[i].getPID(), 0, 0, 0, 0, 0};
+    }
+    std::vector<size_t> next_action(count, 0);
+    std::vector<int> blocked_since(count, 0);
+    std::vector<int> reacquire(count, -1);
+    std::vector<int> waiting_for(count, -1);    // 正在等待的互斥锁
+    std::vector<std::vector<int>> held(count);  // 持有的互斥锁
+    std::vector<int> effective(count);          // 有效优先级
+    std::vector<unsigned> version(count, 0);    // 就绪队列项的版本，旧版本的项出队时丢弃
+    size_t mutex_waiters = 0;
+    for (size_t i = 0; i < count; ++i) {
+        effective[i] = baseOf(i);
+    }
+
+    // 天花板：本次运行中会对该锁加锁的进程的最高基础优先级
+    std::vector<int> ceiling(specs_.size(), std::numeric_limits<int>::max());
+    if (protocol_ == LockProtocol::PRIORITY_CEILING) {
+        for (size_t i = 0; i < count; ++i) {
+            if (scripts[i] == nullptr) {
+                continue;
+            }
+            for (const auto& action : *scripts[i]) {
+                if (action.type == SyncActionType::LOCK) {
+                    ceiling[action.object] = std::min(ceiling[action.object], baseOf(i));
+                }
+            }
+        }
+    }
+
+    // 到达序列：按(到达时间, 下标)排序
+    std::vector<size_t> arrivals(count);
+    std::iota(arrivals.begin(), arrivals.end(), 0);
+    std::sort(arrivals.begin(), arrivals.end(), [&scheduled](size_t a, size_t b) {
+        int arrival_a = scheduled[a].getArrivalTime();
+        int arrival_b = scheduled[b].getArrivalTime();
+        return arrival_a != arrival_b ? arrival_a < arrival_b : a < b;
+    });
+
+    const bool tracing = isTraceEnabled();
+    std::ostream& out = trace();
+    const bool time_sliced = type_ == SchedulerFactory::SchedulerType::ROUND_ROBIN;
+    const bool by_priority = type_ == SchedulerFactory::SchedulerType::PRIORITY;
+    const bool preempt_on_ready = preemptive_ && (type_ == SchedulerFactory::SchedulerType::SJF || by_priority);
+
+    std::priority_queue<ReadyEntry, std::vector<ReadyEntry>, std::greater<ReadyEntry>> ready;
+    long long enqueue_sequence = 0;
+    size_t next_arrival = 0;
+    size_t completed = 0;
+    size_t running = kIdle;
+    int current_time = 0;
+    int slice_left = 0;
+    long long decisions = 0;
+
+    // 出队键：FCFS和时间片轮转按进入就绪队列的顺序，SJF按剩余时间，优先级调度按有效优先级
+    auto keyOf = [&](size_t index) -> long long {
+        switch (type_) {
+            case SchedulerFactory::SchedulerType::SJF:
+                return scheduled[index].getRemainingTime();
+            case SchedulerFactory::SchedulerType::PRIORITY:
+                return effective[index];
+            default:
+                return enqueue_sequence++;
+        }
+    };
+    auto makeReady = [&](size_t index) {
+        scheduled[index].setState(ProcessState::READY);
+        ready.emplace(keyOf(index), index, ++version[index]);
+    };
+    // 丢弃队首的过期项
+    auto pruneReady = [&]() {
+        while (!ready.empty() && std::get<2>(ready.top()) != version[std::get<1>(ready.top())]) {
+            ready.pop();
+        }
+    };
+    // 就绪队列队首是否应当抢占index
+    auto outranks = [&](size_t index) {
+        pruneReady();
+        if (ready.empty()) {
+            return false;
+        }
+        const ReadyEntry& top = ready.top();
+        return std::make_pair(std::get<0>(top), std::get<1>(top)) < std::make_pair(keyOf(index), index);
+    };
+    auto admitArrivals = [&]() {
+        while (next_arrival < count &&
+               scheduled[arrivals[next_arrival]].getArrivalTime() <= current_time) {
+            size_t index = arrivals[next_arrival++];
+            makeReady(index);
+            if (tracing) {
+                out << "  进程P" << scheduled[index].getPID() << "到达，加入就绪队列" << std::endl;
+            }
+        }
+    };
+    // 按协议重新计算有效优先级；优先级继承沿等待链把变化传递给持锁者
+    auto refreshPriority = [&](size_t index) {
+        if (protocol_ == LockProtocol::NONE) {
+            return;
+        }
+        for (size_t steps = 0; index != kIdle && steps < count; ++steps) {
+            int priority = baseOf(index);
+            for (int mutex_id : held[index]) {
+                if (protocol_ == LockProtocol::PRIORITY_CEILING) {
+                    priority = std::min(priority, ceiling[mutex_id]);
+                } else {
+                    for (const Waiter& waiter : primitives[mutex_id]->getWaiters()) {
+                        priority = std::min(priority, effective[index_of.at(waiter.pid)]);
+                    }
+                }
+            }
+            if (priority == effective[index]) {
+                return;
+            }
+            if (priority < effective[index]) {
+                result.processes[index].boosts++;
+            }
+            effective[index] = priority;
+            if (tracing) {
+                out << "  进程P" << scheduled[index].getPID() << "的有效优先级变为" << priority << std::endl;
+            }
+            if (by_priority && scheduled[index].getState() == ProcessState::READY) {
+                ready.emplace(keyOf(index), index, ++version[index]);
+            }
+            index = protocol_ == LockProtocol::PRIORITY_INHERITANCE && waiting_for[index] >= 0
+                        ? ownerOf(waiting_for[index]) : kIdle;
+        }
+    };
+    auto acquired = [&](size_t index, int mutex_id) {
+        held[index].push_back(mutex_id);
+        refreshPriority(index);
+    };
+    auto released = [&](size_t index, int mutex_id) {
+        held[index].erase(std::find(held[index].begin(), held[index].end(), mutex_id));
+        refreshPriority(index);
+    };
+    auto blockOnMutex = [&](size_t index, int mutex_id) {
+        mutexAt(mutex_id).block(scheduled[index].getPID(), current_time);
+        waiting_for[index] = mutex_id;
+        mutex_waiters++;
+        refreshPriority(ownerOf(mutex_id));
+    };
+    // 按优先级唤醒时，把有效优先级最高的等待者（相同时先来者）移到队首
+    auto promoteBest = [&](SyncPrimitive& primitive) {
+        if (!priority_waits_ || primitive.getWaiters().size() < 2) {
+            return;
+        }
+        int best = primitive.getWaiters().front().pid;
+        for (const Waiter& waiter : primitive.getWaiters()) {
+            if (effective[index_of.at(waiter.pid)] < effective[index_of.at(best)]) {
+                best = waiter.pid;
+            }
+        }
+        primitive.promoteWaiter(best);
+    };
+    // 阻塞中的进程获得资源，回到就绪队列
+    auto wake = [&](int pid) {
+        size_t index = index_of.at(pid);
+        result.processes[index].blocked_time += current_time - blocked_since[index];
+        makeReady(index);
+        if (tracing) {
+            out << "  进程P" << pid << "被唤醒，回到就绪队列" << std::endl;
+        }
+    };
+    // 释放互斥锁，锁直接交给下一个等待者
+    auto unlockMutex = [&](size_t index, int mutex_id) {
+        Mutex& mutex = mutexAt(mutex_id);
+        promoteBest(mutex);
+        int next_owner = mutex.unlock(scheduled[index].getPID(), current_time);
+        released(index, mutex_id);
+        if (next_owner >= 0) {
+            size_t next_index = index_of.at(next_owner);
+            waiting_for[next_index] = -1;
+            mutex_waiters--;
+            acquired(next_index, mutex_id);
+            wake(next_owner);
+        }
+    };
+    // 条件变量的等待者被唤醒后重新加锁
+    auto signalled = [&](int pid) {
+        size_t index = index_of.at(pid);
+        Mutex& mutex = mutexAt(reacquire[index]);
+        if (mutex.tryLock(pid, current_time)) {
+            acquired(index, reacquire[index]);
+            wake(pid);
+        } else {
+            blockOnMutex(index, reacquire[index]);
+            if (tracing) {
+                out << "  进程P" << pid << "被唤醒，等待重新获得" << mutex.getName() << std::endl;
+            }
+        }
+    };
+    // 统计一段时间内的优先级反转：等待链上有比等待者基础优先级更低的持锁者
+    auto accountInversion = [&](int duration) {
+        if (duration <= 0 || mutex_waiters == 0) {
+            return;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            if (waiting_for[i] < 0) {
+                continue;
+            }
+            bool inverted = false;
+            bool running_on_chain = false;
+            size_t holder = ownerOf(waiting_for[i]);
+            for (size_t steps = 0; holder != kIdle && steps < count; ++steps) {
+                inverted = inverted || baseOf(holder) > baseOf(i);
+                running_on_chain = running_on_chain || holder == running;
+                holder = waiting_for[holder] >= 0 ? ownerOf(waiting_for[holder]) : kIdle;
+            }
+            if (!inverted) {
+                continue;
+            }
+            result.processes[i].inversion_time += duration;
+            if (running != kIdle && !running_on_chain && baseOf(running) > baseOf(i)) {
+                result.processes[i].unbounded_inversion_time += duration;
+            }
+        }
+    };
+    // 进行进程在当前执行进度上的同步操作，返回进程是否因此阻塞
+    auto performActions = [&](size_t index) -> bool {
+        if (scripts[index] == nullptr) {
+            return false;
+        }
+        const std::vector<SyncAction>& script = *scripts[index];
+        const int pid = scheduled[index].getPID();
+        const int executed = scheduled[index].getBurstTime() - scheduled[index].getRemainingTime();
+        while (next_action[index] < script.size() && script[next_action[index]].at == executed) {
+            const SyncAction& action = script[next_action[index]++];
+            if (tracing) {
+                out << "时间 " << current_time << ": 进程P" << pid << " " << actionName(action.type)
+                    << " " << primitives[action.object]->getName() << std::endl;
+            }
+            bool blocked = false;
+            switch (action.type) {
+                case SyncActionType::LOCK:
+                    if (mutexAt(action.object).tryLock(pid, current_time)) {
+                        acquired(index, action.object);
+                    } else {
+                        blockOnMutex(index, action.object);
+                        blocked = true;
+                    }
+                    break;
+                case SyncActionType::UNLOCK:
+                    unlockMutex(index, action.object);
+                    break;
+                case SyncActionType::SEM_WAIT:
+                    if (!semaphoreAt(action.object).tryWait(pid, current_time)) {
+                        semaphoreAt(action.object).block(pid, current_time);
+                        blocked = true;
+                    }
+                    break;
+                case SyncActionType::SEM_SIGNAL: {
+                    promoteBest(semaphoreAt(action.object));
+                    int woken = semaphoreAt(action.object).signal(current_time);
+                    if (woken >= 0) {
+                        wake(woken);
+                    }
+                    break;
+                }
+                case SyncActionType::CV_WAIT:
+                    unlockMutex(index, action.mutex);
+                    conditionAt(action.object).wait(pid, current_time);
+                    reacquire[index] = action.mutex;
+                    blocked = true;
+                    break;
+                case SyncActionType::CV_SIGNAL: {
+                    promoteBest(conditionAt(action.object));
+                    int woken = conditionAt(action.object).signal(current_time);
+                    if (woken >= 0) {
+                        signalled(woken);
+                    }
+                    break;
+                }
+                case SyncActionType::CV_BROADCAST:
+                    for (int woken : conditionAt(action.object).broadcast(current_time)) {
+                        signalled(woken);
+                    }
+                    break;
+            }
+
+            if (blocked) {
+                if (tracing) {
+                    out << "  进程P" << pid << "进入等待队列" << std::endl;
+                }
+                return true;
+            }
+        }
+        return false;
+    };
+
+    if (tracing) {
+        out << "\n=== " << getName() << "过程演示 ===" << std::endl;
+        out << "======================================" << std::endl;
+    }
+
+    while (completed < count) {
+        admitArrivals();
+
+        if (preempt_on_ready && running != kIdle && outranks(running)) {
+            if (tracing) {
+                out << "时间 " << current_time << ": 进程P" << scheduled[running].getPID()
+                    << "被进程P" << scheduled[std::get<1>(ready.top())].getPID() << "抢占" << std::endl;
+            }
+            makeReady(running);
+            running = kIdle;
+        }
+
+        if (running == kIdle) {
+            pruneReady();
+            if (ready.empty()) {
+                if (next_arrival == count) {
+                    // 没有就绪进程也不会再有进程到达：剩下的进程全部阻塞
+                    result.deadlocked = true;
+                    break;
+                }
+                int arrival_time = scheduled[arrivals[next_arrival]].getArrivalTime();
+                if (tracing) {
+                    out << "时间 " << current_time << "-" << arrival_time << ": CPU空闲" << std::endl;
+                }
+                accountInversion(arrival_time - current_time);
+                result.idle_time += arrival_time - current_time;
+                current_time = arrival_time;
+                continue;
+            }
+
+            running = std::get<1>(ready.top());
+            ready.pop();
+            Process& process = scheduled[running];
+            if (process.isFirstRun()) {
+                process.setStartTime(current_time);
+                process.setResponseTime(current_time - process.getArrivalTime());
+                process.setFirstRun(false);
+            }
+            process.setState(ProcessState::RUNNING);
+            decisions++;
+            slice_left = time_quantum_;
+
+            if (tracing) {
+                out << "时间 " << current_time << ": 开始执行进程 P" << process.getPID()
+                    << " (" << process.getName() << ")，剩余时间: " << process.getRemainingTime() << std::endl;
+            }
+        }
+
+        // 先进行当前进度上的同步操作，阻塞则让出CPU
+        if (performActions(running)) {
+            scheduled[running].setState(ProcessState::WAITING);
+            blocked_since[running] = current_time;
+            result.processes[running].blocks++;
+            running = kIdle;
+            continue;
+        }
+        // 唤醒的进程或降回的优先级可能使当前进程立即被抢占
+        if (preempt_on_ready && outranks(running)) {
+            continue;
+        }
+
+        // 运行到完成、下一个同步操作、时间片用完或下一个到达时刻（仅抢占式）中最早者
+        Process& process = scheduled[running];
+        int executed = process.getBurstTime() - process.getRemainingTime();
+        int run_time = process.getRemainingTime();
+        if (scripts[running] != nullptr && next_action[running] < scripts[running]->size()) {
+            run_time = std::min(run_time, (*scripts[running])[next_action[running]].at - executed);
+        }
+        if (time_sliced) {
+            run_time = std::min(run_time, slice_left);
+        }
+        if (preempt_on_ready && next_arrival < count) {
+            run_time = std::min(run_time, scheduled[arrivals[next_arrival]].getArrivalTime() - current_time);
+        }
+
+        accountInversion(run_time);
+        process.execute(run_time);
+        current_time += run_time;
+        slice_left -= run_time;
+
+        if (process.isCompleted()) {
+            // 执行结束时的操作（如解锁、V操作）在完成之前进行
+            performActions(running);
+            process.setCompletionTime(current_time);
+            process.calculateTimes(current_time);
+            completed++;
+            running = kIdle;
+            if (tracing) {
+                out << "时间 " << current_time << ": 进程P" << process.getPID() << "执行完成！" << std::endl;
+            }
+            continue;
+        }
+        process.setState(ProcessState::RUNNING);
+
+        if (time_sliced && slice_left <= 0) {
+            if (tracing) {
+                out << "  时间片用完，进程P" << process.getPID() << "回到就绪队列" << std::endl;
+            }
+            // 先接纳同一时刻新到达的进程，再回到队尾
+            admitArrivals();
+            makeReady(running);
+            running = kIdle;
+        }
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        if (scheduled[i].getState() == ProcessState::WAITING) {
+            result.processes[i].blocked_time += current_time - blocked_since[i];
+            result.deadlocked_pids.push_back(scheduled[i].getPID());
+        }
+        result.inversion_time += result.processes[i].inversion_time;
+        result.unbounded_inversion_time += result.processes[i].unbounded_inversion_time;
+    }
+    if (result.deadlocked && tracing) {
+        out << "时间 " << current_time << ": 剩余进程全部阻塞，发生死锁！" << std::endl;
+    }
+
+    for (const auto& primitive : primitives) {
+        primitive->finish(current_time);
+        result.primitives.push_back({primitive->getId(), primitive->getName(), primitive->getKind(),
+                                     primitive->getStats()});
+    }
+
+    // 按基础优先级统计已完成进程的周转时间尾部和反转时间
+    for (int level = static_cast<int>(ProcessPriority::HIGHEST); level <= static_cast<int>(ProcessPriority::LOWEST); ++level) {
+        std::vector<int> turnarounds;
+        PriorityLevelReport report{static_cast<ProcessPriority>(level), 0, 0.0, 0, 0, 0, 0};
+        for (size_t i = 0; i < count; ++i) {
+            if (baseOf(i) != level) {
+                continue;
+            }
+            report.total_inversion_time += result.processes[i].inversion_time;
+            report.max_inversion_time = std::max(report.max_inversion_time, result.processes[i].inversion_time);
+            if (scheduled[i].isCompleted()) {
+                turnarounds.push_back(scheduled[i].getTurnaroundTime());
+            }
+        }
+        if (turnarounds.empty()) {
+            continue;
+        }
+        std::sort(turnarounds.begin(), turnarounds.end());
+        size_t rank = static_cast<size_t>(std::ceil(0.95 * turnarounds.size()));
+        report.processes = static_cast<int>(turnarounds.size());
+        report.average_turnaround = std::accumulate(turnarounds.begin(), turnarounds.end(), 0.0) / turnarounds.size();
+        report.p95_turnaround = turnarounds[rank - 1];
+        report.max_turnaround = turnarounds.back();
+        result.priority_levels.push_back(report);
+    }
+
+    result.scheduling.processes = scheduled;
+    fillStatistics(result.scheduling, current_time);
+    result.scheduling.scheduling_decisions = decisions;
+    return result;
+}
+
+// 获取算法类型
+std::string SyncScheduler::getAlgorithmType() const {
+    std::string order = SchedulerFactory::getSchedulerTypeName(type_);
+    if (isPreemptive() && type_ != SchedulerFactory::SchedulerType::ROUND_ROBIN) {
+        order += "（抢占式）";
+    }
+    if (protocol_ != LockProtocol::NONE) {
+        order += "，" + getLockProtocolName(protocol_);
+    }
+    return "同步感知调度 (" + order + ")";
+}
+
+// 是否为抢占式调度
+bool SyncScheduler::isPreemptive() const {
+    return type_ == SchedulerFactory::SchedulerType::ROUND_ROBIN ||
+           (preemptive_ && (type_ == SchedulerFactory::SchedulerType::SJF ||
+                            type_ == SchedulerFactory::SchedulerType::PRIORITY));
+}
+
+// 获取锁协议名称
+std::string SyncScheduler::getLockProtocolName(LockProtocol protocol) {
+    switch (protocol) {
+        case LockProtocol::NONE:                 return "无优先级协议";
+        case LockProtocol::PRIORITY_INHERITANCE: return "优先级继承";
+        case LockProtocol::PRIORITY_CEILING:     return "优先级天花板";
+    }
+    return "未知协议";
+}
+
+// 打印同步统计
+void SyncScheduler::displaySyncResult(const SyncSimulationResult& result) {
+    const SchedulingResult& scheduling = result.scheduling;
+    std::cout << "\n🔗 同步统计：" << std::endl;
+    std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "吞吐率: " << scheduling.throughput << " 进程/时间单位" << std::endl;
+    std::cout << "CPU利用率: " << scheduling.cpu_utilization << "%  （空闲 " << result.idle_time
+              << " / " << scheduling.total_time << " 时间单位）" << std::endl;
+    std::cout << "锁协议: " << getLockProtocolName(result.protocol)
+              << "  优先级反转合计: " << result.inversion_time
+              << "（其中被中间优先级进程拉长: " << result.unbounded_inversion_time << "）" << std::endl;
+    if (result.deadlocked) {
+        std::cout << "⚠️  发生死锁，阻塞的进程:";
+        for (int pid : result.deadlocked_pids) {
+            std::cout << " P" << pid;
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "\n各同步原语：" << std::endl;
+    for (const auto& primitive : result.primitives) {
+        const PrimitiveStats& stats = primitive.stats;
+        std::cout << "  [" << primitive.kind << "] " << primitive.name
+                  << ": 获得 " << stats.acquisitions << " 次（其中 " << stats.contended << " 次需要等待）"
+                  << "，平均等待 " << stats.averageWaitTime() << "，最长等待 " << stats.max_wait_time
+                  << "，最长等待队列 " << stats.max_queue_length
+                  << "，有进程等待的时长 " << stats.contended_time << std::endl;
+        if (stats.total_hold_time > 0) {
+            std::cout << "      平均持有 " << stats.averageHoldTime() << "，最长持有 " << stats.max_hold_time
+                      << "，护航交接 " << stats.convoy_handoffs << " 次，最长护航 " << stats.longest_convoy
+                      << std::endl;
+        }
+    }
+
+    std::cout << "\n⏳ 各进程阻塞时间：" << std::endl;
+    for (const auto& process : result.processes) {
+        std::cout << "  P" << std::setw(4) << std::left << process.pid << std::right
+                  << " 阻塞 " << std::setw(3) << process.blocks << " 次，共 "
+                  << process.blocked_time << " 时间单位";
+        if (process.inversion_time > 0) {
+            std::cout << "，优先级反转 " << process.inversion_time
+                      << "（无界部分 " << process.unbounded_inversion_time << "）";
+        }
+        if (process.boosts > 0) {
+            std::cout << "，优先级被提升 " << process.boosts << " 次";
+        }
+        std::cout << std::endl;
+    }
+
+    std::cout << "\n📈 各优先级周转时间：" << std::endl;
+    std::cout << "┌────────┬────────┬──────────┬──────────┬──────────┬──────────┬──────────┐" << std::endl;
+    std::cout << "│ 优先级 │ 进程数 │ 平均周转 │ P95周转  │ 最长周转 │ 反转合计 │ 最长反转 │" << std::endl;
+    std::cout << "├────────┼────────┼──────────┼──────────┼──────────┼──────────┼──────────┤" << std::endl;
+    for (const auto& level : result.priority_levels) {
+        std::cout << "│ " << std::setw(6) << static_cast<int>(level.priority)
+                  << " │ " << std::setw(6) << level.processes
+                  << " │ " << std::setw(8) << level.average_turnaround
+                  << " │ " << std::setw(8) << level.p95_turnaround
+                  << " │ " << std::setw(8) << level.max_turnaround
+                  << " │ " << std::setw(8) << level.total_inversion_time
+                  << " │ " << std::setw(8) << level.max_inversion_time << " │" << std::endl;
+    }
+    std::cout << "└────────┴────────┴──────────┴──────────┴──────────┴──────────┴──────────┘" << std::endl;
+}
+
+} // namespace ZTS_OS
@@ -1,8 +1,12 @@
 #include "../../include/utils/memory_demo.h"
 #include "../../include/memory/ContiguousAllocator.h"
+#include "../../include/memory/BuddyAllocator.h"
+#include "../../include/memory/SlabAllocator.h"
+#include "../../include/memory/PageTraceAnalyzer.h"
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <algorithm>
 
 /**
  * @file memory_demo.cpp
@@ -35,6 +39,35 @@ MemoryDemo::MemoryDemo() {
         MemoryRequest(5, "IDE", 180),
         MemoryRequest(6, "浏览器", 120)
     });
+    
+    // 初始化预设的页面访问场景
+    page_access_scenarios_.push_back({7, 0, 1, 2, 0, 3, 0, 4, 2, 3, 0, 3, 2, 1, 2, 0, 1, 7, 0, 1});
+    page_access_scenarios_.push_back({1, 2, 3, 4, 1, 2, 5, 1, 2, 3, 4, 5});
+    
+    // 循环访问：工作集比页框多几页，LRU/FIFO每次都缺页
+    std::vector<int> looping;
+    for (int round = 0; round < 20; ++round) {
+        for (int page = 0; page < 12; ++page) {
+            looping.push_back(page);
+        }
+    }
+    page_access_scenarios_.push_back(looping);
+    
+    // 热点加扫描：少量热点页中间穿插一次性的顺序扫描
+    std::vector<int> scanning;
+    int scan_page = 100;
+    for (int round = 0; round < 30; ++round) {
+        for (int page = 0; page < 6; ++page) {
+            scanning.push_back(page);
+            scanning.push_back(page % 3);
+        }
+        if (round % 3 == 2) {
+            for (int i = 0; i < 16; ++i) {
+                scanning.push_back(scan_page++);
+            }
+        }
+    }
+    page_access_scenarios_.push_back(scanning);
 }
 
 // 启动内存管理演示主界面
@@ -69,16 +102,15 @@ void MemoryDemo::start() {
                 pauseForUser();
                 break;
             }
-            case 3: {
-                ConsoleColor::setColor(ConsoleColor::LIGHT_YELLOW);
-                std::cout << "\n🔧 页面置换算法演示正在开发中，敬请期待！" << std::endl;
-                ConsoleColor::resetColor();
-                pauseForUser();
+            case 3:
+                pageReplacementDemo();
                 break;
-            }
             case 4:
                 allocationComparisonDemo();
                 break;
+            case 5:
+                slabAllocatorDemo();
+                break;
             case 0:
                 ConsoleColor::setColor(ConsoleColor::LIGHT_BLUE);
                 std::cout << "\n👋 返回主菜单..." << std::endl;
@@ -117,14 +149,17 @@ void MemoryDemo::showMainMenu() {
     std::cout << "2. 📄 分页内存管理演示（开发中）" << std::endl;
     std::cout << "   └─ 页表管理、地址转换、页面分配" << std::endl;
     std::cout << "\n";
-    std::cout << "3. 🔄 页面置换算法演示（开发中）" << std::endl;
-    std::cout << "   └─ FIFO、LRU、LFU、Clock算法" << std::endl;
-    std::cout << "\n";
     
     ConsoleColor::setColor(ConsoleColor::LIGHT_GREEN);
+    std::cout << "3. 🔄 页面置换算法比较" << std::endl;
+    std::cout << "   └─ FIFO、LRU、LFU、Clock、ARC、2Q、LIRS、CLOCK-Pro、WSClock" << std::endl;
+    std::cout << "\n";
     std::cout << "4. 📊 分配算法性能比较" << std::endl;
     std::cout << "   └─ 对比不同分配算法的性能指标" << std::endl;
     std::cout << "\n";
+    std::cout << "5. 🧱 Slab对象缓存演示" << std::endl;
+    std::cout << "   └─ 固定大小对象缓存、kmalloc大小类别、slab利用率" << std::endl;
+    std::cout << "\n";
     
     ConsoleColor::setColor(ConsoleColor::LIGHT_YELLOW);
     std::cout << "0. 🚪 返回主菜单" << std::endl;
@@ -251,15 +286,227 @@ void MemoryDemo::allocationComparisonDemo() {
     pauseForUser();
 }
 
+// Slab对象缓存演示
+void MemoryDemo::slabAllocatorDemo() {
+    system("cls");
+    showTitle("Slab对象缓存演示");
+    
+    // slab从伙伴系统按4KB申请
+    BuddyAllocator pages(getMemorySize());
+    SlabAllocator slab(pages, 4, 1);
+    int task_cache = slab.createCache("task_struct", 1728);
+    int inode_cache = slab.createCache("inode", 600);
+    int dentry_cache = slab.createCache("dentry", 192);
+    
+    ConsoleColor::setColor(ConsoleColor::LIGHT_BLUE);
+    std::cout << "\n🔄 创建进程、打开文件并分配若干kmalloc对象..." << std::endl;
+    ConsoleColor::resetColor();
+    
+    std::vector<long long> tasks;
+    std::vector<long long> dentries;
+    std::vector<long long> buffers;
+    for (int i = 0; i < 16; ++i) {
+        tasks.push_back(slab.allocate(task_cache));
+    }
+    for (int i = 0; i < 40; ++i) {
+        slab.allocate(inode_cache);
+    }
+    for (int i = 0; i < 120; ++i) {
+        dentries.push_back(slab.allocate(dentry_cache));
+    }
+    const size_t buffer_sizes[] = {24, 100, 200, 500, 1000};
+    for (int i = 0; i < 60; ++i) {
+        buffers.push_back(slab.kmalloc(buffer_sizes[i % 5]));
+    }
+    slab.displayStatus();
+    
+    ConsoleColor::setColor(ConsoleColor::LIGHT_BLUE);
+    std::cout << "\n🔄 一半进程退出，释放其目录项和缓冲区..." << std::endl;
+    ConsoleColor::resetColor();
+    for (size_t i = 0; i < tasks.size(); i += 2) {
+        if (tasks[i] >= 0) slab.deallocate(tasks[i]);
+    }
+    for (size_t i = 0; i < dentries.size(); i += 2) {
+        if (dentries[i] >= 0) slab.deallocate(dentries[i]);
+    }
+    for (size_t i = 0; i < buffers.size(); i += 2) {
+        if (buffers[i] >= 0) slab.kfree(buffers[i]);
+    }
+    slab.displayStatus();
+    
+    std::cout << "\n🔧 回收空slab: " << slab.shrink() << " 个" << std::endl;
+    std::cout << "页面来源（伙伴系统）: 已分配 " << pages.getUsedSize() << " KB，外部碎片 "
+              << std::fixed << std::setprecision(1) << pages.getFragmentation() << "%" << std::endl;
+    std::cout << "\n💡 部分使用的slab无法归还，释放顺序越分散，slab利用率越低。" << std::endl;
+    
+    pauseForUser();
+}
+
+// 页面置换算法演示
+void MemoryDemo::pageReplacementDemo() {
+    system("cls");
+    showTitle("页面置换算法比较");
+    
+    std::cout << "\n请选择页面访问序列：" << std::endl;
+    std::cout << "1. 📘 教材经典序列 (7,0,1,2,0,3,0,4,2,3,0,3,2,1,2,0,1,7,0,1)" << std::endl;
+    std::cout << "2. 🧪 Belady异常序列 (1,2,3,4,1,2,5,1,2,3,4,5)" << std::endl;
+    std::cout << "3. 🔁 循环访问 (0~11循环20轮)" << std::endl;
+    std::cout << "4. 📜 热点页穿插顺序扫描" << std::endl;
+    
+    int scenario_choice;
+    std::cout << "\n请选择序列: ";
+    std::cin >> scenario_choice;
+    if (std::cin.fail() || scenario_choice < 1 ||
+        scenario_choice > static_cast<int>(page_access_scenarios_.size())) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        scenario_choice = 1;
+        ConsoleColor::setColor(ConsoleColor::LIGHT_YELLOW);
+        std::cout << "⚠️ 使用默认序列：教材经典序列" << std::endl;
+        ConsoleColor::resetColor();
+    }
+    
+    size_t frame_count;
+    ConsoleColor::setColor(ConsoleColor::LIGHT_YELLOW);
+    std::cout << "\n🧮 请输入物理页框数 (1-64，建议3-10): ";
+    ConsoleColor::resetColor();
+    std::cin >> frame_count;
+    if (std::cin.fail() || frame_count < 1 || frame_count > 64) {
+        std::cin.clear();
+        std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+        frame_count = 3;
+        ConsoleColor::setColor(ConsoleColor::LIGHT_YELLOW);
+        std::cout << "⚠️ 使用默认页框数: 3" << std::endl;
+        ConsoleColor::resetColor();
+    }
+    
+    comparePageReplacementAlgorithms(page_access_scenarios_[scenario_choice - 1], frame_count);
+    displayLruFaultCurve(page_access_scenarios_[scenario_choice - 1], frame_count);
+    pauseForUser();
+}
+
+// 比较不同的页面置换算法
+void MemoryDemo::comparePageReplacementAlgorithms(const std::vector<int>& access_sequence,
+                                                  size_t frame_count) {
+    struct AlgorithmResult {
+        std::string name;
+        long long page_faults;
+        double fault_rate;
+    };
+    
+    const PageReplacementAlgorithm algorithms[] = {
+        PageReplacementAlgorithm::FIFO,
+        PageReplacementAlgorithm::LRU,
+        PageReplacementAlgorithm::LFU,
+        PageReplacementAlgorithm::CLOCK,
+        PageReplacementAlgorithm::ARC,
+        PageReplacementAlgorithm::TWO_QUEUE,
+        PageReplacementAlgorithm::LIRS,
+        PageReplacementAlgorithm::CLOCK_PRO,
+        PageReplacementAlgorithm::WS_CLOCK
+    };
+    
+    int max_page = 0;
+    for (int page : access_sequence) {
+        max_page = std::max(max_page, page);
+    }
+    
+    // 所有算法使用同一序列、同样的页框数，页面大小取1KB使页号等于虚拟地址
+    std::vector<AlgorithmResult> results;
+    for (auto algorithm : algorithms) {
+        PagingManager manager(frame_count, 1, algorithm);
+        manager.allocatePages(1, static_cast<size_t>(max_page) + 1);
+        for (int page : access_sequence) {
+            if (manager.accessPage(1, static_cast<size_t>(page)) < 0) {
+                manager.handlePageFault(1, page);
+            }
+        }
+        results.push_back({getAlgorithmName(algorithm), manager.getPageFaultCount(),
+                           manager.getPageFaultRate()});
+    }
+    
+    // 离线最优置换作为下界
+    long long optimal_faults = PageTraceAnalyzer::countOptimalFaults(access_sequence, frame_count);
+    double optimal_rate = access_sequence.empty() ? 0.0
+        : static_cast<double>(optimal_faults) / access_sequence.size() * 100.0;
+    
+    ConsoleColor::setColor(ConsoleColor::LIGHT_GREEN);
+    std::cout << "\n📊 页面置换算法比较结果（" << access_sequence.size() << " 次访问，"
+              << frame_count << " 个页框）：" << std::endl;
+    std::cout << "┌─────────────────────┬────────────────┬────────────────┬────────────────┬────────────────┐" << std::endl;
+    std::cout << "│      置换算法       │    缺页次数    │     缺页率     │     命中率     │  比OPT多缺页   │" << std::endl;
+    std::cout << "├─────────────────────┼────────────────┼────────────────┼────────────────┼────────────────┤" << std::endl;
+    for (const auto& result : results) {
+        std::cout << "│ " << std::setw(19) << result.name
+                  << " │ " << std::setw(14) << result.page_faults
+                  << " │ " << std::setw(13) << std::fixed << std::setprecision(1) << result.fault_rate << "%"
+                  << " │ " << std::setw(13) << std::fixed << std::setprecision(1) << 100.0 - result.fault_rate << "%"
+                  << " │ " << std::setw(14) << result.page_faults - optimal_faults
+                  << " │" << std::endl;
+    }
+    std::cout << "├─────────────────────┼────────────────┼────────────────┼────────────────┼────────────────┤" << std::endl;
+    std::cout << "│ " << std::setw(19) << "OPT (Belady)"
+              << " │ " << std::setw(14) << optimal_faults
+              << " │ " << std::setw(13) << std::fixed << std::setprecision(1) << optimal_rate << "%"
+              << " │ " << std::setw(13) << std::fixed << std::setprecision(1) << 100.0 - optimal_rate << "%"
+              << " │ " << std::setw(14) << 0
+              << " │" << std::endl;
+    std::cout << "└─────────────────────┴────────────────┴────────────────┴────────────────┴────────────────┘" << std::endl;
+    std::cout << "注：OPT需要预知整个访问序列，只能离线计算，作为任何在线算法缺页次数的下界。" << std::endl;
+    
+    auto best = std::min_element(results.begin(), results.end(),
+        [](const auto& a, const auto& b) { return a.page_faults < b.page_faults; });
+    std::cout << "\n🏆 缺页最少: " << best->name << " (" << best->page_faults << " 次)" << std::endl;
+    std::cout << "💡 循环序列比页框多几页时，LRU一类算法每次都缺页，2Q和LIRS依靠历史信息保留部分页面；" << std::endl;
+    std::cout << "   顺序扫描穿插热点页时，ARC、LIRS、CLOCK-Pro不会让一次性的扫描页冲掉热点页。" << std::endl;
+    ConsoleColor::resetColor();
+}
+
+// 显示LRU在各页框数下的缺页曲线
+void MemoryDemo::displayLruFaultCurve(const std::vector<int>& access_sequence, size_t frame_count) {
+    std::vector<long long> faults = PageTraceAnalyzer::computeLruFaultCurve(access_sequence);
+    if (faults.size() < 2) {
+        return;
+    }
+    
+    // 不同页面较多时按步长抽取若干行，当前页框数总会显示
+    const size_t max_rows = 16;
+    size_t distinct_pages = faults.size() - 1;
+    size_t step = (distinct_pages + max_rows - 1) / max_rows;
+    double total = static_cast<double>(access_sequence.size());
+    
+    ConsoleColor::setColor(ConsoleColor::LIGHT_CYAN);
+    std::cout << "\n📈 LRU缺页曲线（一遍栈距离分析得到全部页框数的结果，共 "
+              << distinct_pages << " 个不同页面）：" << std::endl;
+    ConsoleColor::resetColor();
+    for (size_t frames = 1; frames <= distinct_pages; ++frames) {
+        if (frames % step != 0 && frames != 1 && frames != frame_count && frames != distinct_pages) {
+            continue;
+        }
+        double rate = faults[frames] / total * 100.0;
+        if (frames == frame_count) {
+            ConsoleColor::setColor(ConsoleColor::LIGHT_GREEN);
+        }
+        std::cout << std::setw(5) << frames << " 页框 │" << std::string(static_cast<size_t>(rate / 2.5), '#')
+                  << " " << faults[frames] << " (" << std::fixed << std::setprecision(1) << rate << "%)"
+                  << (frames == frame_count ? "  ◀ 当前" : "") << std::endl;
+        ConsoleColor::resetColor();
+    }
+    std::cout << "💡 超过 " << distinct_pages << " 个页框后只剩首次访问的冷启动缺页，曲线不再下降。" << std::endl;
+}
+
 // 比较不同的分配算法
 void MemoryDemo::compareAllocationAlgorithms(const std::vector<MemoryRequest>& requests) {
     struct AlgorithmResult {
         std::string name;
         double final_utilization;
         double final_fragmentation;
+        double internal_fragmentation;
         int allocation_failures;
     };
     
+    size_t memory_size = getMemorySize();
+    
     std::vector<AlgorithmResult> results;
     std::vector<MemoryAllocationStrategy> strategies = {
         MemoryAllocationStrategy::FIRST_FIT,
@@ -269,7 +516,7 @@ void MemoryDemo::compareAllocationAlgorithms(const std::vector<MemoryRequest>& r
     };
     
     for (auto strategy : strategies) {
-        ContiguousAllocator allocator(getMemorySize(), strategy);
+        ContiguousAllocator allocator(memory_size, strategy);
         int failures = 0;
         
         ConsoleColor::setColor(ConsoleColor::LIGHT_BLUE);
@@ -291,6 +538,36 @@ void MemoryDemo::compareAllocationAlgorithms(const std::vector<MemoryRequest>& r
             getStrategyName(strategy),
             allocator.getMemoryUtilization(),
             allocator.getFragmentation(),
+            0.0,
+            failures
+        });
+    }
+    
+    // 伙伴系统：按2的幂分配，另外统计内部碎片
+    {
+        BuddyAllocator allocator(memory_size);
+        int failures = 0;
+        
+        ConsoleColor::setColor(ConsoleColor::LIGHT_BLUE);
+        std::cout << "\n🔄 测试 伙伴系统 (Buddy)..." << std::endl;
+        ConsoleColor::resetColor();
+        
+        for (const auto& request : requests) {
+            if (request.is_release) {
+                allocator.deallocateMemory(request.process_id);
+            } else {
+                int result = allocator.allocateMemory(request.size, request.process_id, request.name);
+                if (result == -1) {
+                    failures++;
+                }
+            }
+        }
+        
+        results.push_back({
+            "伙伴系统 (Buddy)",
+            static_cast<double>(allocator.getRequestedSize()) / allocator.getTotalSize() * 100.0,
+            allocator.getFragmentation(),
+            allocator.getInternalFragmentation(),
             failures
         });
     }
@@ -300,18 +577,20 @@ void MemoryDemo::compareAllocationAlgorithms(const std::vector<MemoryRequest>& r
     std::cout << "\n📊 算法性能比较结果：" << std::endl;
     std::cout << "━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━━" << std::endl;
     
-    std::cout << "┌─────────────────────┬────────────────┬────────────────┬────────────────┐" << std::endl;
-    std::cout << "│      分配算法       │   内存利用率   │   碎片化程度   │   分配失败次数 │" << std::endl;
-    std::cout << "├─────────────────────┼────────────────┼────────────────┼────────────────┤" << std::endl;
+    std::cout << "┌─────────────────────┬────────────────┬────────────────┬────────────────┬────────────────┐" << std::endl;
+    std::cout << "│      分配算法       │   内存利用率   │   外部碎片     │   内部碎片     │   分配失败次数 │" << std::endl;
+    std::cout << "├─────────────────────┼────────────────┼────────────────┼────────────────┼────────────────┤" << std::endl;
     
     for (const auto& result : results) {
         std::cout << "│ " << std::setw(19) << result.name
                   << " │ " << std::setw(13) << std::fixed << std::setprecision(1) << result.final_utilization << "%"
                   << " │ " << std::setw(13) << std::fixed << std::setprecision(1) << result.final_fragmentation << "%"
+                  << " │ " << std::setw(13) << std::fixed << std::setprecision(1) << result.internal_fragmentation << "%"
                   << " │ " << std::setw(14) << result.allocation_failures
                   << " │" << std::endl;
     }
-    std::cout << "└─────────────────────┴────────────────┴────────────────┴────────────────┘" << std::endl;
+    std::cout << "└─────────────────────┴────────────────┴────────────────┴────────────────┴────────────────┘" << std::endl;
+    std::cout << "注：连续分配按请求大小精确分配，没有内部碎片；伙伴系统的利用率按请求大小计算，向上取整多占的部分计入内部碎片。" << std::endl;
     
     // 找出最优算法
     auto best_utilization = std::max_element(results.begin(), results.end(),
@@ -324,7 +603,7 @@ void MemoryDemo::compareAllocationAlgorithms(const std::vector<MemoryRequest>& r
     std::cout << "\n🏆 性能分析：" << std::endl;
     std::cout << "• 最高内存利用率: " << best_utilization->name 
               << " (" << std::fixed << std::setprecision(1) << best_utilization->final_utilization << "%)" << std::endl;
-    std::cout << "• 最低碎片化程度: " << least_fragmentation->name 
+    std::cout << "• 最低外部碎片: " << least_fragmentation->name 
               << " (" << std::fixed << std::setprecision(1) << least_fragmentation->final_fragmentation << "%)" << std::endl;
     std::cout << "• 最少分配失败: " << least_failures->name 
               << " (" << least_failures->allocation_failures << " 次)" << std::endl;
@@ -371,4 +650,20 @@ std::string MemoryDemo::getStrategyName(MemoryAllocationStrategy strategy) {
     return ContiguousAllocator::getStrategyName(strategy);
 }
 
+// 获取置换算法名称
+std::string MemoryDemo::getAlgorithmName(PageReplacementAlgorithm algorithm) {
+    switch (algorithm) {
+        case PageReplacementAlgorithm::FIFO: return "FIFO";
+        case PageReplacementAlgorithm::LRU: return "LRU";
+        case PageReplacementAlgorithm::LFU: return "LFU";
+        case PageReplacementAlgorithm::CLOCK: return "Clock";
+        case PageReplacementAlgorithm::ARC: return "ARC";
+        case PageReplacementAlgorithm::TWO_QUEUE: return "2Q";
+        case PageReplacementAlgorithm::LIRS: return "LIRS";
+        case PageReplacementAlgorithm::CLOCK_PRO: return "CLOCK-Pro";
+        case PageReplacementAlgorithm::WS_CLOCK: return "WSClock";
+        default: return "未知算法";
+    }
+}
+
 } // namespace ZTS_OS 
\ No newline at end of file
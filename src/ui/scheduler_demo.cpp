@@ -3,6 +3,9 @@
 #include "../../include/algorithms/RoundRobinScheduler.h"
 #include "../../include/algorithms/SJFScheduler.h"
 #include "../../include/algorithms/PriorityScheduler.h"
+#include "../../include/algorithms/MultiCoreScheduler.h"
+#include "../../include/algorithms/MonteCarloSimulator.h"
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
 #include <limits>
@@ -130,6 +133,18 @@ void SchedulerDemo::start() {
                 pauseForUser();
                 break;
             }
+            case 4:
+                multiCoreDemo(createSampleProcesses(2));
+                pauseForUser();
+                break;
+            case 5:
+                energyComparisonDemo(createSampleProcesses(2));
+                pauseForUser();
+                break;
+            case 6:
+                monteCarloDemo();
+                pauseForUser();
+                break;
             case 0:
                 ConsoleColor::setColor(ConsoleColor::LIGHT_BLUE);
                 std::cout << "\n👋 返回主菜单..." << std::endl;
@@ -169,6 +184,15 @@ void SchedulerDemo::showMainMenu() {
     std::cout << "3. ⚙️  自定义进程（开发中）" << std::endl;
     std::cout << "   └─ 手动创建和配置进程参数" << std::endl;
     std::cout << "\n";
+    std::cout << "4. 🖥️  异构多核调度" << std::endl;
+    std::cout << "   └─ 场景二在1个大核+2个小核上运行，对比各放置策略与单核调度" << std::endl;
+    std::cout << "\n";
+    std::cout << "5. 🔋 能耗对比" << std::endl;
+    std::cout << "   └─ 场景二按能耗与能耗延迟积比较各调度算法、频率调节器与放置策略" << std::endl;
+    std::cout << "\n";
+    std::cout << "6. 🎲 蒙特卡洛模拟" << std::endl;
+    std::cout << "   └─ 在大量随机负载上比较各调度算法，给出均值与95%置信区间" << std::endl;
+    std::cout << "\n";
     
     ConsoleColor::setColor(ConsoleColor::LIGHT_YELLOW);
     std::cout << "0. 🚪 返回主菜单" << std::endl;
@@ -436,4 +460,206 @@ void SchedulerDemo::compareAlgorithms(const ProcessList& processes) {
     ConsoleColor::resetColor();
 }
 
-} // namespace ZTS_OS 
\ No newline at end of file
+// 异构多核调度演示
+void SchedulerDemo::multiCoreDemo(const ProcessList& processes) {
+    showTitle("异构多核调度");
+    displayProcessTable(processes);
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n平台：1个大核（速度2.0，功耗4.0）+ 2个小核（速度1.0，功耗1.0）。" << std::endl;
+    std::cout << "单核基准是同一出队顺序在一个速度1.0的核心上运行，即src/scheduler/中的单核调度器。" << std::endl;
+    std::cout << "最快空闲核心优先用大核；能耗感知优先用单位工作量能耗低的小核；亲和性保持尽量不换核心。" << std::endl;
+    ConsoleColor::resetColor();
+
+    const SchedulerFactory::SchedulerType orders[] = {
+        SchedulerFactory::SchedulerType::FCFS, SchedulerFactory::SchedulerType::ROUND_ROBIN,
+        SchedulerFactory::SchedulerType::SJF, SchedulerFactory::SchedulerType::PRIORITY
+    };
+    const PlacementPolicy placements[] = {
+        PlacementPolicy::FASTEST_AVAILABLE, PlacementPolicy::ENERGY_AWARE, PlacementPolicy::AFFINITY_PRESERVING
+    };
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n┌──────────────┬──────────────┬──────────────┬──────────────┬──────────────┬──────────┐" << std::endl;
+    std::cout << "│   出队顺序   │   放置策略   │ 平均等待时间 │ 平均周转时间 │  总执行时间  │ 迁移次数 │" << std::endl;
+    std::cout << "├──────────────┼──────────────┼──────────────┼──────────────┼──────────────┼──────────┤" << std::endl;
+    for (auto order : orders) {
+        MultiCoreScheduler single(order, PlacementPolicy::FASTEST_AVAILABLE, 2);
+        single.addCores("base", 1, 1.0);
+        MultiCoreResult baseline = single.schedule(processes);
+        std::cout << "│ " << std::setw(12) << SchedulerFactory::getSchedulerTypeName(order)
+                  << " │ " << std::setw(12) << "单核基准"
+                  << " │ " << std::setw(12) << baseline.average_waiting_time
+                  << " │ " << std::setw(12) << baseline.average_turnaround_time
+                  << " │ " << std::setw(12) << baseline.makespan
+                  << " │ " << std::setw(8) << baseline.migrations << " │" << std::endl;
+
+        for (auto placement : placements) {
+            MultiCoreScheduler scheduler(order, placement, 2);
+            scheduler.addCores("big", 1, 2.0, 4.0);
+            scheduler.addCores("little", 2, 1.0, 1.0);
+            scheduler.setMigrationCost(0.5);
+            MultiCoreResult result = scheduler.schedule(processes);
+            std::cout << "│ " << std::setw(12) << ""
+                      << " │ " << std::setw(12) << MultiCoreScheduler::getPlacementPolicyName(placement)
+                      << " │ " << std::setw(12) << result.average_waiting_time
+                      << " │ " << std::setw(12) << result.average_turnaround_time
+                      << " │ " << std::setw(12) << result.makespan
+                      << " │ " << std::setw(8) << result.migrations << " │" << std::endl;
+        }
+    }
+    std::cout << "└──────────────┴──────────────┴──────────────┴──────────────┴──────────────┴──────────┘" << std::endl;
+    std::cout << "进程换核心运行时付出0.5个时间单位的迁移开销。" << std::endl;
+
+    // 时间片轮转下最快空闲核心的详细结果：各核心和各类别的负载
+    MultiCoreScheduler detailed(SchedulerFactory::SchedulerType::ROUND_ROBIN, PlacementPolicy::FASTEST_AVAILABLE, 2);
+    detailed.addCores("big", 1, 2.0, 4.0);
+    detailed.addCores("little", 2, 1.0, 1.0);
+    detailed.setMigrationCost(0.5);
+    MultiCoreScheduler::displayResult(detailed.schedule(processes));
+}
+
+// 能耗对比演示
+void SchedulerDemo::energyComparisonDemo(const ProcessList& processes) {
+    showTitle("能耗对比");
+    displayProcessTable(processes);
+
+    // 单核：运行功率1.0、空闲功率0.1，按能耗从低到高排列
+    std::vector<std::pair<std::string, SchedulingResult>> single_results;
+    std::vector<std::pair<std::string, SchedulerPtr>> schedulers;
+    schedulers.emplace_back("FCFS", SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::FCFS));
+    schedulers.emplace_back("Round Robin", SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, 2));
+    schedulers.emplace_back("SJF", SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::SJF));
+    schedulers.emplace_back("SRTF", std::make_unique<SJFScheduler>(true));
+    schedulers.emplace_back("Priority", SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::PRIORITY));
+    for (auto& entry : schedulers) {
+        entry.second->setTraceEnabled(false);
+        entry.second->setPowerModel(1.0, 0.1);
+        single_results.emplace_back(entry.first, entry.second->schedule(processes));
+    }
+    std::stable_sort(single_results.begin(), single_results.end(), [](const auto& a, const auto& b) {
+        return a.second.energy < b.second.energy;
+    });
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n单核：运行功率1.0，空闲功率0.1。所有算法忙碌时间相同，能耗差别来自空闲时间，" << std::endl;
+    std::cout << "能耗延迟积（能耗×总执行时间）还计入了完成得早晚。" << std::endl;
+    ConsoleColor::resetColor();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n┌──────────────┬──────────────┬──────────────┬──────────────┬──────────────┐" << std::endl;
+    std::cout << "│   算法名称   │     能耗     │  能耗延迟积  │  总执行时间  │ 平均周转时间 │" << std::endl;
+    std::cout << "├──────────────┼──────────────┼──────────────┼──────────────┼──────────────┤" << std::endl;
+    for (const auto& pair : single_results) {
+        std::cout << "│ " << std::setw(12) << pair.first
+                  << " │ " << std::setw(12) << pair.second.energy
+                  << " │ " << std::setw(12) << pair.second.energy_delay_product
+                  << " │ " << std::setw(12) << pair.second.total_time
+                  << " │ " << std::setw(12) << pair.second.average_turnaround_time << " │" << std::endl;
+    }
+    std::cout << "└──────────────┴──────────────┴──────────────┴──────────────┴──────────────┘" << std::endl;
+
+    // 多核：大小核都有频率状态和空闲状态，时间片轮转出队，比较频率调节器与放置策略
+    struct MultiCoreEntry {
+        FrequencyGovernor governor;
+        PlacementPolicy placement;
+        MultiCoreResult result;
+    };
+    const FrequencyGovernor governors[] = {
+        FrequencyGovernor::RACE_TO_IDLE, FrequencyGovernor::ONDEMAND, FrequencyGovernor::SCHEDUTIL
+    };
+    const PlacementPolicy placements[] = {
+        PlacementPolicy::FASTEST_AVAILABLE, PlacementPolicy::ENERGY_AWARE, PlacementPolicy::AFFINITY_PRESERVING
+    };
+    const std::vector<double> frequencies = {0.4, 0.6, 0.8, 1.0};
+    const std::vector<IdleState> idle_states = {{"C1", 0.2, 0.0}, {"C6", 0.02, 3.0}};
+    std::vector<MultiCoreEntry> multi_results;
+    for (auto governor : governors) {
+        for (auto placement : placements) {
+            MultiCoreScheduler scheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, placement, 2);
+            CpuCore big(0, "big", 2.0, 4.0);
+            big.performance_states = CpuCore::cubicPowerCurve(frequencies, 4.0, 0.4);
+            big.idle_states = idle_states;
+            scheduler.addCore(big);
+            for (int id = 1; id <= 2; ++id) {
+                CpuCore little(id, "little", 1.0, 1.0);
+                little.performance_states = CpuCore::cubicPowerCurve(frequencies, 1.0, 0.1);
+                little.idle_states = idle_states;
+                scheduler.addCore(little);
+            }
+            scheduler.setMigrationCost(0.5);
+            scheduler.setGovernor(governor);
+            multi_results.push_back({governor, placement, scheduler.schedule(processes)});
+        }
+    }
+    std::stable_sort(multi_results.begin(), multi_results.end(), [](const auto& a, const auto& b) {
+        return a.result.energy < b.result.energy;
+    });
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n多核：1个大核（速度2.0，满频功耗4.0）+ 2个小核（速度1.0，满频功耗1.0），" << std::endl;
+    std::cout << "频率0.4/0.6/0.8/1.0，功率按静态功率+动态功率×f³；空闲状态C1（0.2）与C6（0.02，至少空闲3）。" << std::endl;
+    ConsoleColor::resetColor();
+    std::cout << "\n┌──────────────┬──────────────┬──────────────┬──────────────┬──────────────┬──────────────┐" << std::endl;
+    std::cout << "│  频率调节器  │   放置策略   │     能耗     │  能耗延迟积  │  总执行时间  │  工作量/能耗 │" << std::endl;
+    std::cout << "├──────────────┼──────────────┼──────────────┼──────────────┼──────────────┼──────────────┤" << std::endl;
+    for (const auto& entry : multi_results) {
+        std::cout << "│ " << std::setw(12) << MultiCoreScheduler::getGovernorName(entry.governor)
+                  << " │ " << std::setw(12) << MultiCoreScheduler::getPlacementPolicyName(entry.placement)
+                  << " │ " << std::setw(12) << entry.result.energy
+                  << " │ " << std::setw(12) << entry.result.energy_delay_product
+                  << " │ " << std::setw(12) << entry.result.makespan
+                  << " │ " << std::setw(12) << entry.result.performance_per_watt << " │" << std::endl;
+    }
+    std::cout << "└──────────────┴──────────────┴──────────────┴──────────────┴──────────────┴──────────────┘" << std::endl;
+
+    // 能耗最低的配置的详细结果：各核心的频率与空闲状态驻留时间
+    ConsoleColor::setColor(ConsoleColor::LIGHT_GREEN);
+    std::cout << "\n🏆 能耗最低：" << MultiCoreScheduler::getGovernorName(multi_results.front().governor)
+              << " + " << MultiCoreScheduler::getPlacementPolicyName(multi_results.front().placement) << std::endl;
+    ConsoleColor::resetColor();
+    MultiCoreScheduler::displayResult(multi_results.front().result);
+}
+
+// 蒙特卡洛模拟演示
+void SchedulerDemo::monteCarloDemo() {
+    showTitle("蒙特卡洛模拟");
+
+    WorkloadSpec spec;
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n负载：每次" << spec.process_count << "个进程，泊松到达（平均间隔" << spec.mean_interarrival
+              << "），执行时间在[" << spec.min_burst << ", " << spec.max_burst << "]上均匀分布。" << std::endl;
+    std::cout << "同一次重复中所有算法调度同一个负载；全部指标的95%置信区间半宽都不超过均值的2%时停止。" << std::endl;
+    ConsoleColor::resetColor();
+
+    MonteCarloSimulator simulator(spec);
+    simulator.addScheduler(SchedulerFactory::SchedulerType::FCFS);
+    simulator.addScheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, 2);
+    simulator.addScheduler(SchedulerFactory::SchedulerType::SJF);
+    simulator.addScheduler("SRTF", []() { return std::make_unique<SJFScheduler>(true); });
+    simulator.addScheduler(SchedulerFactory::SchedulerType::PRIORITY);
+
+    ConsoleColor::setColor(ConsoleColor::LIGHT_BLUE);
+    std::cout << "\n🔄 正在运行..." << std::endl;
+    ConsoleColor::resetColor();
+    std::vector<MonteCarloReport> reports = simulator.run();
+    simulator.displayReports(reports);
+
+    // 平均等待时间最短的算法，以及它的置信区间是否与次优算法分开
+    std::vector<const MonteCarloReport*> ranked;
+    for (const auto& report : reports) {
+        ranked.push_back(&report);
+    }
+    std::sort(ranked.begin(), ranked.end(), [](const MonteCarloReport* a, const MonteCarloReport* b) {
+        return a->waiting_time.mean < b->waiting_time.mean;
+    });
+    ConsoleColor::setColor(ConsoleColor::LIGHT_GREEN);
+    std::cout << "\n🏆 平均等待时间最短: " << ranked[0]->scheduler << std::endl;
+    if (ranked.size() > 1) {
+        bool separated = ranked[0]->waiting_time.upper() < ranked[1]->waiting_time.lower();
+        std::cout << "• 与次优的 " << ranked[1]->scheduler << (separated ? " 置信区间不重叠，差异显著" : " 置信区间重叠，差异不显著")
+                  << std::endl;
+    }
+    ConsoleColor::resetColor();
+}
+
+} // namespace ZTS_OS
@@ -0,0 +1,574 @@
+#include "../../include/utils/sync_demo.h"
+#include <chrono>
+#include <iostream>
+#include <iomanip>
+#include <limits>
+
+/**
+ * @file sync_demo.cpp
+ * @brief 进程同步机制演示器实现
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+namespace ZTS_OS {
+
+// 启动进程同步演示主界面
+void SyncDemo::start() {
+    showTitle("进程同步机制模拟系统");
+
+    while (true) {
+        showMainMenu();
+
+        int choice;
+        std::cout << "\n请输入您的选择: ";
+        std::cin >> choice;
+
+        if (std::cin.fail()) {
+            std::cin.clear();
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
+            ConsoleColor::setColor(ConsoleColor::LIGHT_RED);
+            std::cout << "\n❌ 输入无效，请输入数字！" << std::endl;
+            ConsoleColor::resetColor();
+            pauseForUser();
+            continue;
+        }
+
+        switch (choice) {
+            case 1:
+                mutexContentionDemo();
+                break;
+            case 2:
+                producerConsumerDemo();
+                break;
+            case 3:
+                conditionVariableDemo();
+                break;
+            case 4:
+                contentionSweepDemo();
+                break;
+            case 5:
+                priorityInversionDemo();
+                break;
+            case 6:
+                deadlockDemo();
+                break;
+            case 7:
+                spinParkDemo();
+                break;
+            case 0:
+                ConsoleColor::setColor(ConsoleColor::LIGHT_BLUE);
+                std::cout << "\n👋 返回主菜单..." << std::endl;
+                ConsoleColor::resetColor();
+                return;
+            default:
+                ConsoleColor::setColor(ConsoleColor::LIGHT_RED);
+                std::cout << "\n❌ 无效的选择，请重新输入！" << std::endl;
+                ConsoleColor::resetColor();
+                pauseForUser();
+                break;
+        }
+    }
+}
+
+// 显示演示主菜单
+void SyncDemo::showMainMenu() {
+    system("cls");
+    ConsoleColor::setColor(ConsoleColor::LIGHT_CYAN);
+    std::cout << "\n";
+    std::cout << "╔════════════════════════════════════════════════════════════════════════════════════════════════════════╗" << std::endl;
+    std::cout << "║                                      进程同步机制模拟系统                                                ║" << std::endl;
+    std::cout << "║                                Process Synchronization Simulator                                       ║" << std::endl;
+    std::cout << "╚════════════════════════════════════════════════════════════════════════════════════════════════════════╝" << std::endl;
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n请选择演示功能：" << std::endl;
+    std::cout << "\n";
+
+    ConsoleColor::setColor(ConsoleColor::LIGHT_GREEN);
+    std::cout << "1. 🔒 互斥锁竞争与护航效应" << std::endl;
+    std::cout << "   └─ 持锁进程被时间片抢占，锁在等待者之间依次传递" << std::endl;
+    std::cout << "\n";
+    std::cout << "2. 📦 生产者-消费者（信号量）" << std::endl;
+    std::cout << "   └─ empty/full信号量控制有界缓冲区，互斥锁保护缓冲区" << std::endl;
+    std::cout << "\n";
+    std::cout << "3. 🔔 条件变量" << std::endl;
+    std::cout << "   └─ 等待条件时释放锁，被广播唤醒后重新竞争锁" << std::endl;
+    std::cout << "\n";
+    std::cout << "4. 📊 临界区长度对吞吐率的影响" << std::endl;
+    std::cout << "   └─ 对比不同临界区长度下的阻塞时间、调度次数和吞吐上限" << std::endl;
+    std::cout << "\n";
+    std::cout << "5. ⚖️ 优先级反转与锁协议" << std::endl;
+    std::cout << "   └─ 对比无协议、优先级继承、优先级天花板下高优先级进程的反转时间和尾延迟" << std::endl;
+    std::cout << "\n";
+    std::cout << "6. 🏦 银行家算法与死锁检测" << std::endl;
+    std::cout << "   └─ 教科书示例、哲学家就餐死锁，以及大规模下增量安全性检查与完整扫描的对比" << std::endl;
+    std::cout << "\n";
+    std::cout << "7. 🌀 多核自旋-休眠锁" << std::endl;
+    std::cout << "   └─ 自旋消耗的CPU、唤醒延迟，以及竞争加剧时吞吐率的崩溃" << std::endl;
+    std::cout << "\n";
+
+    ConsoleColor::setColor(ConsoleColor::LIGHT_YELLOW);
+    std::cout << "0. 🚪 返回主菜单" << std::endl;
+
+    ConsoleColor::resetColor();
+}
+
+// 互斥锁竞争与护航效应演示
+void SyncDemo::mutexContentionDemo() {
+    showTitle("互斥锁竞争与护航效应演示");
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n5个进程同时到达，时间片为2，每个进程执行1个单位后加锁，在临界区内再执行4个单位。" << std::endl;
+    std::cout << "持锁进程的时间片用完后，其余进程一上CPU就在锁上阻塞，锁释放后直接交给下一个等待者。" << std::endl;
+    ConsoleColor::resetColor();
+
+    SyncScheduler scheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 2);
+    int lock = scheduler.addMutex("共享表锁");
+
+    ProcessList processes;
+    for (int pid = 1; pid <= 5; ++pid) {
+        processes.emplace_back(pid, "工作进程" + std::to_string(pid), 0, 6);
+        scheduler.setScript(pid, {SyncAction::lock(1, lock), SyncAction::unlock(5, lock)});
+    }
+
+    SyncSimulationResult result = scheduler.run(processes);
+    Scheduler::displayResult(result.scheduling);
+    SyncScheduler::displaySyncResult(result);
+
+    pauseForUser();
+}
+
+// 生产者-消费者演示
+void SyncDemo::producerConsumerDemo() {
+    showTitle("生产者-消费者演示");
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n缓冲区容量为2。两个生产者各生产2件产品，两个消费者各消费2件产品。" << std::endl;
+    std::cout << "生产: P(empty) → 加锁 → 放入 → 解锁 → V(full)；消费: P(full) → 加锁 → 取出 → 解锁 → V(empty)" << std::endl;
+    ConsoleColor::resetColor();
+
+    SyncScheduler scheduler(SchedulerFactory::SchedulerType::FCFS);
+    int empty = scheduler.addSemaphore("empty", 2);
+    int full = scheduler.addSemaphore("full", 0);
+    int buffer = scheduler.addMutex("缓冲区锁");
+
+    ProcessList processes;
+    processes.emplace_back(1, "消费者A", 0, 8);
+    processes.emplace_back(2, "生产者A", 1, 8);
+    processes.emplace_back(3, "消费者B", 2, 8);
+    processes.emplace_back(4, "生产者B", 3, 8);
+
+    for (int pid : {2, 4}) {
+        scheduler.setScript(pid, {
+            SyncAction::wait(1, empty), SyncAction::lock(1, buffer), SyncAction::unlock(2, buffer), SyncAction::signal(2, full),
+            SyncAction::wait(5, empty), SyncAction::lock(5, buffer), SyncAction::unlock(6, buffer), SyncAction::signal(6, full)
+        });
+    }
+    for (int pid : {1, 3}) {
+        scheduler.setScript(pid, {
+            SyncAction::wait(1, full), SyncAction::lock(1, buffer), SyncAction::unlock(2, buffer), SyncAction::signal(2, empty),
+            SyncAction::wait(5, full), SyncAction::lock(5, buffer), SyncAction::unlock(6, buffer), SyncAction::signal(6, empty)
+        });
+    }
+
+    SyncSimulationResult result = scheduler.run(processes);
+    Scheduler::displayResult(result.scheduling);
+    SyncScheduler::displaySyncResult(result);
+
+    pauseForUser();
+}
+
+// 条件变量演示
+void SyncDemo::conditionVariableDemo() {
+    showTitle("条件变量演示");
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n两个工作进程在数据就绪前等待条件变量（等待时释放锁），加载进程准备好数据后广播唤醒。" << std::endl;
+    std::cout << "被唤醒的进程必须重新获得锁才能继续，因此它们会先在锁上排队。" << std::endl;
+    ConsoleColor::resetColor();
+
+    SyncScheduler scheduler(SchedulerFactory::SchedulerType::FCFS);
+    int lock = scheduler.addMutex("状态锁");
+    int ready = scheduler.addConditionVariable("数据就绪");
+
+    ProcessList processes;
+    processes.emplace_back(1, "工作进程A", 0, 4);
+    processes.emplace_back(2, "工作进程B", 0, 4);
+    processes.emplace_back(3, "加载进程", 1, 3);
+
+    for (int pid : {1, 2}) {
+        scheduler.setScript(pid, {SyncAction::lock(1, lock), SyncAction::cvWait(2, ready, lock), SyncAction::unlock(3, lock)});
+    }
+    scheduler.setScript(3, {SyncAction::lock(1, lock), SyncAction::cvBroadcast(2, ready), SyncAction::unlock(2, lock)});
+
+    SyncSimulationResult result = scheduler.run(processes);
+    Scheduler::displayResult(result.scheduling);
+    SyncScheduler::displaySyncResult(result);
+
+    pauseForUser();
+}
+
+// 临界区长度对吞吐率的影响
+void SyncDemo::contentionSweepDemo() {
+    showTitle("临界区长度对吞吐率的影响");
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n6个进程同时到达，每个执行10个单位，时间片为2，临界区从开始执行时进入。" << std::endl;
+    std::cout << "锁每次只能被一个进程持有，因此临界区部分最多每「平均持有时间」完成一次，" << std::endl;
+    std::cout << "临界区越长，这个上限越低，进程在锁上阻塞的时间和调度次数也越多。" << std::endl;
+    ConsoleColor::resetColor();
+
+    std::cout << "\n┌────────┬──────────┬──────────┬──────────┬──────────┬──────────┬────────────────┐" << std::endl;
+    std::cout << "│ 临界区 │ 总时间   │ 平均等待 │ 平均响应 │ 调度次数 │ 阻塞总时 │ 临界区吞吐上限 │" << std::endl;
+    std::cout << "├────────┼──────────┼──────────┼──────────┼──────────┼──────────┼────────────────┤" << std::endl;
+
+    std::cout << std::fixed << std::setprecision(2);
+    for (int critical = 0; critical <= 10; critical += 2) {
+        SyncScheduler scheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 2);
+        scheduler.setTraceEnabled(false);
+        int lock = scheduler.addMutex("共享锁");
+
+        ProcessList processes;
+        for (int pid = 1; pid <= 6; ++pid) {
+            processes.emplace_back(pid, "P" + std::to_string(pid), 0, 10);
+            if (critical > 0) {
+                scheduler.setScript(pid, {SyncAction::lock(0, lock), SyncAction::unlock(critical, lock)});
+            }
+        }
+
+        SyncSimulationResult result = scheduler.run(processes);
+        int blocked = 0;
+        for (const auto& process : result.processes) {
+            blocked += process.blocked_time;
+        }
+        double hold = result.primitives[lock].stats.averageHoldTime();
+
+        std::cout << "│ " << std::setw(6) << critical
+                  << " │ " << std::setw(8) << result.scheduling.total_time
+                  << " │ " << std::setw(8) << result.scheduling.average_waiting_time
+                  << " │ " << std::setw(8) << result.scheduling.average_response_time
+                  << " │ " << std::setw(8) << result.scheduling.scheduling_decisions
+                  << " │ " << std::setw(8) << blocked
+                  << " │ ";
+        if (hold > 0) {
+            std::cout << std::setw(14) << 1.0 / hold;
+        } else {
+            std::cout << std::setw(14) << "-";
+        }
+        std::cout << " │" << std::endl;
+    }
+    std::cout << "└────────┴──────────┴──────────┴──────────┴──────────┴──────────┴────────────────┘" << std::endl;
+
+    pauseForUser();
+}
+
+// 优先级反转与锁协议比较
+void SyncDemo::priorityInversionDemo() {
+    showTitle("优先级反转与锁协议比较");
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n经典场景：低优先级进程L持有总线锁时，高优先级进程H到达并等待该锁，" << std::endl;
+    std::cout << "随后到达的中优先级进程M不需要锁，却能抢占L，使H的等待时间不受临界区长度约束。" << std::endl;
+    ConsoleColor::resetColor();
+
+    const LockProtocol protocols[] = {LockProtocol::NONE, LockProtocol::PRIORITY_INHERITANCE,
+                                      LockProtocol::PRIORITY_CEILING};
+
+    std::cout << "\n┌──────────────┬──────────┬──────────┬──────────┐" << std::endl;
+    std::cout << "│ 锁协议       │ H周转    │ 反转时间 │ 无界部分 │" << std::endl;
+    std::cout << "├──────────────┼──────────┼──────────┼──────────┤" << std::endl;
+    for (LockProtocol protocol : protocols) {
+        SyncScheduler scheduler(SchedulerFactory::SchedulerType::PRIORITY, true);
+        scheduler.setTraceEnabled(false);
+        scheduler.setLockProtocol(protocol);
+        int bus = scheduler.addMutex("总线锁");
+
+        ProcessList processes;
+        processes.emplace_back(1, "L", 0, 6, ProcessPriority::LOWEST);
+        processes.emplace_back(2, "H", 2, 3, ProcessPriority::HIGHEST);
+        processes.emplace_back(3, "M", 3, 10, ProcessPriority::NORMAL);
+        scheduler.setScript(1, {SyncAction::lock(1, bus), SyncAction::unlock(5, bus)});
+        scheduler.setScript(2, {SyncAction::lock(1, bus), SyncAction::unlock(2, bus)});
+
+        SyncSimulationResult result = scheduler.run(processes);
+        std::cout << "│ " << std::setw(12) << std::left << SyncScheduler::getLockProtocolName(protocol) << std::right
+                  << " │ " << std::setw(8) << result.scheduling.processes[1].getTurnaroundTime()
+                  << " │ " << std::setw(8) << result.inversion_time
+                  << " │ " << std::setw(8) << result.unbounded_inversion_time << " │" << std::endl;
+    }
+    std::cout << "└──────────────┴──────────┴──────────┴──────────┘" << std::endl;
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n混合负载：20个不同优先级的进程共享2把锁，等待队列按优先级唤醒。" << std::endl;
+    ConsoleColor::resetColor();
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "\n┌──────────────┬──────────────┬──────────────┬──────────────┬──────────────┐" << std::endl;
+    std::cout << "│ 锁协议       │ 最高级P95周转│ 最高级最长   │ 反转合计     │ 无界部分     │" << std::endl;
+    std::cout << "├──────────────┼──────────────┼──────────────┼──────────────┼──────────────┤" << std::endl;
+    for (LockProtocol protocol : protocols) {
+        SyncScheduler scheduler(SchedulerFactory::SchedulerType::PRIORITY, true);
+        scheduler.setTraceEnabled(false);
+        scheduler.setLockProtocol(protocol);
+        scheduler.setPriorityOrderedWaits(true);
+        int locks[] = {scheduler.addMutex("锁A"), scheduler.addMutex("锁B")};
+
+        ProcessList processes;
+        for (int i = 0; i < 20; ++i) {
+            int pid = i + 1;
+            int burst = 3 + (i * 5) % 8;
+            processes.emplace_back(pid, "P" + std::to_string(pid), (i * 7) % 30, burst,
+                                   static_cast<ProcessPriority>(1 + (i * 3) % 5));
+            int lock = locks[i % 2];
+            scheduler.setScript(pid, {SyncAction::lock(1, lock), SyncAction::unlock(burst - 1, lock)});
+        }
+
+        SyncSimulationResult result = scheduler.run(processes);
+        const PriorityLevelReport& top = result.priority_levels.front();
+        std::cout << "│ " << std::setw(12) << std::left << SyncScheduler::getLockProtocolName(protocol) << std::right
+                  << " │ " << std::setw(12) << top.p95_turnaround
+                  << " │ " << std::setw(12) << top.max_turnaround
+                  << " │ " << std::setw(12) << result.inversion_time
+                  << " │ " << std::setw(12) << result.unbounded_inversion_time << " │" << std::endl;
+    }
+    std::cout << "└──────────────┴──────────────┴──────────────┴──────────────┴──────────────┘" << std::endl;
+
+    pauseForUser();
+}
+
+// 银行家算法与死锁检测演示
+void SyncDemo::deadlockDemo() {
+    showTitle("银行家算法与死锁检测");
+
+    auto resultName = [](RequestResult result) -> std::string {
+        switch (result) {
+            case RequestResult::GRANTED:             return "立即分配";
+            case RequestResult::BLOCKED_UNAVAILABLE: return "资源不足，等待";
+            case RequestResult::BLOCKED_UNSAFE:      return "分配后不安全，等待";
+        }
+        return "未知";
+    };
+    auto vectorText = [](const std::vector<int>& amounts) {
+        std::string text = "(";
+        for (size_t i = 0; i < amounts.size(); ++i) {
+            text += (i > 0 ? ", " : "") + std::to_string(amounts[i]);
+        }
+        return text + ")";
+    };
+
+    // 教科书示例：A/B/C三类资源共10/5/7个实例
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n教科书示例：资源A/B/C共10/5/7个，5个进程声明最大需求并已获得部分资源。" << std::endl;
+    ConsoleColor::resetColor();
+
+    ResourceManager banker(AllocationPolicy::BANKER);
+    banker.addResourceType("A", 10);
+    banker.addResourceType("B", 5);
+    banker.addResourceType("C", 7);
+    const std::vector<std::vector<int>> max_claims = {
+        {7, 5, 3}, {3, 2, 2}, {9, 0, 2}, {2, 2, 2}, {4, 3, 3}};
+    const std::vector<std::vector<int>> allocations = {
+        {0, 1, 0}, {2, 0, 0}, {3, 0, 2}, {2, 1, 1}, {0, 0, 2}};
+    for (int pid = 0; pid < 5; ++pid) {
+        banker.addProcess(pid, max_claims[pid]);
+        banker.request(pid, allocations[pid]);
+    }
+    std::cout << "当前可用资源: " << vectorText(banker.getAvailable())
+              << "，状态" << (banker.isSafeFullScan() ? "安全" : "不安全") << std::endl;
+
+    const std::pair<int, std::vector<int>> requests[] = {
+        {1, {1, 0, 2}}, {4, {3, 3, 0}}, {0, {0, 2, 0}}};
+    for (const auto& item : requests) {
+        RequestResult result = banker.request(item.first, item.second);
+        std::cout << "  P" << item.first << " 申请 " << vectorText(item.second)
+                  << " → " << resultName(result)
+                  << "，可用资源 " << vectorText(banker.getAvailable()) << std::endl;
+    }
+
+    // 哲学家就餐：5把叉子各1个实例，每人先拿左手边再拿右手边
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n哲学家就餐：5把叉子，每位哲学家先拿左边的叉子，再拿右边的叉子。" << std::endl;
+    ConsoleColor::resetColor();
+
+    const AllocationPolicy policies[] = {AllocationPolicy::DETECTION, AllocationPolicy::BANKER};
+    for (AllocationPolicy policy : policies) {
+        ResourceManager table(policy);
+        for (int fork = 0; fork < 5; ++fork) {
+            table.addResourceType("叉子" + std::to_string(fork), 1);
+        }
+        for (int pid = 0; pid < 5; ++pid) {
+            std::vector<int> claim(5, 0);
+            claim[pid] = 1;
+            claim[(pid + 1) % 5] = 1;
+            table.addProcess(pid, claim);
+        }
+
+        std::cout << "\n[" << ResourceManager::getPolicyName(policy) << "]" << std::endl;
+        for (int round = 0; round < 2; ++round) {
+            for (int pid = 0; pid < 5; ++pid) {
+                if (table.isWaiting(pid)) {
+                    continue;
+                }
+                std::vector<int> fork(5, 0);
+                fork[(pid + round) % 5] = 1;
+                RequestResult result = table.request(pid, fork);
+                if (result != RequestResult::GRANTED) {
+                    std::cout << "  哲学家" << pid << " 拿" << table.getResourceName((pid + round) % 5)
+                              << " → " << resultName(result) << std::endl;
+                }
+            }
+        }
+
+        std::vector<int> deadlocked = table.detectDeadlock();
+        std::cout << "  资源分配图" << (table.hasWaitCycle() ? "有环" : "无环")
+                  << "，死锁进程: ";
+        if (deadlocked.empty()) {
+            std::cout << "无";
+        }
+        for (int pid : deadlocked) {
+            std::cout << "哲学家" << pid << " ";
+        }
+        std::cout << std::endl;
+    }
+
+    // 大规模对比：增量安全性检查与教科书式完整扫描
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n大规模对比：2000个进程、16类资源，随机申请和释放10000次，" << std::endl;
+    std::cout << "每次分配前的安全性检查分别用增量归约和完整扫描计时。" << std::endl;
+    ConsoleColor::resetColor();
+
+    const int types = 16;
+    const int process_count = 2000;
+    ResourceManager large(AllocationPolicy::BANKER);
+    for (int type = 0; type < types; ++type) {
+        large.addResourceType("R" + std::to_string(type), 1500);
+    }
+    unsigned int seed = 12345;
+    auto nextRandom = [&seed](int bound) {
+        seed = seed * 1103515245u + 12345u;
+        return static_cast<int>((seed >> 16) % static_cast<unsigned int>(bound));
+    };
+    for (int pid = 0; pid < process_count; ++pid) {
+        std::vector<int> claim(types);
+        for (int type = 0; type < types; ++type) {
+            claim[type] = nextRandom(16);
+        }
+        large.addProcess(pid, claim);
+    }
+
+    double incremental_seconds = 0.0;
+    double full_seconds = 0.0;
+    int full_scans = 0;
+    for (int op = 0; op < 10000; ++op) {
+        int pid = nextRandom(process_count);
+        if (large.isWaiting(pid)) {
+            continue;
+        }
+        if (nextRandom(2) == 0) {
+            std::vector<int> amounts(types);
+            const std::vector<int>& need = large.getNeed(pid);
+            for (int type = 0; type < types; ++type) {
+                amounts[type] = nextRandom(need[type] + 1);
+            }
+            auto start = std::chrono::steady_clock::now();
+            large.request(pid, amounts);
+            incremental_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (op % 50 == 0) {
+                start = std::chrono::steady_clock::now();
+                large.isSafeFullScan();
+                full_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                full_scans++;
+            }
+        } else {
+            auto start = std::chrono::steady_clock::now();
+            large.release(pid, large.getAllocation(pid));
+            incremental_seconds += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    }
+
+    const ResourceManagerStats& stats = large.getStats();
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "  请求 " << stats.requests << " 次，安全性检查 " << stats.safety_checks
+              << " 次，因不安全等待 " << stats.blocked_unsafe
+              << " 次，因资源不足等待 " << stats.blocked_unavailable << " 次" << std::endl;
+    std::cout << "  增量检查平均考察进程数: "
+              << (stats.safety_checks > 0 ? static_cast<double>(stats.safety_visits) / stats.safety_checks : 0.0)
+              << "（共" << process_count << "个进程）" << std::endl;
+    std::cout << std::setprecision(4);
+    std::cout << "  申请/释放总耗时（含增量检查）: " << incremental_seconds * 1000.0 << " ms，摊到每次安全性检查 "
+              << (stats.safety_checks > 0 ? incremental_seconds * 1000.0 / stats.safety_checks : 0.0) << " ms" << std::endl;
+    if (full_scans > 0) {
+        std::cout << "  单次完整扫描平均耗时: " << full_seconds * 1000.0 / full_scans << " ms" << std::endl;
+    }
+
+    pauseForUser();
+}
+
+// 多核自旋-休眠锁演示
+void SyncDemo::spinParkDemo() {
+    showTitle("多核自旋-休眠锁");
+
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n8个核心，线程共用1把锁，每轮临界区外工作12、临界区3，各做100轮。" << std::endl;
+    std::cout << "加锁失败时：纯自旋一直空转；直接休眠付出系统调用并等待唤醒；自旋-休眠先自旋一段再休眠。" << std::endl;
+    std::cout << "线程多于核心后，持锁者会被时间片抢占，自旋者只能空转等它重新上核。" << std::endl;
+    ConsoleColor::resetColor();
+
+    const int budgets[] = {SmpLockSimulator::kSpinForever, 0, 5};
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "\n┌────────┬───────────────────┬───────────────────┬─────────────────────────────┐" << std::endl;
+    std::cout << "│        │ 纯自旋            │ 直接休眠          │ 自旋5后休眠                 │" << std::endl;
+    std::cout << "│ 线程数 │ 吞吐率   自旋占比 │ 吞吐率   唤醒延迟 │ 吞吐率   自旋占比  唤醒延迟 │" << std::endl;
+    std::cout << "├────────┼───────────────────┼───────────────────┼─────────────────────────────┤" << std::endl;
+    for (int threads : {1, 2, 4, 8, 16, 32}) {
+        LockWorkload workload(threads, 100, 3, 12, 1);
+        SmpLockResult results[3];
+        for (int i = 0; i < 3; ++i) {
+            results[i] = SmpLockSimulator(8, budgets[i]).run(workload);
+        }
+        std::cout << "│ " << std::setw(6) << threads
+                  << " │ " << std::setw(7) << results[0].throughput << std::setw(9) << results[0].spin_share << "%"
+                  << " │ " << std::setw(7) << results[1].throughput << std::setw(10) << results[1].average_wakeup_latency
+                  << " │ " << std::setw(7) << results[2].throughput << std::setw(9) << results[2].spin_share << "%"
+                  << std::setw(10) << results[2].average_wakeup_latency << " │" << std::endl;
+    }
+    std::cout << "└────────┴───────────────────┴───────────────────┴─────────────────────────────┘" << std::endl;
+    std::cout << "吞吐率单位：每千时间单位完成的临界区数；唤醒延迟从futex_wake算到被唤醒的线程重新上核。" << std::endl;
+
+    SmpLockSimulator::displayResult(SmpLockSimulator(8, 5).run(LockWorkload(32, 100, 3, 12, 1)));
+
+    // 散列等待队列：桶太少时不同锁的等待者挤在同一条队列里
+    ConsoleColor::setColor(ConsoleColor::WHITE);
+    std::cout << "\n散列等待队列：4个核心、32个线程、8把锁，直接休眠，比较桶数对唤醒扫描的影响。" << std::endl;
+    ConsoleColor::resetColor();
+    for (size_t buckets : {static_cast<size_t>(1), static_cast<size_t>(4), static_cast<size_t>(256)}) {
+        SmpLockSimulator simulator(4, 0);
+        simulator.setFutexBuckets(buckets);
+        SmpLockResult result = simulator.run(LockWorkload(32, 50, 4, 2, 8));
+        const FutexTableStats& futex = result.futex;
+        std::cout << "  " << std::setw(3) << buckets << " 个桶: 唤醒 " << futex.wake_calls << " 次，平均每次扫描 "
+                  << (futex.wake_calls > 0 ? static_cast<double>(futex.scanned) / futex.wake_calls : 0.0)
+                  << " 项，冲突 " << futex.collisions << " 次，最长桶 " << futex.max_bucket_length << std::endl;
+    }
+
+    pauseForUser();
+}
+
+// 暂停并等待用户按键
+void SyncDemo::pauseForUser() {
+    ConsoleColor::setColor(ConsoleColor::CYAN);
+    std::cout << "\n💡 按任意键继续..." << std::endl;
+    ConsoleColor::resetColor();
+    system("pause >nul");
+}
+
+// 清屏并显示标题
+void SyncDemo::showTitle(const std::string& title) {
+    system("cls");
+    ConsoleColor::setColor(ConsoleColor::LIGHT_CYAN);
+    std::cout << "\n" << title << std::endl;
+    ConsoleColor::resetColor();
+}
+
+} // namespace ZTS_OS
@@ -0,0 +1,269 @@
+#include "../include/memory/BuddyAllocator.h"
+#include "../include/memory/ContiguousAllocator.h"
+#include "../include/memory/SlabAllocator.h"
+#include "../include/memory/TlsfAllocator.h"
+#include "test_common.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+/**
+ * @file test_allocators.cpp
+ * @brief 连续分配、伙伴系统、TLSF与slab分配器的布局不变量测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+/// 影子记录：进程ID -> (起始地址, 请求大小)
+using Shadow = std::map<int, std::pair<size_t, size_t>>;
+
+// 块链表铺满[0, 总大小)且互不重叠；统计量与块链表一致；已分配块与影子记录一一对应
+void checkLayout(const MemoryManager& manager, const Shadow& shadow, bool coalesced) {
+    std::vector<MemoryBlock> blocks = manager.getMemoryBlocks();
+    size_t expected_start = 0;
+    size_t used = 0;
+    size_t largest_free = 0;
+    size_t allocated_blocks = 0;
+    bool previous_free = false;
+    for (const auto& block : blocks) {
+        ZTS_CHECK_EQ(block.start_address, expected_start);
+        ZTS_CHECK(block.size > 0);
+        expected_start = block.start_address + block.size;
+        if (block.is_free) {
+            ZTS_CHECK_EQ(block.process_id, -1);
+            largest_free = std::max(largest_free, block.size);
+            // 立即合并的分配器中不会有两个相邻的空闲块
+            ZTS_CHECK(!(coalesced && previous_free));
+        } else {
+            used += block.size;
+            allocated_blocks++;
+            auto found = shadow.find(block.process_id);
+            ZTS_CHECK(found != shadow.end());
+            if (found != shadow.end()) {
+                ZTS_CHECK_EQ(block.start_address, found->second.first);
+                ZTS_CHECK(block.size >= found->second.second);
+            }
+        }
+        previous_free = block.is_free;
+    }
+    ZTS_CHECK_EQ(expected_start, manager.getTotalSize());
+    ZTS_CHECK_EQ(used, manager.getUsedSize());
+    ZTS_CHECK_EQ(allocated_blocks, shadow.size());
+    ZTS_CHECK_EQ(manager.getLargestFreeBlock(), largest_free);
+}
+
+// 空闲块数
+int countFree(const MemoryManager& manager) {
+    int count = 0;
+    for (const auto& block : manager.getMemoryBlocks()) {
+        count += block.is_free ? 1 : 0;
+    }
+    return count;
+}
+
+// 按策略从分配前的块链表推出应选的地址，-1表示放不下
+long long expectedAddress(const std::vector<MemoryBlock>& blocks, size_t size,
+                          MemoryAllocationStrategy strategy) {
+    long long chosen = -1;
+    size_t chosen_size = 0;
+    for (const auto& block : blocks) {
+        if (!block.is_free || block.size < size) {
+            continue;
+        }
+        bool better = chosen < 0 ||
+                      (strategy == MemoryAllocationStrategy::BEST_FIT && block.size < chosen_size) ||
+                      (strategy == MemoryAllocationStrategy::WORST_FIT && block.size > chosen_size);
+        if (better) {
+            chosen = static_cast<long long>(block.start_address);
+            chosen_size = block.size;
+        }
+    }
+    return chosen;
+}
+
+// 随机分配与释放，每一步后检查不变量；check_choice在分配后检查所选块
+template <typename Allocator, typename CheckChoice>
+void runRandomOperations(Allocator& allocator, unsigned seed, size_t max_request, bool coalesced,
+                         CheckChoice check_choice) {
+    allocator.setTraceEnabled(false);
+    std::mt19937 rng(seed);
+    Shadow shadow;
+    int next_pid = 1;
+    for (int step = 0; step < 3000; ++step) {
+        if (shadow.empty() || rng() % 5 < 3) {
+            size_t size = 1 + rng() % max_request;
+            std::vector<MemoryBlock> before = allocator.getMemoryBlocks();
+            int pid = next_pid++;
+            int address = allocator.allocateMemory(size, pid);
+            check_choice(before, size, address);
+            if (address >= 0) {
+                shadow[pid] = std::make_pair(static_cast<size_t>(address), size);
+            }
+        } else {
+            auto victim = shadow.begin();
+            std::advance(victim, rng() % shadow.size());
+            ZTS_CHECK(allocator.deallocateMemory(victim->first));
+            shadow.erase(victim);
+        }
+        checkLayout(allocator, shadow, coalesced);
+        ZTS_CHECK_EQ(allocator.getFreeBlockCount(), countFree(allocator));
+    }
+    ZTS_CHECK(!allocator.deallocateMemory(next_pid));
+}
+
+// 连续分配：四种策略都保持布局不变量，前三种策略选中的块与定义一致
+void testContiguousAllocator() {
+    const MemoryAllocationStrategy strategies[] = {
+        MemoryAllocationStrategy::FIRST_FIT, MemoryAllocationStrategy::BEST_FIT,
+        MemoryAllocationStrategy::WORST_FIT, MemoryAllocationStrategy::NEXT_FIT
+    };
+    for (auto strategy : strategies) {
+        ContiguousAllocator allocator(1000, strategy);
+        runRandomOperations(allocator, 3, 90, true,
+            [strategy](const std::vector<MemoryBlock>& before, size_t size, int address) {
+                long long expected = expectedAddress(before, size, strategy);
+                if (strategy == MemoryAllocationStrategy::NEXT_FIT) {
+                    ZTS_CHECK_EQ(address >= 0, expected >= 0);
+                    return;
+                }
+                if (strategy != MemoryAllocationStrategy::FIRST_FIT && address >= 0 && expected >= 0) {
+                    // 大小相同的候选块之间不规定先后，只比较所选块的大小
+                    auto size_at = [&before](long long start) {
+                        for (const auto& block : before) {
+                            if (static_cast<long long>(block.start_address) == start) {
+                                return block.size;
+                            }
+                        }
+                        return static_cast<size_t>(0);
+                    };
+                    ZTS_CHECK_EQ(size_at(address), size_at(expected));
+                    return;
+                }
+                ZTS_CHECK_EQ(static_cast<long long>(address), expected);
+            });
+    }
+}
+
+// 伙伴系统：块大小是2的幂并按大小对齐，空闲伙伴总是已经合并
+void testBuddyAllocator() {
+    for (size_t total : {1024u, 1000u, 777u}) {
+        BuddyAllocator allocator(total);
+        runRandomOperations(allocator, 5, 100, false,
+            [total](const std::vector<MemoryBlock>& before, size_t size, int address) {
+                size_t rounded = 1;
+                while (rounded < size) {
+                    rounded <<= 1;
+                }
+                ZTS_CHECK_EQ(address >= 0, expectedAddress(before, rounded, MemoryAllocationStrategy::FIRST_FIT) >= 0);
+                (void)total;
+            });
+
+        std::map<std::pair<size_t, size_t>, bool> free_blocks;
+        for (const auto& block : allocator.getMemoryBlocks()) {
+            ZTS_CHECK_EQ(block.size & (block.size - 1), static_cast<size_t>(0));
+            ZTS_CHECK_EQ(block.start_address % block.size, static_cast<size_t>(0));
+            if (block.is_free) {
+                free_blocks[std::make_pair(block.start_address, block.size)] = true;
+            }
+        }
+        for (const auto& entry : free_blocks) {
+            size_t buddy = entry.first.first ^ entry.first.second;
+            ZTS_CHECK(free_blocks.count(std::make_pair(buddy, entry.first.second)) == 0);
+        }
+        size_t free_total = 0;
+        for (int order = 0; order <= allocator.getMaxOrder(); ++order) {
+            free_total += allocator.getFreeCount(order) << order;
+        }
+        ZTS_CHECK_EQ(free_total, allocator.getFreeSize());
+        ZTS_CHECK(allocator.getRequestedSize() <= allocator.getUsedSize());
+    }
+}
+
+// TLSF：布局不变量成立；只要有块不小于请求所在类别的上界就一定分配成功
+void testTlsfAllocator() {
+    TlsfAllocator allocator(4096);
+    runRandomOperations(allocator, 9, 300, true,
+        [](const std::vector<MemoryBlock>& before, size_t size, int address) {
+            if (address >= 0) {
+                return;
+            }
+            // 失败时不存在大小至少为2*size的空闲块（向上取整最多到两倍）
+            ZTS_CHECK(expectedAddress(before, size * 2, MemoryAllocationStrategy::FIRST_FIT) < 0);
+        });
+}
+
+// slab：对象互不重叠、落在所属slab内并按大小类别对齐；统计与影子记录一致；重复释放被拒绝
+void testSlabAllocator() {
+    BuddyAllocator pages(256);
+    pages.setTraceEnabled(false);
+    SlabAllocator slab(pages, 4, 1);
+    std::mt19937 rng(13);
+    std::map<long long, size_t> live;  // 对象地址 -> 大小类别
+    size_t active_bytes = 0;
+
+    for (int step = 0; step < 20000; ++step) {
+        if (live.empty() || rng() % 2 == 0) {
+            size_t size = 1 + rng() % 1500;
+            size_t class_size = SlabAllocator::kMinKmallocSize;
+            while (class_size < size) {
+                class_size <<= 1;
+            }
+            long long address = slab.kmalloc(size);
+            if (address < 0) {
+                continue;
+            }
+            // 与前后相邻对象不重叠
+            auto next = live.lower_bound(address);
+            ZTS_CHECK(next == live.end() || address + static_cast<long long>(class_size) <= next->first);
+            if (next != live.begin()) {
+                auto previous = std::prev(next);
+                ZTS_CHECK(previous->first + static_cast<long long>(previous->second) <= address);
+            }
+            // slab按页对齐，对象在slab内按大小类别排列
+            ZTS_CHECK_EQ(static_cast<size_t>(address % 4096) % class_size, static_cast<size_t>(0));
+            live[address] = class_size;
+            active_bytes += class_size;
+        } else {
+            auto victim = live.begin();
+            std::advance(victim, rng() % live.size());
+            slab.kfree(victim->first);
+            active_bytes -= victim->second;
+            live.erase(victim);
+        }
+        ZTS_CHECK_EQ(slab.getActiveBytes(), active_bytes);
+        ZTS_CHECK_EQ(slab.getSlabBytes(), pages.getUsedSize() * 1024);
+    }
+
+    size_t active_objects = 0;
+    for (int cache = 0; cache < slab.getCacheCount(); ++cache) {
+        SlabCacheStats stats = slab.getCacheStats(cache);
+        active_objects += stats.active_objects;
+        ZTS_CHECK(stats.empty_slabs <= 1);
+        ZTS_CHECK_EQ(stats.total_objects,
+                     (stats.full_slabs + stats.partial_slabs + stats.empty_slabs) * stats.objects_per_slab);
+    }
+    ZTS_CHECK_EQ(active_objects, live.size());
+
+    ZTS_CHECK(!live.empty());
+    if (!live.empty()) {
+        long long address = live.begin()->first;
+        slab.kfree(address);
+        ZTS_CHECK_THROWS(slab.kfree(address), std::invalid_argument);
+        ZTS_CHECK_THROWS(slab.kfree(address + 1), std::invalid_argument);
+    }
+}
+
+} // namespace
+
+int main() {
+    testContiguousAllocator();
+    testBuddyAllocator();
+    testTlsfAllocator();
+    testSlabAllocator();
+    return ZTS_TEST_RESULT();
+}
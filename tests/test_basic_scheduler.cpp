@@ -0,0 +1,166 @@
+#include "../include/algorithms/FCFSScheduler.h"
+#include "../include/algorithms/OnlineScheduler.h"
+#include "../include/algorithms/PriorityScheduler.h"
+#include "../include/algorithms/RoundRobinScheduler.h"
+#include "../include/algorithms/SJFScheduler.h"
+#include "../include/algorithms/SchedulerWorkspace.h"
+#include "test_common.h"
+#include <map>
+#include <memory>
+#include <random>
+
+/**
+ * @file test_basic_scheduler.cpp
+ * @brief BasicScheduler各实例与可复用工作区的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+/**
+ * @struct PolicyCase
+ * @brief 一个BasicScheduler实例及其在在线调度器中的对应配置
+ */
+struct PolicyCase {
+    SchedulerPtr scheduler;
+    SchedulerFactory::SchedulerType type;
+    bool preemptive;
+    int time_quantum;
+};
+
+// 六个BasicScheduler实例，以及它们对外的调度器类
+std::vector<PolicyCase> makePolicies() {
+    std::vector<PolicyCase> cases;
+    cases.push_back({std::make_unique<BasicScheduler<ArrivalOrderSelect, NoPreemption, FifoReadyQueue>>("FCFS", ""),
+                     SchedulerFactory::SchedulerType::FCFS, false, 2});
+    cases.push_back({std::make_unique<BasicScheduler<ArrivalOrderSelect, TimeSlicePreemption, FifoReadyQueue>>(
+                         "RR", "", TimeSlicePreemption(3)),
+                     SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 3});
+    cases.push_back({std::make_unique<ShortestJobFirstPolicy>("SJF", ""),
+                     SchedulerFactory::SchedulerType::SJF, false, 2});
+    cases.push_back({std::make_unique<ShortestRemainingTimePolicy>("SRTF", ""),
+                     SchedulerFactory::SchedulerType::SJF, true, 2});
+    cases.push_back({std::make_unique<NonPreemptivePriorityPolicy>("Priority", ""),
+                     SchedulerFactory::SchedulerType::PRIORITY, false, 2});
+    cases.push_back({std::make_unique<PreemptivePriorityPolicy>("Preemptive Priority", ""),
+                     SchedulerFactory::SchedulerType::PRIORITY, true, 2});
+
+    cases.push_back({std::make_unique<FCFSScheduler>(), SchedulerFactory::SchedulerType::FCFS, false, 2});
+    cases.push_back({std::make_unique<RoundRobinScheduler>(1), SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 1});
+    cases.push_back({std::make_unique<SJFScheduler>(false), SchedulerFactory::SchedulerType::SJF, false, 2});
+    cases.push_back({std::make_unique<SJFScheduler>(true), SchedulerFactory::SchedulerType::SJF, true, 2});
+    cases.push_back({std::make_unique<PriorityScheduler>(false), SchedulerFactory::SchedulerType::PRIORITY, false, 2});
+    cases.push_back({std::make_unique<PriorityScheduler>(true), SchedulerFactory::SchedulerType::PRIORITY, true, 2});
+    for (auto& policy : cases) {
+        policy.scheduler->setTraceEnabled(false);
+    }
+    return cases;
+}
+
+// 随机负载：到达时间有空档也有大量同时到达
+ProcessList randomWorkload(std::mt19937& rng, int count) {
+    ProcessList processes;
+    for (int i = 0; i < count; ++i) {
+        processes.emplace_back(i + 1, "P" + std::to_string(i + 1), static_cast<int>(rng() % (2 * count)),
+                               1 + static_cast<int>(rng() % 9), static_cast<ProcessPriority>(1 + rng() % 5));
+    }
+    return processes;
+}
+
+// 两个调度结果逐进程（按PID对应）、逐项统计相同
+void checkSameResult(const SchedulingResult& actual, const SchedulingResult& expected) {
+    std::map<int, const Process*> by_pid;
+    for (const auto& process : expected.processes) {
+        by_pid[process.getPID()] = &process;
+    }
+    ZTS_CHECK_EQ(actual.processes.size(), expected.processes.size());
+    for (const auto& process : actual.processes) {
+        auto found = by_pid.find(process.getPID());
+        ZTS_CHECK(found != by_pid.end());
+        if (found == by_pid.end()) {
+            continue;
+        }
+        ZTS_CHECK_EQ(process.getStartTime(), found->second->getStartTime());
+        ZTS_CHECK_EQ(process.getCompletionTime(), found->second->getCompletionTime());
+        ZTS_CHECK_EQ(process.getWaitingTime(), found->second->getWaitingTime());
+        ZTS_CHECK_EQ(process.getTurnaroundTime(), found->second->getTurnaroundTime());
+        ZTS_CHECK_EQ(process.getResponseTime(), found->second->getResponseTime());
+    }
+    ZTS_CHECK_EQ(actual.total_time, expected.total_time);
+    ZTS_CHECK_EQ(actual.average_waiting_time, expected.average_waiting_time);
+    ZTS_CHECK_EQ(actual.average_turnaround_time, expected.average_turnaround_time);
+    ZTS_CHECK_EQ(actual.average_response_time, expected.average_response_time);
+    ZTS_CHECK_EQ(actual.cpu_utilization, expected.cpu_utilization);
+    ZTS_CHECK_EQ(actual.throughput, expected.throughput);
+}
+
+// BasicScheduler的六个实例及对外的调度器类都与独立实现的在线调度器一致
+void testInstantiationsMatchBaseline() {
+    std::vector<PolicyCase> policies = makePolicies();
+    std::mt19937 rng(30);
+    for (int round = 0; round < 200; ++round) {
+        ProcessList processes = randomWorkload(rng, 1 + round % 40);
+        for (auto& policy : policies) {
+            OnlineScheduler baseline(policy.type, policy.preemptive, policy.time_quantum);
+            baseline.setTraceEnabled(false);
+            checkSameResult(policy.scheduler->schedule(processes), baseline.schedule(processes));
+            ZTS_CHECK_EQ(policy.scheduler->isPreemptive(), baseline.isPreemptive());
+        }
+    }
+}
+
+/**
+ * @struct Footprint
+ * @brief 工作区各缓冲区的容量与地址
+ */
+struct Footprint {
+    size_t capacity[5];
+    const void* data[5];
+
+    explicit Footprint(const SchedulerWorkspace& workspace)
+        : capacity{workspace.result.processes.capacity(), workspace.staging.capacity(),
+                   workspace.arrivals.capacity(), workspace.fifo.capacity(), workspace.heap.capacity()},
+          data{workspace.result.processes.data(), workspace.staging.data(), workspace.arrivals.data(),
+               workspace.fifo.data(), workspace.heap.data()} {}
+};
+
+// 所有调度器轮流复用一个工作区：每次结果都与新建工作区的schedule()相同，
+// 负载规模不超过已见过的最大规模后，缓冲区不再增长也不再搬迁
+void testWorkspaceReuse() {
+    std::vector<PolicyCase> policies = makePolicies();
+    std::mt19937 rng(33);
+    SchedulerWorkspace workspace;
+    const int kMaxCount = 64;
+
+    // 预热：每个调度器都调度一次最大规模的负载
+    ProcessList largest = randomWorkload(rng, kMaxCount);
+    for (auto& policy : policies) {
+        checkSameResult(policy.scheduler->scheduleInto(largest, workspace), policy.scheduler->schedule(largest));
+    }
+    Footprint warmed(workspace);
+
+    for (int round = 0; round < 400; ++round) {
+        ProcessList processes = randomWorkload(rng, 1 + static_cast<int>(rng() % kMaxCount));
+        PolicyCase& policy = policies[rng() % policies.size()];
+        const SchedulingResult& reused = policy.scheduler->scheduleInto(processes, workspace);
+        ZTS_CHECK(&reused == &workspace.result);
+        checkSameResult(reused, policy.scheduler->schedule(processes));
+
+        Footprint current(workspace);
+        for (int i = 0; i < 5; ++i) {
+            ZTS_CHECK_EQ(current.capacity[i], warmed.capacity[i]);
+            ZTS_CHECK(current.data[i] == warmed.data[i]);
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    testInstantiationsMatchBaseline();
+    testWorkspaceReuse();
+    return ZTS_TEST_RESULT();
+}
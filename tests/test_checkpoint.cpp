@@ -0,0 +1,143 @@
+#include "../include/algorithms/SchedulerCheckpoint.h"
+#include "test_common.h"
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+
+/**
+ * @file test_checkpoint.cpp
+ * @brief 调度器二进制检查点的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+// 检查点格式（版本2）的布局：文件头之后是每个进程一条的定长记录
+const size_t kHeaderSize = 104;
+const size_t kProcessRecordSize = 56;
+const size_t kNameLengthField = 40;
+const size_t kNameOffsetField = 48;
+const size_t kProcessCountField = 40;
+const size_t kNamesSizeField = 88;
+
+// 运行到一半的调度器
+OnlineScheduler makeScheduler() {
+    OnlineScheduler scheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 2);
+    scheduler.submit(Process(1, "alpha", 0, 5));
+    scheduler.submit(Process(2, "beta", 1, 3));
+    scheduler.submit(Process(3, "gamma", 20, 4));
+    scheduler.advanceTo(4);
+    return scheduler;
+}
+
+// 改写第index条进程记录中的一个64位字段
+void patchRecord(SchedulerCheckpoint::Buffer& buffer, size_t index, size_t field, uint64_t value) {
+    std::memcpy(buffer.data() + kHeaderSize + index * kProcessRecordSize + field, &value, sizeof(value));
+}
+
+// 保存后恢复，继续运行的结果与原调度器一致
+void testRoundTrip() {
+    OnlineScheduler original = makeScheduler();
+    SchedulerCheckpoint::Buffer buffer = SchedulerCheckpoint::capture(original);
+
+    // 确认测试中假定的布局与实际格式一致
+    uint32_t name_length = 0;
+    std::memcpy(&name_length, buffer.data() + kHeaderSize + kProcessRecordSize + kNameLengthField,
+                sizeof(name_length));
+    ZTS_CHECK_EQ(name_length, static_cast<uint32_t>(4));
+
+    OnlineScheduler restored(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 2);
+    SchedulerCheckpoint::restore(restored, buffer);
+    ZTS_CHECK_EQ(restored.getCurrentTime(), original.getCurrentTime());
+    ZTS_CHECK(restored.getProcesses()[1].getName() == "beta");
+
+    original.runUntilIdle();
+    restored.runUntilIdle();
+    for (size_t i = 0; i < original.getProcesses().size(); ++i) {
+        ZTS_CHECK_EQ(restored.getProcesses()[i].getCompletionTime(),
+                     original.getProcesses()[i].getCompletionTime());
+    }
+    ZTS_CHECK_EQ(restored.getResult().scheduling_decisions, original.getResult().scheduling_decisions);
+}
+
+// 名称偏移加长度会回绕的记录被当作损坏拒绝，而不是越界读取名称区
+void testRejectsWrappingNameOffset() {
+    OnlineScheduler original = makeScheduler();
+    const uint64_t offsets[] = {
+        std::numeric_limits<uint64_t>::max(),
+        std::numeric_limits<uint64_t>::max() - 2,
+        static_cast<uint64_t>(1) << 63,
+        14  // 名称区共14字节，长度为4的名称从这里开始会越界
+    };
+    for (uint64_t offset : offsets) {
+        SchedulerCheckpoint::Buffer buffer = SchedulerCheckpoint::capture(original);
+        patchRecord(buffer, 1, kNameOffsetField, offset);
+
+        OnlineScheduler target(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 2);
+        ZTS_CHECK_THROWS(SchedulerCheckpoint::restore(target, buffer), std::runtime_error);
+        ZTS_CHECK(target.getProcesses().empty());
+    }
+}
+
+// 截断和版本号错误同样被拒绝
+void testRejectsMalformedHeader() {
+    OnlineScheduler original = makeScheduler();
+    SchedulerCheckpoint::Buffer buffer = SchedulerCheckpoint::capture(original);
+    OnlineScheduler target(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 2);
+
+    ZTS_CHECK_THROWS(SchedulerCheckpoint::restore(target, buffer.data(), buffer.size() - 1), std::runtime_error);
+
+    uint32_t version = 0;
+    std::memcpy(&version, buffer.data() + 8, sizeof(version));
+    ZTS_CHECK_EQ(version, static_cast<uint32_t>(2));
+    version = 99;
+    std::memcpy(buffer.data() + 8, &version, sizeof(version));
+    ZTS_CHECK_THROWS(SchedulerCheckpoint::restore(target, buffer), std::runtime_error);
+}
+
+// 各段计数大到总长度乘加回绕时，仍以runtime_error拒绝，而不是在预留内存时抛出其他异常
+void testRejectsWrappingSectionCounts() {
+    OnlineScheduler original = makeScheduler();
+    SchedulerCheckpoint::Buffer buffer = SchedulerCheckpoint::capture(original);
+    buffer.resize(kHeaderSize);
+
+    // 104 + 进程数*56 + (待到达数+就绪数)*16 + 完成数*8 + 32 恰好回绕到104
+    const uint64_t counts[] = {
+        0x1b6db6db6db6db7ULL,
+        std::numeric_limits<uint64_t>::max() / 64,
+        std::numeric_limits<uint64_t>::max() / 64,
+        std::numeric_limits<uint64_t>::max() / 64,
+    };
+    for (size_t i = 0; i < 4; ++i) {
+        std::memcpy(buffer.data() + kProcessCountField + i * sizeof(uint64_t), &counts[i], sizeof(uint64_t));
+    }
+    const uint64_t names_size = 32;
+    std::memcpy(buffer.data() + kNamesSizeField, &names_size, sizeof(names_size));
+
+    OnlineScheduler target(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 2);
+    ZTS_CHECK_THROWS(SchedulerCheckpoint::restore(target, buffer), std::runtime_error);
+    ZTS_CHECK(target.getProcesses().empty());
+
+    // 单独一个计数接近2^64同样被拒绝
+    for (size_t i = 0; i < 5; ++i) {
+        SchedulerCheckpoint::Buffer copy = SchedulerCheckpoint::capture(original);
+        const uint64_t huge = std::numeric_limits<uint64_t>::max() - i;
+        size_t field = i < 4 ? kProcessCountField + i * sizeof(uint64_t) : kNamesSizeField;
+        std::memcpy(copy.data() + field, &huge, sizeof(huge));
+        ZTS_CHECK_THROWS(SchedulerCheckpoint::restore(target, copy), std::runtime_error);
+    }
+}
+
+} // namespace
+
+int main() {
+    testRoundTrip();
+    testRejectsWrappingNameOffset();
+    testRejectsMalformedHeader();
+    testRejectsWrappingSectionCounts();
+    return ZTS_TEST_RESULT();
+}
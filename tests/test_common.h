@@ -0,0 +1,74 @@
+#ifndef ZTS_TEST_COMMON_H
+#define ZTS_TEST_COMMON_H
+
+#include <iostream>
+#include <string>
+
+/**
+ * @file test_common.h
+ * @brief 单元测试用的断言宏
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ *
+ * 每个测试程序在main中依次调用各测试函数，最后返回ZTS_TEST_RESULT()：
+ * 有断言失败时返回1，ctest据此判定失败。断言失败只记录并继续执行，便于一次看到所有问题。
+ */
+
+namespace ZTS_OS {
+namespace test {
+
+// 失败的断言数
+inline int& failureCount() {
+    static int failures = 0;
+    return failures;
+}
+
+// 记录一次失败
+inline void reportFailure(const char* file, int line, const std::string& message) {
+    failureCount()++;
+    std::cerr << file << ":" << line << ": 断言失败: " << message << std::endl;
+}
+
+} // namespace test
+} // namespace ZTS_OS
+
+/// 条件必须成立
+#define ZTS_CHECK(condition)                                                        \
+    do {                                                                            \
+        if (!(condition)) {                                                         \
+            ::ZTS_OS::test::reportFailure(__FILE__, __LINE__, #condition);          \
+        }                                                                           \
+    } while (0)
+
+/// 两个值必须相等
+#define ZTS_CHECK_EQ(actual, expected)                                              \
+    do {                                                                            \
+        auto zts_actual = (actual);                                                 \
+        auto zts_expected = (expected);                                             \
+        if (!(zts_actual == zts_expected)) {                                        \
+            ::ZTS_OS::test::reportFailure(__FILE__, __LINE__,                       \
+                std::string(#actual " == " #expected "，实际为 ")                   \
+                + std::to_string(zts_actual) + "，期望 " + std::to_string(zts_expected)); \
+        }                                                                           \
+    } while (0)
+
+/// 表达式必须抛出指定类型的异常
+#define ZTS_CHECK_THROWS(expression, exception_type)                                \
+    do {                                                                            \
+        bool zts_thrown = false;                                                    \
+        try {                                                                       \
+            (void)(expression);                                                     \
+        } catch (const exception_type&) {                                           \
+            zts_thrown = true;                                                      \
+        } catch (...) {                                                             \
+        }                                                                           \
+        if (!zts_thrown) {                                                          \
+            ::ZTS_OS::test::reportFailure(__FILE__, __LINE__,                       \
+                #expression " 没有抛出 " #exception_type);                          \
+        }                                                                           \
+    } while (0)
+
+/// 测试程序的返回值
+#define ZTS_TEST_RESULT() (::ZTS_OS::test::failureCount() == 0 ? 0 : 1)
+
+#endif // ZTS_TEST_COMMON_H
@@ -0,0 +1,183 @@
+#include "../include/algorithms/MonteCarloSimulator.h"
+#include "test_common.h"
+#include <cmath>
+#include <stdexcept>
+
+/**
+ * @file test_monte_carlo.cpp
+ * @brief 蒙特卡洛批量模拟器的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+// 测试使用的小负载
+WorkloadSpec smallSpec() {
+    WorkloadSpec spec;
+    spec.process_count = 12;
+    spec.mean_interarrival = 3.0;
+    return spec;
+}
+
+// 注册四种调度器的模拟器
+MonteCarloSimulator makeSimulator(uint64_t seed) {
+    MonteCarloSimulator simulator(smallSpec(), seed);
+    simulator.addScheduler(SchedulerFactory::SchedulerType::FCFS);
+    simulator.addScheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, 3);
+    simulator.addScheduler(SchedulerFactory::SchedulerType::SJF);
+    simulator.addScheduler(SchedulerFactory::SchedulerType::PRIORITY);
+    return simulator;
+}
+
+// 两个估计值逐位相同
+void checkSameEstimate(const MetricEstimate& a, const MetricEstimate& b) {
+    ZTS_CHECK_EQ(a.mean, b.mean);
+    ZTS_CHECK_EQ(a.std_dev, b.std_dev);
+    ZTS_CHECK_EQ(a.half_width, b.half_width);
+    ZTS_CHECK_EQ(a.samples, b.samples);
+}
+
+// 全部指标都满足精度
+bool allPrecise(const std::vector<MonteCarloReport>& reports, const MonteCarloOptions& options) {
+    for (const auto& report : reports) {
+        for (const MetricEstimate* metric : {&report.waiting_time, &report.turnaround_time, &report.response_time,
+                                             &report.cpu_utilization, &report.throughput}) {
+            if (metric->half_width > options.relative_precision * std::fabs(metric->mean) &&
+                metric->half_width > options.absolute_precision) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// 同一种子下，任意线程数得到的重复次数和置信区间逐位相同
+void testReproducibleAcrossThreads() {
+    MonteCarloOptions options;
+    options.relative_precision = 0.03;
+    options.max_replications = 2000;
+
+    std::vector<MonteCarloReport> expected;
+    size_t expected_replications = 0;
+    for (unsigned int threads : {1u, 2u, 3u, 8u, 16u}) {
+        MonteCarloSimulator simulator = makeSimulator(7);
+        options.threads = threads;
+        std::vector<MonteCarloReport> reports = simulator.run(options);
+        if (expected.empty()) {
+            expected = reports;
+            expected_replications = simulator.getReplications();
+            // 精度要求需要多轮才能满足，否则不能说明批次划分与线程数无关
+            ZTS_CHECK(expected_replications > options.min_replications);
+            continue;
+        }
+        ZTS_CHECK_EQ(simulator.getReplications(), expected_replications);
+        ZTS_CHECK_EQ(reports.size(), expected.size());
+        for (size_t s = 0; s < reports.size() && s < expected.size(); ++s) {
+            ZTS_CHECK(reports[s].scheduler == expected[s].scheduler);
+            checkSameEstimate(reports[s].waiting_time, expected[s].waiting_time);
+            checkSameEstimate(reports[s].turnaround_time, expected[s].turnaround_time);
+            checkSameEstimate(reports[s].response_time, expected[s].response_time);
+            checkSameEstimate(reports[s].cpu_utilization, expected[s].cpu_utilization);
+            checkSameEstimate(reports[s].throughput, expected[s].throughput);
+        }
+    }
+}
+
+// 置信区间半宽降到目标以下就停止：停止时满足精度，上一轮结束时还不满足
+void testStopsOnceCiIsNarrow() {
+    // 宽松的精度在第一轮（min_replications次）就满足
+    MonteCarloOptions loose;
+    loose.relative_precision = 1.0;
+    loose.threads = 2;
+    MonteCarloSimulator first = makeSimulator(3);
+    first.run(loose);
+    ZTS_CHECK(first.isConverged());
+    ZTS_CHECK_EQ(first.getReplications(), loose.min_replications);
+
+    // 批次依次为10、15、22、33……（每轮扩大一半）
+    MonteCarloOptions options;
+    options.relative_precision = 0.05;
+    options.max_replications = 5000;
+    options.threads = 4;
+    MonteCarloSimulator simulator = makeSimulator(3);
+    std::vector<MonteCarloReport> reports = simulator.run(options);
+    ZTS_CHECK(simulator.isConverged());
+    ZTS_CHECK(allPrecise(reports, options));
+
+    size_t previous = options.min_replications;
+    while (previous + previous / 2 < simulator.getReplications()) {
+        previous += previous / 2;
+    }
+    ZTS_CHECK(previous < simulator.getReplications());
+    ZTS_CHECK_EQ(previous + previous / 2, simulator.getReplications());
+
+    MonteCarloOptions capped = options;
+    capped.max_replications = previous;
+    MonteCarloSimulator stopped = makeSimulator(3);
+    std::vector<MonteCarloReport> partial = stopped.run(capped);
+    ZTS_CHECK(!stopped.isConverged());
+    ZTS_CHECK_EQ(stopped.getReplications(), previous);
+    ZTS_CHECK(!allPrecise(partial, options));
+
+    // 无法满足的精度一直运行到最大重复次数
+    MonteCarloOptions impossible;
+    impossible.relative_precision = 0.0;
+    impossible.absolute_precision = 0.0;
+    impossible.max_replications = 40;
+    MonteCarloSimulator exhausted = makeSimulator(3);
+    exhausted.run(impossible);
+    ZTS_CHECK(!exhausted.isConverged());
+    ZTS_CHECK_EQ(exhausted.getReplications(), static_cast<size_t>(40));
+}
+
+// 固定的5次重复：均值与按自由度4的t临界值2.776手工计算的置信区间一致
+void testStudentTInterval() {
+    MonteCarloSimulator simulator(smallSpec(), 11);
+    simulator.addScheduler(SchedulerFactory::SchedulerType::FCFS);
+    MonteCarloOptions options;
+    options.min_replications = 5;
+    options.max_replications = 5;
+    options.threads = 3;
+    std::vector<MonteCarloReport> reports = simulator.run(options);
+    ZTS_CHECK_EQ(simulator.getReplications(), static_cast<size_t>(5));
+
+    double values[5];
+    for (size_t k = 0; k < 5; ++k) {
+        SchedulerPtr scheduler = SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::FCFS);
+        scheduler->setTraceEnabled(false);
+        values[k] = scheduler->schedule(simulator.generateWorkload(k)).average_waiting_time;
+    }
+    double mean = (values[0] + values[1] + values[2] + values[3] + values[4]) / 5.0;
+    double squares = 0.0;
+    for (double value : values) {
+        squares += (value - mean) * (value - mean);
+    }
+    double std_dev = std::sqrt(squares / 4.0);
+    double half_width = 2.776 * std_dev / std::sqrt(5.0);
+
+    const MetricEstimate& waiting = reports[0].waiting_time;
+    ZTS_CHECK_EQ(waiting.samples, static_cast<size_t>(5));
+    ZTS_CHECK(std::fabs(waiting.mean - mean) < 1e-12);
+    ZTS_CHECK(std::fabs(waiting.std_dev - std_dev) < 1e-12);
+    ZTS_CHECK(std::fabs(waiting.half_width - half_width) < 1e-12);
+    ZTS_CHECK(std::fabs(waiting.lower() - (mean - half_width)) < 1e-12);
+    ZTS_CHECK(std::fabs(waiting.upper() - (mean + half_width)) < 1e-12);
+    ZTS_CHECK(std_dev > 0);
+
+    MonteCarloSimulator empty(smallSpec());
+    ZTS_CHECK_THROWS(empty.run(), std::logic_error);
+    options.min_replications = 1;
+    ZTS_CHECK_THROWS(simulator.run(options), std::invalid_argument);
+}
+
+} // namespace
+
+int main() {
+    testReproducibleAcrossThreads();
+    testStopsOnceCiIsNarrow();
+    testStudentTInterval();
+    return ZTS_TEST_RESULT();
+}
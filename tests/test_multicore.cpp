@@ -0,0 +1,143 @@
+#include "../include/algorithms/MultiCoreScheduler.h"
+#include "test_common.h"
+#include <algorithm>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+/**
+ * @file test_multicore.cpp
+ * @brief 异构多核调度模拟的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+/**
+ * @struct SingleCoreCase
+ * @brief 单核调度器与多核模拟器的一种对应配置
+ */
+struct SingleCoreCase {
+    SchedulerFactory::SchedulerType type;
+    int time_quantum;
+};
+
+// 随机负载：到达时间集中在很小的范围内制造大量同时到达，输入顺序与PID顺序无关
+ProcessList randomWorkload(std::mt19937& rng, int count) {
+    std::vector<int> pids(count);
+    for (int i = 0; i < count; ++i) {
+        pids[i] = i + 1;
+    }
+    std::shuffle(pids.begin(), pids.end(), rng);
+    ProcessList processes;
+    for (int i = 0; i < count; ++i) {
+        processes.emplace_back(pids[i], "P" + std::to_string(pids[i]),
+                               static_cast<int>(rng() % (count / 2 + 1)),
+                               1 + static_cast<int>(rng() % 9),
+                               static_cast<ProcessPriority>(rng() % 5));
+    }
+    return processes;
+}
+
+// 一个速度为1.0的核心上的多核模拟与单核调度器逐进程一致
+void checkMatchesSingleCore(const ProcessList& processes, const SingleCoreCase& config) {
+    SchedulerPtr scheduler = SchedulerFactory::createScheduler(config.type, config.time_quantum);
+    scheduler->setTraceEnabled(false);
+    SchedulingResult expected = scheduler->schedule(processes);
+
+    MultiCoreScheduler multi_core(config.type, PlacementPolicy::FASTEST_AVAILABLE, config.time_quantum);
+    multi_core.addCores("base", 1, 1.0);
+    MultiCoreResult actual = multi_core.schedule(processes);
+
+    // 单核调度器的结果可能按到达时间重排，按PID对应
+    std::map<int, const Process*> by_pid;
+    for (const auto& process : expected.processes) {
+        by_pid[process.getPID()] = &process;
+    }
+    ZTS_CHECK_EQ(actual.processes.size(), expected.processes.size());
+    for (const auto& record : actual.processes) {
+        auto found = by_pid.find(record.pid);
+        ZTS_CHECK(found != by_pid.end());
+        if (found == by_pid.end()) {
+            continue;
+        }
+        ZTS_CHECK_EQ(record.start_time, static_cast<double>(found->second->getStartTime()));
+        ZTS_CHECK_EQ(record.completion_time, static_cast<double>(found->second->getCompletionTime()));
+        ZTS_CHECK_EQ(record.waiting_time, static_cast<double>(found->second->getWaitingTime()));
+    }
+    ZTS_CHECK_EQ(actual.average_waiting_time, expected.average_waiting_time);
+    ZTS_CHECK_EQ(actual.average_turnaround_time, expected.average_turnaround_time);
+    ZTS_CHECK_EQ(actual.average_response_time, expected.average_response_time);
+    ZTS_CHECK_EQ(actual.makespan, static_cast<double>(expected.total_time));
+}
+
+// 四种出队顺序在单个基准核心上都与对应的单核调度器一致，包括同时到达且输入顺序不按PID的情况
+void testSingleCoreMatchesSchedulers() {
+    std::mt19937 rng(11);
+    const SingleCoreCase cases[] = {
+        {SchedulerFactory::SchedulerType::FCFS, 2},
+        {SchedulerFactory::SchedulerType::ROUND_ROBIN, 1},
+        {SchedulerFactory::SchedulerType::ROUND_ROBIN, 3},
+        {SchedulerFactory::SchedulerType::SJF, 2},
+        {SchedulerFactory::SchedulerType::PRIORITY, 2}
+    };
+    for (int round = 0; round < 200; ++round) {
+        ProcessList processes = randomWorkload(rng, 2 + round % 30);
+        for (const auto& config : cases) {
+            checkMatchesSingleCore(processes, config);
+        }
+    }
+
+    // 同时到达、输入顺序与PID相反：FCFS按PID先后执行
+    ProcessList reversed = {Process(3, "C", 0, 4), Process(2, "B", 0, 2), Process(1, "A", 0, 6)};
+    MultiCoreScheduler fcfs(SchedulerFactory::SchedulerType::FCFS);
+    fcfs.addCores("base", 1, 1.0);
+    MultiCoreResult result = fcfs.schedule(reversed);
+    ZTS_CHECK_EQ(result.processes[2].completion_time, 6.0);
+    ZTS_CHECK_EQ(result.processes[1].completion_time, 8.0);
+    ZTS_CHECK_EQ(result.processes[0].completion_time, 12.0);
+}
+
+// 放置策略：最快核心、单位工作量能耗最低的核心、上次运行的核心
+void testPlacementPolicies() {
+    ProcessList single = {Process(1, "A", 0, 8)};
+
+    MultiCoreScheduler scheduler(SchedulerFactory::SchedulerType::FCFS);
+    scheduler.addCores("little", 1, 1.0, 1.0);
+    scheduler.addCores("big", 1, 2.0, 4.0);
+    MultiCoreResult fastest = scheduler.schedule(single);
+    ZTS_CHECK(fastest.processes[0].completion_class == "big");
+    ZTS_CHECK_EQ(fastest.processes[0].completion_time, 4.0);
+
+    // 小核心单位工作量能耗1.0，大核心2.0
+    scheduler.setPlacementPolicy(PlacementPolicy::ENERGY_AWARE);
+    MultiCoreResult cheapest = scheduler.schedule(single);
+    ZTS_CHECK(cheapest.processes[0].completion_class == "little");
+    ZTS_CHECK_EQ(cheapest.processes[0].completion_time, 8.0);
+    ZTS_CHECK(cheapest.energy < fastest.energy);
+
+    // 时间片轮转中进程只有一个时始终留在原核心上，不发生迁移
+    MultiCoreScheduler round_robin(SchedulerFactory::SchedulerType::ROUND_ROBIN,
+                                   PlacementPolicy::AFFINITY_PRESERVING, 1);
+    round_robin.addCores("core", 4, 1.0);
+    round_robin.setMigrationCost(0.5);
+    MultiCoreResult affinity = round_robin.schedule(single);
+    ZTS_CHECK_EQ(affinity.migrations, 0LL);
+    ZTS_CHECK_EQ(affinity.makespan, 8.0);
+
+    MultiCoreScheduler empty;
+    ZTS_CHECK_THROWS(empty.schedule(single), std::logic_error);
+    ZTS_CHECK_THROWS(MultiCoreScheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN,
+                                        PlacementPolicy::FASTEST_AVAILABLE, 0), std::invalid_argument);
+}
+
+} // namespace
+
+int main() {
+    testSingleCoreMatchesSchedulers();
+    testPlacementPolicies();
+    return ZTS_TEST_RESULT();
+}
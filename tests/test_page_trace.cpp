@@ -0,0 +1,190 @@
+#include "../include/memory/PageTraceAnalyzer.h"
+#include "../include/memory/PagingManager.h"
+#include "test_common.h"
+#include <algorithm>
+#include <list>
+#include <random>
+#include <set>
+#include <stdexcept>
+
+/**
+ * @file test_page_trace.cpp
+ * @brief 访问序列离线分析（OPT、LRU缺页曲线）的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+// 生成几种不同局部性的访问序列
+std::vector<std::vector<int>> makeTraces() {
+    std::vector<std::vector<int>> traces;
+    std::mt19937 rng(17);
+    for (int round = 0; round < 12; ++round) {
+        const int pages = 3 + round * 2;
+        const int length = 60 + round * 25;
+        std::vector<int> uniform, skewed, looping;
+        for (int i = 0; i < length; ++i) {
+            uniform.push_back(static_cast<int>(rng() % pages));
+            int hot = static_cast<int>(rng() % 4);
+            skewed.push_back(rng() % 5 == 0 ? static_cast<int>(rng() % pages) : hot);
+            looping.push_back((i % (pages + 1)) * 7 - 3);  // 含负页号
+        }
+        traces.push_back(uniform);
+        traces.push_back(skewed);
+        traces.push_back(looping);
+    }
+    traces.push_back({});
+    traces.push_back({5});
+    traces.push_back({1, 1, 1, 1});
+    return traces;
+}
+
+// 不同页面数
+size_t distinctPages(const std::vector<int>& trace) {
+    return std::set<int>(trace.begin(), trace.end()).size();
+}
+
+// 逐步模拟OPT：缺页且已满时，逐个向后查找各驻留页面的下一次使用，淘汰最远者
+long long bruteForceOptimal(const std::vector<int>& trace, size_t frames) {
+    std::vector<int> resident;
+    long long faults = 0;
+    for (size_t i = 0; i < trace.size(); ++i) {
+        if (std::find(resident.begin(), resident.end(), trace[i]) != resident.end()) {
+            continue;
+        }
+        faults++;
+        if (resident.size() == frames) {
+            size_t victim = 0;
+            size_t farthest = 0;
+            for (size_t r = 0; r < resident.size(); ++r) {
+                size_t next = i + 1;
+                while (next < trace.size() && trace[next] != resident[r]) {
+                    next++;
+                }
+                if (next > farthest) {
+                    farthest = next;
+                    victim = r;
+                }
+            }
+            resident.erase(resident.begin() + victim);
+        }
+        resident.push_back(trace[i]);
+    }
+    return faults;
+}
+
+// 逐步模拟LRU：链表头为最近使用
+long long bruteForceLru(const std::vector<int>& trace, size_t frames) {
+    std::list<int> stack;
+    long long faults = 0;
+    for (int page : trace) {
+        auto found = std::find(stack.begin(), stack.end(), page);
+        if (found != stack.end()) {
+            stack.erase(found);
+        } else {
+            faults++;
+            if (stack.size() == frames && frames > 0) {
+                stack.pop_back();
+            }
+        }
+        if (frames > 0) {
+            stack.push_front(page);
+        }
+    }
+    return faults;
+}
+
+// 下一次使用位置与逐个向后查找一致
+void testNextUse() {
+    for (const auto& trace : makeTraces()) {
+        std::vector<size_t> next_use = PageTraceAnalyzer::computeNextUse(trace);
+        ZTS_CHECK_EQ(next_use.size(), trace.size());
+        for (size_t i = 0; i < trace.size(); ++i) {
+            size_t expected = PageTraceAnalyzer::kNeverUsed;
+            for (size_t j = i + 1; j < trace.size(); ++j) {
+                if (trace[j] == trace[i]) {
+                    expected = j;
+                    break;
+                }
+            }
+            ZTS_CHECK_EQ(next_use[i], expected);
+        }
+    }
+}
+
+// OPT缺页数与逐步模拟一致，并且不超过LRU
+void testOptimalMatchesBruteForce() {
+    for (const auto& trace : makeTraces()) {
+        for (size_t frames = 1; frames <= distinctPages(trace) + 1; ++frames) {
+            long long optimal = PageTraceAnalyzer::countOptimalFaults(trace, frames);
+            ZTS_CHECK_EQ(optimal, bruteForceOptimal(trace, frames));
+            ZTS_CHECK(optimal <= bruteForceLru(trace, frames));
+            ZTS_CHECK(optimal >= static_cast<long long>(distinctPages(trace)));
+        }
+    }
+    ZTS_CHECK_THROWS(PageTraceAnalyzer::countOptimalFaults({1, 2}, 0), std::invalid_argument);
+}
+
+// 一遍算出的LRU缺页曲线与逐个页框数模拟一致，全量抽样时估计值等于精确值
+void testLruCurveMatchesBruteForce() {
+    for (const auto& trace : makeTraces()) {
+        std::vector<long long> curve = PageTraceAnalyzer::computeLruFaultCurve(trace);
+        ZTS_CHECK_EQ(curve.size(), distinctPages(trace) + 1);
+        for (size_t frames = 0; frames < curve.size(); ++frames) {
+            ZTS_CHECK_EQ(curve[frames], bruteForceLru(trace, frames));
+        }
+        ZTS_CHECK(PageTraceAnalyzer::estimateLruFaultCurve(trace, 1.0) == curve);
+    }
+    ZTS_CHECK_THROWS(PageTraceAnalyzer::estimateLruFaultCurve({1}, 0.0), std::invalid_argument);
+    ZTS_CHECK_THROWS(PageTraceAnalyzer::estimateLruFaultCurve({1}, 1.5), std::invalid_argument);
+}
+
+// 曲线与分页管理器中LRU置换的实际缺页次数一致
+void testLruCurveMatchesPagingManager() {
+    std::mt19937 rng(5);
+    std::vector<int> trace;
+    for (int i = 0; i < 3000; ++i) {
+        trace.push_back(static_cast<int>(rng() % 3 == 0 ? rng() % 48 : rng() % 12));
+    }
+    std::vector<long long> curve = PageTraceAnalyzer::computeLruFaultCurve(trace);
+    for (size_t frames : {1u, 4u, 11u, 20u, 47u}) {
+        PagingManager manager(frames, 1, PageReplacementAlgorithm::LRU);
+        manager.allocatePages(1, 48);
+        long long faults = 0;
+        for (int page : trace) {
+            if (manager.accessPage(1, static_cast<size_t>(page), false) < 0) {
+                faults++;
+                manager.handlePageFault(1, page);
+            }
+        }
+        ZTS_CHECK_EQ(faults, curve[frames]);
+    }
+}
+
+// 抽样估计在大序列上保持在[0, n]内且随页框数不增
+void testEstimateIsMonotone() {
+    std::mt19937 rng(23);
+    std::vector<int> trace;
+    for (int i = 0; i < 200000; ++i) {
+        trace.push_back(static_cast<int>(rng() % 4 == 0 ? rng() % 50000 : rng() % 2000));
+    }
+    std::vector<long long> estimate = PageTraceAnalyzer::estimateLruFaultCurve(trace, 0.01);
+    ZTS_CHECK_EQ(estimate[0], static_cast<long long>(trace.size()));
+    for (size_t frames = 1; frames < estimate.size(); ++frames) {
+        ZTS_CHECK(estimate[frames] >= 0 && estimate[frames] <= estimate[frames - 1]);
+    }
+}
+
+} // namespace
+
+int main() {
+    testNextUse();
+    testOptimalMatchesBruteForce();
+    testLruCurveMatchesBruteForce();
+    testLruCurveMatchesPagingManager();
+    testEstimateIsMonotone();
+    return ZTS_TEST_RESULT();
+}
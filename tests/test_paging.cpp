@@ -0,0 +1,160 @@
+#include "../include/memory/PagingManager.h"
+#include "../include/memory/PageReplacementPolicy.h"
+#include "test_common.h"
+#include <cmath>
+#include <map>
+#include <random>
+#include <unordered_map>
+
+/**
+ * @file test_paging.cpp
+ * @brief 分页管理与页面置换的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+const PageReplacementAlgorithm kAllAlgorithms[] = {
+    PageReplacementAlgorithm::FIFO,
+    PageReplacementAlgorithm::LRU,
+    PageReplacementAlgorithm::LFU,
+    PageReplacementAlgorithm::CLOCK,
+    PageReplacementAlgorithm::ARC,
+    PageReplacementAlgorithm::TWO_QUEUE,
+    PageReplacementAlgorithm::LIRS,
+    PageReplacementAlgorithm::CLOCK_PRO,
+    PageReplacementAlgorithm::WS_CLOCK
+};
+
+// 已占用的页框数
+size_t usedFrames(const PagingManager& manager) {
+    return static_cast<size_t>(manager.getMemoryUtilization() * manager.getTotalFrames() / 100.0 + 0.5);
+}
+
+// 主动置换出的页框回到空闲队列，之后所有页框仍然可用
+void testReplaceReturnsFrame() {
+    for (auto algorithm : kAllAlgorithms) {
+        PagingManager manager(4, 1, algorithm);
+        manager.allocatePages(1, 16);
+        for (int page = 0; page < 4; ++page) {
+            manager.handlePageFault(1, page);
+        }
+        int victim = manager.replaceePage();
+        ZTS_CHECK(victim >= 0 && victim < 4);
+        ZTS_CHECK_EQ(usedFrames(manager), static_cast<size_t>(3));
+
+        // 空出的页框被下一次缺页使用，而且4个页框都能装满
+        ZTS_CHECK_EQ(manager.handlePageFault(1, 10), victim);
+        ZTS_CHECK_EQ(usedFrames(manager), static_cast<size_t>(4));
+    }
+}
+
+// 还有空闲页框时不置换：不会把空闲页框当成牺牲页框
+void testReplaceWithFreeFrames() {
+    for (auto algorithm : kAllAlgorithms) {
+        PagingManager manager(4, 1, algorithm);
+        manager.allocatePages(1, 16);
+        ZTS_CHECK_EQ(manager.replaceePage(), -1);
+        manager.handlePageFault(1, 0);
+        manager.handlePageFault(1, 1);
+        ZTS_CHECK_EQ(manager.replaceePage(), -1);
+        ZTS_CHECK_EQ(usedFrames(manager), static_cast<size_t>(2));
+    }
+}
+
+// 随机访问中穿插主动置换：命中与否、驻留页数都与影子记录一致
+void testReplaceMixedIntoAccesses() {
+    for (auto algorithm : kAllAlgorithms) {
+        for (unsigned seed = 1; seed <= 4; ++seed) {
+            std::mt19937 rng(seed);
+            const size_t frames = 2 + seed * 3;
+            PagingManager manager(frames, 1, algorithm);
+            manager.allocatePages(1, 64);
+
+            std::map<int, int> resident;  // 页框 -> 页号
+            for (int step = 0; step < 5000; ++step) {
+                if (rng() % 8 == 0) {
+                    int victim = manager.replaceePage();
+                    if (resident.size() < frames) {
+                        ZTS_CHECK_EQ(victim, -1);
+                    } else {
+                        ZTS_CHECK(resident.count(victim) == 1);
+                        resident.erase(victim);
+                    }
+                    continue;
+                }
+
+                int page = static_cast<int>(rng() % (frames * 3));
+                bool expected_hit = false;
+                for (const auto& entry : resident) {
+                    expected_hit = expected_hit || entry.second == page;
+                }
+                bool hit = manager.accessPage(1, static_cast<size_t>(page), rng() % 2 == 0) >= 0;
+                ZTS_CHECK_EQ(hit, expected_hit);
+                if (!hit) {
+                    int frame = manager.handlePageFault(1, page);
+                    ZTS_CHECK(frame >= 0 && frame < static_cast<int>(frames));
+                    ZTS_CHECK(resident.size() == frames || resident.count(frame) == 0);
+                    resident[frame] = page;
+                }
+                ZTS_CHECK_EQ(usedFrames(manager), resident.size());
+            }
+        }
+    }
+}
+
+// 像PagingManager一样驱动置换策略，返回访问次数
+long long drivePolicy(PageReplacementPolicy& policy, size_t frames, const std::vector<int>& trace) {
+    std::unordered_map<long long, int> resident;
+    std::vector<long long> frame_keys(frames, PageReplacementPolicy::kNoPage);
+    int next_free = 0;
+    for (int page : trace) {
+        auto found = resident.find(page);
+        if (found != resident.end()) {
+            policy.onHit(found->second, false);
+            continue;
+        }
+        int frame;
+        if (next_free < static_cast<int>(frames)) {
+            frame = next_free++;
+        } else {
+            frame = policy.evict(page);
+            resident.erase(frame_keys[frame]);
+        }
+        policy.onLoad(frame, page);
+        frame_keys[frame] = page;
+        resident[page] = frame;
+    }
+    return static_cast<long long>(trace.size());
+}
+
+// CLOCK-Pro的指针每次访问均摊只转常数步，与页框数无关
+void testClockProHandStepsBounded() {
+    const size_t frames = 16384;
+    std::mt19937 rng(11);
+    std::vector<std::vector<int>> traces(3);
+    for (int i = 0; i < 400000; ++i) {
+        traces[0].push_back(static_cast<int>(rng() % (frames * 2)));
+        double u = std::uniform_real_distribution<double>(0.0, 1.0)(rng);
+        traces[1].push_back(static_cast<int>(frames * 8 * std::pow(u, 3.0)));
+        traces[2].push_back(static_cast<int>(i % (frames + frames / 10)));
+    }
+    for (const auto& trace : traces) {
+        ClockProPolicy policy(frames);
+        long long accesses = drivePolicy(policy, frames, trace);
+        ZTS_CHECK(policy.getHandSteps() <= 4 * accesses);
+    }
+}
+
+} // namespace
+
+int main() {
+    testReplaceReturnsFrame();
+    testReplaceWithFreeFrames();
+    testReplaceMixedIntoAccesses();
+    testClockProHandStepsBounded();
+    return ZTS_TEST_RESULT();
+}
@@ -0,0 +1,228 @@
+#include "../include/algorithms/MultiCoreScheduler.h"
+#include "../include/algorithms/PriorityScheduler.h"
+#include "../include/algorithms/SJFScheduler.h"
+#include "test_common.h"
+#include <cmath>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+/**
+ * @file test_power.cpp
+ * @brief 功耗模型、空闲状态与频率调节器的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+const double kTolerance = 1e-9;
+
+// 调节器测试使用的频率状态
+const std::vector<double> kFrequencies = {0.5, 0.9, 0.95, 1.0};
+const double kSamplingPeriod = 10.0;
+
+// 两个近似相等的浮点数
+bool near(double a, double b) {
+    return std::fabs(a - b) <= kTolerance * std::max(1.0, std::max(std::fabs(a), std::fabs(b)));
+}
+
+// 某个频率状态的运行时间
+double residencyAt(const CoreReport& core, double frequency) {
+    for (const auto& residency : core.frequency_residency) {
+        if (residency.first == frequency) {
+            return residency.second;
+        }
+    }
+    return -1.0;
+}
+
+// 单核调度器：能耗 = 运行功率×忙碌时间 + 空闲功率×空闲时间，能耗延迟积 = 能耗×总执行时间
+void testSingleCorePowerModel() {
+    // 0-3运行P1，3-5空闲，5-7运行P2：忙碌5、空闲2、总执行时间7
+    ProcessList processes = {Process(1, "A", 0, 3, ProcessPriority::LOW),
+                             Process(2, "B", 5, 2, ProcessPriority::HIGH)};
+    std::vector<SchedulerPtr> schedulers;
+    schedulers.push_back(SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::FCFS));
+    schedulers.push_back(SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, 2));
+    schedulers.push_back(SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::SJF));
+    schedulers.push_back(SchedulerFactory::createScheduler(SchedulerFactory::SchedulerType::PRIORITY));
+    schedulers.push_back(std::make_unique<SJFScheduler>(true));
+    schedulers.push_back(std::make_unique<PriorityScheduler>(true));
+
+    for (auto& scheduler : schedulers) {
+        scheduler->setTraceEnabled(false);
+        SchedulingResult unpowered = scheduler->schedule(processes);
+        ZTS_CHECK_EQ(unpowered.energy, 0.0);
+        ZTS_CHECK_EQ(unpowered.energy_delay_product, 0.0);
+
+        scheduler->setPowerModel(2.0, 0.5);
+        SchedulingResult result = scheduler->schedule(processes);
+        ZTS_CHECK_EQ(result.total_time, 7);
+        ZTS_CHECK_EQ(result.energy, 2.0 * 5 + 0.5 * 2);
+        ZTS_CHECK_EQ(result.energy_delay_product, 11.0 * 7);
+
+        ZTS_CHECK_THROWS(scheduler->setPowerModel(-1.0, 0.5), std::invalid_argument);
+        ZTS_CHECK_THROWS(scheduler->setPowerModel(1.0, -0.5), std::invalid_argument);
+    }
+}
+
+// 多核模拟：空闲时间计入目标驻留时间允许的最低功率空闲状态
+void testIdleStateAccounting() {
+    CpuCore core(0, "core", 1.0, 3.0);
+    core.idle_states = {{"C1", 0.5, 0.0}, {"C6", 0.1, 4.0}};
+    MultiCoreScheduler scheduler(SchedulerFactory::SchedulerType::FCFS);
+    scheduler.addCore(core);
+
+    // 0-2运行，空闲1（不足C6的目标驻留时间，进入C1），3-5运行，空闲5（进入C6），10-11运行
+    ProcessList processes = {Process(1, "A", 0, 2), Process(2, "B", 3, 2), Process(3, "C", 10, 1)};
+    MultiCoreResult result = scheduler.schedule(processes);
+    const CoreReport& report = result.cores[0];
+    ZTS_CHECK_EQ(result.makespan, 11.0);
+    ZTS_CHECK_EQ(report.busy_time, 5.0);
+    ZTS_CHECK_EQ(report.idle_residency[0].second, 1.0);
+    ZTS_CHECK_EQ(report.idle_residency[1].second, 5.0);
+    ZTS_CHECK(near(result.energy, 3.0 * 5 + 0.5 * 1 + 0.1 * 5));
+    ZTS_CHECK(near(result.energy_delay_product, result.energy * 11.0));
+    ZTS_CHECK(near(result.performance_per_watt, 5.0 / result.energy));
+}
+
+// 随机负载下每个核心的能耗都等于各频率功率×运行时间 + 各空闲状态功率×驻留时间
+void testEnergyDecomposition() {
+    std::mt19937 rng(35);
+    const FrequencyGovernor governors[] = {FrequencyGovernor::RACE_TO_IDLE, FrequencyGovernor::ONDEMAND,
+                                           FrequencyGovernor::SCHEDUTIL};
+    for (int round = 0; round < 60; ++round) {
+        ProcessList processes;
+        int count = 2 + round % 20;
+        for (int i = 0; i < count; ++i) {
+            processes.emplace_back(i + 1, "P" + std::to_string(i + 1), static_cast<int>(rng() % 40),
+                                   1 + static_cast<int>(rng() % 12));
+        }
+        MultiCoreScheduler scheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN,
+                                     PlacementPolicy::ENERGY_AWARE, 3);
+        for (int c = 0; c < 3; ++c) {
+            CpuCore core(c, c == 0 ? "big" : "little", c == 0 ? 2.0 : 1.0, c == 0 ? 4.0 : 1.0);
+            core.performance_states = CpuCore::cubicPowerCurve({0.4, 0.6, 0.8, 1.0}, core.active_power, 0.2);
+            core.idle_states = {{"C1", 0.3, 0.0}, {"C3", 0.1, 2.0}, {"C6", 0.02, 6.0}};
+            scheduler.addCore(core);
+        }
+        scheduler.setMigrationCost(0.25);
+        scheduler.setGovernor(governors[round % 3], 2.0 + round % 4);
+        MultiCoreResult result = scheduler.schedule(processes);
+
+        double total_energy = 0.0;
+        for (size_t c = 0; c < result.cores.size(); ++c) {
+            const CpuCore& core = scheduler.getCores()[c];
+            const CoreReport& report = result.cores[c];
+            double busy = 0.0;
+            double idle = 0.0;
+            double energy = 0.0;
+            for (size_t s = 0; s < report.frequency_residency.size(); ++s) {
+                busy += report.frequency_residency[s].second;
+                energy += core.performance_states[s].power * report.frequency_residency[s].second;
+            }
+            for (size_t s = 0; s < report.idle_residency.size(); ++s) {
+                idle += report.idle_residency[s].second;
+                energy += core.idle_states[s].power * report.idle_residency[s].second;
+            }
+            ZTS_CHECK(near(busy, report.busy_time));
+            ZTS_CHECK(near(busy + idle, result.makespan));
+            ZTS_CHECK(near(energy, report.energy));
+            if (governors[round % 3] == FrequencyGovernor::RACE_TO_IDLE) {
+                ZTS_CHECK(near(report.frequency_residency.back().second, report.busy_time));
+                ZTS_CHECK(report.frequency_changes <= 1);
+            }
+            total_energy += energy;
+        }
+        ZTS_CHECK(near(total_energy, result.energy));
+        ZTS_CHECK(near(result.energy_delay_product, result.energy * result.makespan));
+    }
+}
+
+/**
+ * @brief 让第二个进程分派时调节器看到指定利用率，返回该核心的统计
+ *
+ * P1（执行时间10）从利用率0开始：调节器先选最低频率0.5，一个采样周期后利用率为1-e^-1，
+ * ondemand与schedutil都选0.9，P1以0.9运行到完成。核心一直忙碌，P2（执行时间1）分派时
+ * 利用率为1-e^(-t/T)；调整核心速度使P1恰好在所需时刻t完成。
+ */
+CoreReport runAtDispatchUtilization(FrequencyGovernor governor, double utilization) {
+    double dispatch_time = -kSamplingPeriod * std::log(1.0 - utilization);
+    // 10 = s·0.5·T + s·0.9·(t - T)
+    double speed = 10.0 / (0.5 * kSamplingPeriod + 0.9 * (dispatch_time - kSamplingPeriod));
+
+    CpuCore core(0, "core", speed, 4.0);
+    core.performance_states = CpuCore::cubicPowerCurve(kFrequencies, 4.0, 0.5);
+    MultiCoreScheduler scheduler(SchedulerFactory::SchedulerType::FCFS);
+    scheduler.addCore(core);
+    scheduler.setGovernor(governor, kSamplingPeriod);
+    MultiCoreResult result = scheduler.schedule({Process(1, "A", 0, 10), Process(2, "B", 0, 1)});
+    ZTS_CHECK(near(result.processes[0].completion_time, dispatch_time));
+    ZTS_CHECK(near(residencyAt(result.cores[0], 0.5), kSamplingPeriod));
+    return result.cores[0];
+}
+
+// ondemand：利用率达到0.8时直接升到最高频率，低于0.8时在最低和最高频率间线性选择
+void testOndemandThreshold() {
+    // 利用率0.79：目标0.5 + 0.79×0.5 = 0.895，选0.9，不发生新的切换
+    CoreReport below = runAtDispatchUtilization(FrequencyGovernor::ONDEMAND, 0.79);
+    ZTS_CHECK_EQ(residencyAt(below, 1.0), 0.0);
+    ZTS_CHECK_EQ(residencyAt(below, 0.95), 0.0);
+    ZTS_CHECK_EQ(below.frequency_changes, 2LL);
+
+    // 利用率0.81：最高频率
+    CoreReport above = runAtDispatchUtilization(FrequencyGovernor::ONDEMAND, 0.81);
+    ZTS_CHECK(residencyAt(above, 1.0) > 0);
+    ZTS_CHECK_EQ(residencyAt(above, 0.95), 0.0);
+    ZTS_CHECK_EQ(above.frequency_changes, 3LL);
+}
+
+// schedutil：目标频率 = 1.25 × 利用率 × 最高频率，取不低于目标的最低频率
+void testSchedutilHeadroom() {
+    // 利用率0.74：目标0.925，选0.95（系数1.2时会选0.9，1.3时会选1.0）
+    CoreReport middle = runAtDispatchUtilization(FrequencyGovernor::SCHEDUTIL, 0.74);
+    ZTS_CHECK(residencyAt(middle, 0.95) > 0);
+    ZTS_CHECK_EQ(residencyAt(middle, 1.0), 0.0);
+    ZTS_CHECK_EQ(middle.frequency_changes, 3LL);
+
+    // 利用率0.70：目标0.875，选0.9
+    CoreReport low = runAtDispatchUtilization(FrequencyGovernor::SCHEDUTIL, 0.70);
+    ZTS_CHECK_EQ(residencyAt(low, 0.95), 0.0);
+    ZTS_CHECK_EQ(residencyAt(low, 1.0), 0.0);
+    ZTS_CHECK_EQ(low.frequency_changes, 2LL);
+
+    // 利用率0.79：目标0.9875，选1.0
+    CoreReport high = runAtDispatchUtilization(FrequencyGovernor::SCHEDUTIL, 0.79);
+    ZTS_CHECK(residencyAt(high, 1.0) > 0);
+    ZTS_CHECK_EQ(residencyAt(high, 0.95), 0.0);
+}
+
+// race-to-idle：始终以最高频率运行，不切换频率，也不按采样周期切分运行
+void testRaceToIdle() {
+    CpuCore core(0, "core", 1.0, 4.0);
+    core.performance_states = CpuCore::cubicPowerCurve(kFrequencies, 4.0, 0.5);
+    MultiCoreScheduler scheduler(SchedulerFactory::SchedulerType::FCFS);
+    scheduler.addCore(core);
+    scheduler.setGovernor(FrequencyGovernor::RACE_TO_IDLE, 1.0);
+    MultiCoreResult result = scheduler.schedule({Process(1, "A", 0, 10), Process(2, "B", 20, 1)});
+    ZTS_CHECK_EQ(result.cores[0].frequency_changes, 0LL);
+    ZTS_CHECK_EQ(residencyAt(result.cores[0], 1.0), 11.0);
+    ZTS_CHECK(near(result.energy, 4.0 * 11));
+
+    ZTS_CHECK_THROWS(scheduler.setGovernor(FrequencyGovernor::ONDEMAND, 0.0), std::invalid_argument);
+}
+
+} // namespace
+
+int main() {
+    testSingleCorePowerModel();
+    testIdleStateAccounting();
+    testEnergyDecomposition();
+    testOndemandThreshold();
+    testSchedutilHeadroom();
+    testRaceToIdle();
+    return ZTS_TEST_RESULT();
+}
@@ -0,0 +1,473 @@
+#include "../include/synchronization/resource_manager.h"
+#include "test_common.h"
+#include <algorithm>
+#include <deque>
+#include <map>
+#include <random>
+#include <stdexcept>
+
+/**
+ * @file test_resource_manager.cpp
+ * @brief 资源管理器的单元测试：银行家算法与穷举安全性检查对比，死锁检测与暴力搜索对比
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+/**
+ * @struct BankState
+ * @brief 从资源管理器读出的状态
+ */
+struct BankState {
+    std::vector<int> available;
+    std::vector<std::vector<int>> allocation;
+    std::vector<std::vector<int>> need;
+};
+
+// 读出当前状态
+BankState readState(const ResourceManager& manager, int processes) {
+    BankState state;
+    state.available = manager.getAvailable();
+    for (int pid = 0; pid < processes; ++pid) {
+        state.allocation.push_back(manager.getAllocation(pid));
+        state.need.push_back(manager.getNeed(pid));
+    }
+    return state;
+}
+
+// 穷举所有完成顺序（按已完成集合记忆化）：存在一个让所有进程依次完成的顺序即安全
+bool exhaustivelySafe(const BankState& state) {
+    const size_t processes = state.need.size();
+    const size_t resources = state.available.size();
+    std::vector<char> visited(static_cast<size_t>(1) << processes, 0);
+    std::vector<size_t> stack = {0};
+    visited[0] = 1;
+    while (!stack.empty()) {
+        size_t done = stack.back();
+        stack.pop_back();
+        if (done + 1 == visited.size()) {
+            return true;
+        }
+        std::vector<int> work = state.available;
+        for (size_t p = 0; p < processes; ++p) {
+            if (done & (static_cast<size_t>(1) << p)) {
+                for (size_t r = 0; r < resources; ++r) {
+                    work[r] += state.allocation[p][r];
+                }
+            }
+        }
+        for (size_t p = 0; p < processes; ++p) {
+            size_t next = done | (static_cast<size_t>(1) << p);
+            if (next == done || visited[next]) {
+                continue;
+            }
+            bool fits = true;
+            for (size_t r = 0; r < resources; ++r) {
+                fits = fits && state.need[p][r] <= work[r];
+            }
+            if (fits) {
+                visited[next] = 1;
+                stack.push_back(next);
+            }
+        }
+    }
+    return false;
+}
+
+// 随机申请和释放：每次申请的结果与穷举判断一致，状态始终安全且资源守恒
+void testBankerMatchesExhaustiveCheck() {
+    std::mt19937 rng(31);
+    for (int round = 0; round < 40; ++round) {
+        const int resources = 1 + round % 3;
+        const int processes = 2 + round % 5;
+        ResourceManager manager(AllocationPolicy::BANKER);
+        std::vector<int> totals;
+        for (int r = 0; r < resources; ++r) {
+            totals.push_back(2 + static_cast<int>(rng() % 6));
+            manager.addResourceType("R" + std::to_string(r), totals.back());
+        }
+        std::vector<std::vector<int>> max_claims;
+        for (int pid = 0; pid < processes; ++pid) {
+            std::vector<int> claim;
+            for (int r = 0; r < resources; ++r) {
+                claim.push_back(static_cast<int>(rng() % (totals[r] + 1)));
+            }
+            manager.addProcess(pid, claim);
+            max_claims.push_back(claim);
+        }
+
+        for (int step = 0; step < 400; ++step) {
+            int pid = static_cast<int>(rng() % processes);
+            if (manager.isWaiting(pid)) {
+                continue;
+            }
+            BankState before = readState(manager, processes);
+            std::vector<int> amounts(resources, 0);
+
+            if (rng() % 3 != 0) {
+                bool available = true;
+                for (int r = 0; r < resources; ++r) {
+                    amounts[r] = before.need[pid][r] == 0 ? 0 : static_cast<int>(rng() % (before.need[pid][r] + 1));
+                    available = available && amounts[r] <= before.available[r];
+                }
+                BankState granted = before;
+                for (int r = 0; r < resources; ++r) {
+                    granted.available[r] -= amounts[r];
+                    granted.allocation[pid][r] += amounts[r];
+                    granted.need[pid][r] -= amounts[r];
+                }
+
+                RequestResult result = manager.request(pid, amounts);
+                if (!available) {
+                    ZTS_CHECK(result == RequestResult::BLOCKED_UNAVAILABLE);
+                } else if (exhaustivelySafe(granted)) {
+                    ZTS_CHECK(result == RequestResult::GRANTED);
+                } else {
+                    ZTS_CHECK(result == RequestResult::BLOCKED_UNSAFE);
+                }
+                ZTS_CHECK_EQ(manager.isWaiting(pid), result != RequestResult::GRANTED);
+            } else {
+                for (int r = 0; r < resources; ++r) {
+                    amounts[r] = static_cast<int>(rng() % (before.allocation[pid][r] + 1));
+                }
+                for (int woken : manager.release(pid, amounts)) {
+                    ZTS_CHECK(!manager.isWaiting(woken));
+                }
+            }
+
+            BankState after = readState(manager, processes);
+            ZTS_CHECK(exhaustivelySafe(after));
+            ZTS_CHECK_EQ(manager.isSafeFullScan(), true);
+            for (int r = 0; r < resources; ++r) {
+                int held = after.available[r];
+                for (int p = 0; p < processes; ++p) {
+                    held += after.allocation[p][r];
+                    ZTS_CHECK_EQ(after.allocation[p][r] + after.need[p][r], max_claims[p][r]);
+                }
+                ZTS_CHECK_EQ(held, totals[r]);
+            }
+        }
+    }
+}
+
+// 教科书中的例子：P1的申请安全，P4的申请不安全
+void testTextbookExample() {
+    ResourceManager manager(AllocationPolicy::BANKER);
+    manager.addResourceType("A", 10);
+    manager.addResourceType("B", 5);
+    manager.addResourceType("C", 7);
+    const std::vector<std::vector<int>> max_claims = {
+        {7, 5, 3}, {3, 2, 2}, {9, 0, 2}, {2, 2, 2}, {4, 3, 3}
+    };
+    const std::vector<std::vector<int>> allocations = {
+        {0, 1, 0}, {2, 0, 0}, {3, 0, 2}, {2, 1, 1}, {0, 0, 2}
+    };
+    for (int pid = 0; pid < 5; ++pid) {
+        manager.addProcess(pid, max_claims[pid]);
+        ZTS_CHECK(manager.request(pid, allocations[pid]) == RequestResult::GRANTED);
+    }
+    ZTS_CHECK(manager.getAvailable() == std::vector<int>({3, 3, 2}));
+    ZTS_CHECK(manager.request(1, {1, 0, 2}) == RequestResult::GRANTED);
+    ZTS_CHECK(manager.request(4, {3, 3, 0}) == RequestResult::BLOCKED_UNAVAILABLE);
+    ZTS_CHECK(manager.request(0, {0, 2, 0}) == RequestResult::BLOCKED_UNSAFE);
+    ZTS_CHECK_THROWS(manager.request(0, {0, 1, 0}), std::logic_error);
+    ZTS_CHECK_THROWS(manager.request(2, {7, 0, 0}), std::invalid_argument);
+}
+
+/**
+ * @struct ShadowProcess
+ * @brief 死锁检测测试中按定义直接维护的进程状态
+ */
+struct ShadowProcess {
+    std::vector<int> allocation;
+    std::vector<int> need;
+    std::vector<int> pending;
+    bool waiting;
+};
+
+/**
+ * @struct ShadowManager
+ * @brief 死锁检测策略的参照模型：资源足够就分配，等待请求在释放后按先来先服务重试
+ */
+struct ShadowManager {
+    std::vector<int> available;
+    std::map<int, ShadowProcess> processes;
+    std::deque<int> queue;
+
+    // 按先来先服务重试等待中的请求
+    std::vector<int> retry() {
+        std::vector<int> granted;
+        std::deque<int> still_waiting;
+        for (int pid : queue) {
+            ShadowProcess& process = processes.at(pid);
+            bool fits = true;
+            for (size_t r = 0; r < available.size(); ++r) {
+                fits = fits && process.pending[r] <= available[r];
+            }
+            if (!fits) {
+                still_waiting.push_back(pid);
+                continue;
+            }
+            for (size_t r = 0; r < available.size(); ++r) {
+                available[r] -= process.pending[r];
+                process.allocation[r] += process.pending[r];
+                process.need[r] -= process.pending[r];
+                process.pending[r] = 0;
+            }
+            process.waiting = false;
+            granted.push_back(pid);
+        }
+        queue.swap(still_waiting);
+        return granted;
+    }
+};
+
+// 按定义构造资源分配图（等待进程指向所请求的资源类型，资源类型指向持有者），用深度优先搜索找环
+bool bruteForceHasCycle(const ShadowManager& shadow, size_t& edge_count) {
+    std::map<long long, std::vector<long long>> successors;
+    edge_count = 0;
+    for (const auto& item : shadow.processes) {
+        for (size_t r = 0; r < shadow.available.size(); ++r) {
+            long long process_node = 2LL * item.first;
+            long long resource_node = 2LL * static_cast<long long>(r) + 1;
+            if (item.second.pending[r] > 0) {
+                successors[process_node].push_back(resource_node);
+                edge_count++;
+            }
+            if (item.second.allocation[r] > 0) {
+                successors[resource_node].push_back(process_node);
+                edge_count++;
+            }
+        }
+    }
+    // 0：未访问，1：在当前路径上，2：已完成
+    std::map<long long, int> color;
+    for (const auto& item : successors) {
+        if (color[item.first] != 0) {
+            continue;
+        }
+        std::vector<std::pair<long long, size_t>> stack = {{item.first, 0}};
+        color[item.first] = 1;
+        while (!stack.empty()) {
+            long long node = stack.back().first;
+            size_t& next = stack.back().second;
+            auto found = successors.find(node);
+            if (found == successors.end() || next == found->second.size()) {
+                color[node] = 2;
+                stack.pop_back();
+                continue;
+            }
+            long long child = found->second[next++];
+            if (color[child] == 1) {
+                return true;
+            }
+            if (color[child] == 0) {
+                color[child] = 1;
+                stack.push_back({child, 0});
+            }
+        }
+    }
+    return false;
+}
+
+// 按定义归约资源分配图：反复找请求不超过Work的进程，完成后收回其资源；
+// 无法归约的进程即死锁，包括未持有资源、但所等资源被死锁进程占住的进程
+std::vector<int> bruteForceDeadlock(const ShadowManager& shadow) {
+    std::vector<int> work = shadow.available;
+    std::map<int, bool> finished;
+    for (const auto& item : shadow.processes) {
+        finished[item.first] = false;
+    }
+    bool progress = true;
+    while (progress) {
+        progress = false;
+        for (const auto& item : shadow.processes) {
+            if (finished[item.first]) {
+                continue;
+            }
+            bool fits = true;
+            for (size_t r = 0; r < work.size(); ++r) {
+                fits = fits && item.second.pending[r] <= work[r];
+            }
+            if (fits) {
+                for (size_t r = 0; r < work.size(); ++r) {
+                    work[r] += item.second.allocation[r];
+                }
+                finished[item.first] = true;
+                progress = true;
+            }
+        }
+    }
+    std::vector<int> deadlocked;
+    for (const auto& item : finished) {
+        if (!item.second) {
+            deadlocked.push_back(item.first);
+        }
+    }
+    return deadlocked;
+}
+
+// 资源管理器与参照模型的状态逐项一致，环与死锁进程与暴力结果一致
+void checkAgainstShadow(ResourceManager& manager, const ShadowManager& shadow) {
+    ZTS_CHECK(manager.getAvailable() == shadow.available);
+    ZTS_CHECK_EQ(manager.getProcessCount(), shadow.processes.size());
+    for (const auto& item : shadow.processes) {
+        ZTS_CHECK(manager.getAllocation(item.first) == item.second.allocation);
+        ZTS_CHECK(manager.getNeed(item.first) == item.second.need);
+        ZTS_CHECK_EQ(manager.isWaiting(item.first), item.second.waiting);
+    }
+    size_t edge_count = 0;
+    bool cycle = bruteForceHasCycle(shadow, edge_count);
+    ZTS_CHECK_EQ(manager.getGraphEdgeCount(), edge_count);
+    ZTS_CHECK_EQ(manager.hasWaitCycle(), cycle);
+    std::vector<int> deadlocked = bruteForceDeadlock(shadow);
+    ZTS_CHECK(manager.detectDeadlock() == deadlocked);
+    // 多实例资源下环是死锁的必要条件
+    ZTS_CHECK(deadlocked.empty() || cycle);
+}
+
+// 随机申请、释放、增删进程：死锁检测策略下的分配、唤醒、环判断和死锁进程都与参照模型一致
+void testDetectionMatchesBruteForce() {
+    std::mt19937 rng(57);
+    long long deadlock_states = 0;
+    long long cycle_states = 0;
+    for (int round = 0; round < 100; ++round) {
+        const int resources = 1 + round % 4;
+        ResourceManager manager(AllocationPolicy::DETECTION);
+        ShadowManager shadow;
+        std::vector<int> totals;
+        for (int r = 0; r < resources; ++r) {
+            totals.push_back(1 + static_cast<int>(rng() % 4));
+            manager.addResourceType("R" + std::to_string(r), totals.back());
+        }
+        shadow.available = totals;
+        int next_pid = 0;
+
+        for (int step = 0; step < 2000; ++step) {
+            unsigned action = rng() % 10;
+            if (shadow.processes.size() < 2 || (action == 0 && shadow.processes.size() < 8)) {
+                ShadowProcess process;
+                for (int r = 0; r < resources; ++r) {
+                    process.need.push_back(static_cast<int>(rng() % (totals[r] + 1)));
+                }
+                process.allocation.assign(resources, 0);
+                process.pending.assign(resources, 0);
+                process.waiting = false;
+                manager.addProcess(next_pid, process.need);
+                shadow.processes[next_pid++] = process;
+                checkAgainstShadow(manager, shadow);
+                continue;
+            }
+
+            auto chosen = shadow.processes.begin();
+            std::advance(chosen, rng() % shadow.processes.size());
+            const int pid = chosen->first;
+            ShadowProcess& process = chosen->second;
+
+            if (action == 1) {
+                // 移除进程（可能正在等待），释放其全部资源
+                if (process.waiting) {
+                    shadow.queue.erase(std::find(shadow.queue.begin(), shadow.queue.end(), pid));
+                }
+                for (int r = 0; r < resources; ++r) {
+                    shadow.available[r] += process.allocation[r];
+                }
+                shadow.processes.erase(chosen);
+                std::vector<int> expected = shadow.retry();
+                ZTS_CHECK(manager.removeProcess(pid) == expected);
+            } else if (process.waiting) {
+                ZTS_CHECK_THROWS(manager.request(pid, process.pending), std::logic_error);
+                continue;
+            } else if (action < 7) {
+                std::vector<int> amounts(resources);
+                bool available = true;
+                for (int r = 0; r < resources; ++r) {
+                    amounts[r] = static_cast<int>(rng() % (process.need[r] + 1));
+                    available = available && amounts[r] <= shadow.available[r];
+                }
+                RequestResult result = manager.request(pid, amounts);
+                ZTS_CHECK(result == (available ? RequestResult::GRANTED : RequestResult::BLOCKED_UNAVAILABLE));
+                for (int r = 0; r < resources; ++r) {
+                    if (available) {
+                        shadow.available[r] -= amounts[r];
+                        process.allocation[r] += amounts[r];
+                        process.need[r] -= amounts[r];
+                    } else {
+                        process.pending[r] = amounts[r];
+                    }
+                }
+                if (!available) {
+                    process.waiting = true;
+                    shadow.queue.push_back(pid);
+                }
+            } else {
+                std::vector<int> amounts(resources);
+                for (int r = 0; r < resources; ++r) {
+                    amounts[r] = static_cast<int>(rng() % (process.allocation[r] + 1));
+                    shadow.available[r] += amounts[r];
+                    process.allocation[r] -= amounts[r];
+                    process.need[r] += amounts[r];
+                }
+                std::vector<int> expected = shadow.retry();
+                ZTS_CHECK(manager.release(pid, amounts) == expected);
+            }
+
+            checkAgainstShadow(manager, shadow);
+            cycle_states += manager.hasWaitCycle() ? 1 : 0;
+            deadlock_states += shadow.queue.empty() || bruteForceDeadlock(shadow).empty() ? 0 : 1;
+        }
+    }
+    // 随机序列要真正覆盖到有环和死锁的状态
+    ZTS_CHECK(cycle_states > 1000);
+    ZTS_CHECK(deadlock_states > 1000);
+}
+
+// 教科书中的死锁检测例子：P2再申请一个C之后P1~P4死锁
+void testDetectionTextbookExample() {
+    ResourceManager manager(AllocationPolicy::DETECTION);
+    manager.addResourceType("A", 7);
+    manager.addResourceType("B", 2);
+    manager.addResourceType("C", 6);
+    const std::vector<std::vector<int>> allocations = {
+        {0, 1, 0}, {2, 0, 0}, {3, 0, 3}, {2, 1, 1}, {0, 0, 2}
+    };
+    const std::vector<std::vector<int>> requests = {
+        {0, 0, 0}, {2, 0, 2}, {0, 0, 1}, {1, 0, 0}, {0, 0, 2}
+    };
+    for (int pid = 0; pid < 5; ++pid) {
+        std::vector<int> max_claim = allocations[pid];
+        for (size_t r = 0; r < max_claim.size(); ++r) {
+            max_claim[r] += requests[pid][r];
+        }
+        manager.addProcess(pid, max_claim);
+        ZTS_CHECK(manager.request(pid, allocations[pid]) == RequestResult::GRANTED);
+    }
+    ZTS_CHECK(manager.getAvailable() == std::vector<int>({0, 0, 0}));
+
+    ZTS_CHECK(manager.request(1, requests[1]) == RequestResult::BLOCKED_UNAVAILABLE);
+    ZTS_CHECK(manager.request(3, requests[3]) == RequestResult::BLOCKED_UNAVAILABLE);
+    ZTS_CHECK(manager.request(4, requests[4]) == RequestResult::BLOCKED_UNAVAILABLE);
+    ZTS_CHECK(manager.detectDeadlock().empty());
+
+    ZTS_CHECK(manager.request(2, requests[2]) == RequestResult::BLOCKED_UNAVAILABLE);
+    ZTS_CHECK(manager.hasWaitCycle());
+    ZTS_CHECK(manager.detectDeadlock() == std::vector<int>({1, 2, 3, 4}));
+
+    // 终止P2后释放的资源依次满足P1、P3，死锁解除
+    ZTS_CHECK(manager.removeProcess(2) == std::vector<int>({1, 3}));
+    ZTS_CHECK(manager.detectDeadlock().empty());
+    ZTS_CHECK(manager.isWaiting(4));
+}
+
+} // namespace
+
+int main() {
+    testBankerMatchesExhaustiveCheck();
+    testTextbookExample();
+    testDetectionMatchesBruteForce();
+    testDetectionTextbookExample();
+    return ZTS_TEST_RESULT();
+}
@@ -0,0 +1,83 @@
+#include "../include/synchronization/smp_lock_simulator.h"
+#include "test_common.h"
+#include <random>
+
+/**
+ * @file test_smp_lock.cpp
+ * @brief 多核自旋-休眠锁模拟的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+// 每个核心每个时间单位恰好归入一类，全部迭代都完成
+void checkInvariants(const SmpLockResult& result, const LockWorkload& workload) {
+    long long core_time = static_cast<long long>(result.cores) * result.makespan;
+    ZTS_CHECK_EQ(result.useful_time + result.spin_time + result.park_time + result.wake_time
+                 + result.switch_time + result.idle_time, core_time);
+    ZTS_CHECK_EQ(result.critical_sections, static_cast<long long>(workload.threads) * workload.iterations);
+    ZTS_CHECK_EQ(result.useful_time, static_cast<long long>(workload.threads) * workload.iterations
+                 * (workload.critical_time + workload.non_critical_time));
+    ZTS_CHECK_EQ(result.wakeups, result.parks);
+}
+
+// 时间片为1且有上下文切换开销时线程仍能推进
+void testUnitQuantum() {
+    SpinParkCosts costs;
+    costs.time_quantum = 1;
+    costs.context_switch = 1;
+    SmpLockSimulator simulator(1, 4);
+    simulator.setCosts(costs);
+    LockWorkload workload(2, 5, 2, 3, 1);
+    checkInvariants(simulator.run(workload), workload);
+
+    costs.time_quantum = 0;
+    ZTS_CHECK_THROWS(simulator.setCosts(costs), std::invalid_argument);
+}
+
+// 上下文切换不占时间片：两个互不竞争的线程在一个核心上每次各做满q个单位的工作
+void testQuantumCountsOnlyWork() {
+    SpinParkCosts costs;
+    costs.time_quantum = 5;
+    costs.context_switch = 1;
+    SmpLockSimulator simulator(1, 4);
+    simulator.setCosts(costs);
+    LockWorkload workload(2, 10, 2, 8, 2);
+    SmpLockResult result = simulator.run(workload);
+    checkInvariants(result, workload);
+    // 每个线程100个单位的工作，各20个时间片
+    ZTS_CHECK_EQ(result.context_switches, 40LL);
+    ZTS_CHECK_EQ(result.switch_time, 40LL);
+}
+
+// 随机配置下的守恒关系
+void testRandomConfigurations() {
+    std::mt19937 rng(5);
+    const int budgets[] = {0, 1, 4, 16, SmpLockSimulator::kSpinForever};
+    for (int round = 0; round < 200; ++round) {
+        SpinParkCosts costs;
+        costs.park_cost = static_cast<int>(rng() % 4);
+        costs.wake_cost = static_cast<int>(rng() % 4);
+        costs.wakeup_latency = static_cast<int>(rng() % 6);
+        costs.context_switch = static_cast<int>(rng() % 3);
+        costs.time_quantum = 1 + static_cast<int>(rng() % 10);
+        SmpLockSimulator simulator(1 + static_cast<int>(rng() % 4), budgets[rng() % 5]);
+        simulator.setCosts(costs);
+        LockWorkload workload(1 + static_cast<int>(rng() % 8), 1 + static_cast<int>(rng() % 10),
+                              1 + static_cast<int>(rng() % 4), static_cast<int>(rng() % 6),
+                              1 + static_cast<int>(rng() % 3));
+        checkInvariants(simulator.run(workload), workload);
+    }
+}
+
+} // namespace
+
+int main() {
+    testUnitQuantum();
+    testQuantumCountsOnlyWork();
+    testRandomConfigurations();
+    return ZTS_TEST_RESULT();
+}
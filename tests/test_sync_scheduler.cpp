@@ -0,0 +1,209 @@
+#include "../include/synchronization/sync_scheduler.h"
+#include "../include/algorithms/OnlineScheduler.h"
+#include "test_common.h"
+#include <map>
+#include <random>
+#include <stdexcept>
+
+/**
+ * @file test_sync_scheduler.cpp
+ * @brief 带同步原语的调度模拟的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+/**
+ * @struct PolicyCase
+ * @brief 一种出队顺序与抢占方式
+ */
+struct PolicyCase {
+    SchedulerFactory::SchedulerType type;
+    bool preemptive;
+    int time_quantum;
+};
+
+// 六种调度策略：FCFS、时间片轮转、SJF、SRTF、非抢占式与抢占式优先级
+const PolicyCase kPolicies[] = {
+    {SchedulerFactory::SchedulerType::FCFS, false, 2},
+    {SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 3},
+    {SchedulerFactory::SchedulerType::SJF, false, 2},
+    {SchedulerFactory::SchedulerType::SJF, true, 2},
+    {SchedulerFactory::SchedulerType::PRIORITY, false, 2},
+    {SchedulerFactory::SchedulerType::PRIORITY, true, 2}
+};
+
+// 随机负载：到达时间有空档也有大量同时到达
+ProcessList randomWorkload(std::mt19937& rng, int count) {
+    ProcessList processes;
+    for (int i = 0; i < count; ++i) {
+        processes.emplace_back(i + 1, "P" + std::to_string(i + 1), static_cast<int>(rng() % (2 * count)),
+                               1 + static_cast<int>(rng() % 9), static_cast<ProcessPriority>(1 + rng() % 5));
+    }
+    return processes;
+}
+
+// 没有脚本时与在线调度器逐进程一致
+void checkMatchesOnline(const ProcessList& processes, const PolicyCase& policy) {
+    OnlineScheduler online(policy.type, policy.preemptive, policy.time_quantum);
+    online.setTraceEnabled(false);
+    SchedulingResult expected = online.schedule(processes);
+
+    SyncScheduler scheduler(policy.type, policy.preemptive, policy.time_quantum);
+    scheduler.setTraceEnabled(false);
+    scheduler.addMutex("unused");
+    SyncSimulationResult actual = scheduler.run(processes);
+
+    std::map<int, const Process*> by_pid;
+    for (const auto& process : expected.processes) {
+        by_pid[process.getPID()] = &process;
+    }
+    ZTS_CHECK(!actual.deadlocked);
+    ZTS_CHECK_EQ(actual.scheduling.processes.size(), expected.processes.size());
+    for (const auto& process : actual.scheduling.processes) {
+        auto found = by_pid.find(process.getPID());
+        ZTS_CHECK(found != by_pid.end());
+        if (found == by_pid.end()) {
+            continue;
+        }
+        ZTS_CHECK_EQ(process.getStartTime(), found->second->getStartTime());
+        ZTS_CHECK_EQ(process.getCompletionTime(), found->second->getCompletionTime());
+        ZTS_CHECK_EQ(process.getWaitingTime(), found->second->getWaitingTime());
+        ZTS_CHECK_EQ(process.getResponseTime(), found->second->getResponseTime());
+    }
+    ZTS_CHECK_EQ(actual.scheduling.total_time, expected.total_time);
+    ZTS_CHECK_EQ(actual.scheduling.average_waiting_time, expected.average_waiting_time);
+    ZTS_CHECK_EQ(actual.scheduling.average_turnaround_time, expected.average_turnaround_time);
+    ZTS_CHECK_EQ(actual.inversion_time, 0);
+    for (const auto& stats : actual.processes) {
+        ZTS_CHECK_EQ(stats.blocked_time, 0);
+        ZTS_CHECK_EQ(stats.blocks, 0);
+    }
+}
+
+// 没有脚本时六种策略的结果都与在线调度器相同
+void testWithoutScriptsMatchesOnline() {
+    std::mt19937 rng(36);
+    for (int round = 0; round < 150; ++round) {
+        ProcessList processes = randomWorkload(rng, 1 + round % 25);
+        for (const auto& policy : kPolicies) {
+            checkMatchesOnline(processes, policy);
+        }
+    }
+}
+
+// 两个进程以相反顺序获取两把锁：时间片轮转交错执行后互相等待，判定为死锁
+void testLockOrderDeadlock() {
+    ProcessList processes = {Process(1, "A", 0, 4), Process(2, "B", 0, 4), Process(3, "C", 0, 2)};
+
+    SyncScheduler scheduler(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 1);
+    scheduler.setTraceEnabled(false);
+    int first = scheduler.addMutex("M1");
+    int second = scheduler.addMutex("M2");
+    scheduler.setScript(1, {SyncAction::lock(1, first), SyncAction::lock(2, second),
+                            SyncAction::unlock(3, second), SyncAction::unlock(3, first)});
+    scheduler.setScript(2, {SyncAction::lock(1, second), SyncAction::lock(2, first),
+                            SyncAction::unlock(3, first), SyncAction::unlock(3, second)});
+    SyncSimulationResult result = scheduler.run(processes);
+    ZTS_CHECK(result.deadlocked);
+    ZTS_CHECK_EQ(result.deadlocked_pids.size(), static_cast<size_t>(2));
+    if (result.deadlocked_pids.size() == 2) {
+        ZTS_CHECK_EQ(result.deadlocked_pids[0], 1);
+        ZTS_CHECK_EQ(result.deadlocked_pids[1], 2);
+    }
+    // 与锁无关的进程照常完成
+    ZTS_CHECK(result.scheduling.processes[2].isCompleted());
+    ZTS_CHECK(!result.scheduling.processes[0].isCompleted());
+    ZTS_CHECK(!result.scheduling.processes[1].isCompleted());
+    ZTS_CHECK_EQ(result.processes[0].blocks, 1);
+    ZTS_CHECK_EQ(result.processes[1].blocks, 1);
+
+    // 按相同顺序加锁则不会死锁
+    scheduler.setScript(2, {SyncAction::lock(1, first), SyncAction::lock(2, second),
+                            SyncAction::unlock(3, second), SyncAction::unlock(3, first)});
+    SyncSimulationResult ordered = scheduler.run(processes);
+    ZTS_CHECK(!ordered.deadlocked);
+    ZTS_CHECK(ordered.deadlocked_pids.empty());
+    for (const auto& process : ordered.scheduling.processes) {
+        ZTS_CHECK(process.isCompleted());
+    }
+
+    // 脚本错误
+    ZTS_CHECK_THROWS(scheduler.setScript(1, {SyncAction::lock(1, first)}), std::invalid_argument);
+    ZTS_CHECK_THROWS(scheduler.setScript(1, {SyncAction::unlock(1, first)}), std::invalid_argument);
+    ZTS_CHECK_THROWS(scheduler.setScript(1, {SyncAction::wait(1, first)}), std::invalid_argument);
+    scheduler.setScript(3, {SyncAction::lock(2, first), SyncAction::unlock(2, first)});
+    ZTS_CHECK_THROWS(scheduler.run(processes), std::invalid_argument);
+}
+
+/**
+ * @brief 三进程优先级反转：低优先级L持锁时高优先级H到达并等待该锁，中优先级M随后到达
+ *
+ * L（优先级4，0时刻到达，执行6）在已执行1时加锁、5时解锁；H（优先级2，2时刻到达，执行3）
+ * 在已执行1时加锁、2时解锁；M（优先级3，3时刻到达，执行5）不使用锁。抢占式优先级调度。
+ */
+SyncSimulationResult runInversion(LockProtocol protocol) {
+    ProcessList processes = {Process(1, "L", 0, 6, ProcessPriority::LOW),
+                             Process(2, "H", 2, 3, ProcessPriority::HIGH),
+                             Process(3, "M", 3, 5, ProcessPriority::NORMAL)};
+    SyncScheduler scheduler(SchedulerFactory::SchedulerType::PRIORITY, true);
+    scheduler.setTraceEnabled(false);
+    int mutex = scheduler.addMutex("M");
+    scheduler.setScript(1, {SyncAction::lock(1, mutex), SyncAction::unlock(5, mutex)});
+    scheduler.setScript(2, {SyncAction::lock(1, mutex), SyncAction::unlock(2, mutex)});
+    scheduler.setLockProtocol(protocol);
+    return scheduler.run(processes);
+}
+
+// 三种协议下H的阻塞时间、反转时间和完成时间
+void testPriorityInversionProtocols() {
+    // 无协议：H在3时刻阻塞，M抢在L之前运行3-8（无界反转5），L在8-11完成临界区后H才获得锁
+    SyncSimulationResult none = runInversion(LockProtocol::NONE);
+    ZTS_CHECK_EQ(none.processes[1].blocks, 1);
+    ZTS_CHECK_EQ(none.processes[1].blocked_time, 8);
+    ZTS_CHECK_EQ(none.processes[1].inversion_time, 8);
+    ZTS_CHECK_EQ(none.processes[1].unbounded_inversion_time, 5);
+    ZTS_CHECK_EQ(none.inversion_time, 8);
+    ZTS_CHECK_EQ(none.unbounded_inversion_time, 5);
+    ZTS_CHECK_EQ(none.processes[0].boosts, 0);
+    ZTS_CHECK_EQ(none.scheduling.processes[1].getCompletionTime(), 13);
+    ZTS_CHECK_EQ(none.scheduling.processes[2].getCompletionTime(), 8);
+
+    // 优先级继承：L继承H的优先级，3-6完成临界区，反转时间只剩临界区的剩余长度
+    SyncSimulationResult inheritance = runInversion(LockProtocol::PRIORITY_INHERITANCE);
+    ZTS_CHECK_EQ(inheritance.processes[1].blocks, 1);
+    ZTS_CHECK_EQ(inheritance.processes[1].blocked_time, 3);
+    ZTS_CHECK_EQ(inheritance.processes[1].inversion_time, 3);
+    ZTS_CHECK_EQ(inheritance.processes[1].unbounded_inversion_time, 0);
+    ZTS_CHECK_EQ(inheritance.unbounded_inversion_time, 0);
+    ZTS_CHECK_EQ(inheritance.processes[0].boosts, 1);
+    ZTS_CHECK_EQ(inheritance.scheduling.processes[1].getCompletionTime(), 8);
+    ZTS_CHECK_EQ(inheritance.scheduling.processes[2].getCompletionTime(), 13);
+
+    // 优先级天花板：L加锁即升到天花板（H的优先级），H到达时不抢占，L在5时刻解锁后H运行，从不阻塞
+    SyncSimulationResult ceiling = runInversion(LockProtocol::PRIORITY_CEILING);
+    ZTS_CHECK_EQ(ceiling.processes[1].blocks, 0);
+    ZTS_CHECK_EQ(ceiling.processes[1].blocked_time, 0);
+    ZTS_CHECK_EQ(ceiling.inversion_time, 0);
+    ZTS_CHECK_EQ(ceiling.processes[0].boosts, 1);
+    ZTS_CHECK_EQ(ceiling.scheduling.processes[1].getStartTime(), 5);
+    ZTS_CHECK_EQ(ceiling.scheduling.processes[1].getCompletionTime(), 8);
+    ZTS_CHECK_EQ(ceiling.scheduling.processes[2].getCompletionTime(), 13);
+
+    // 三种协议下L都最后完成，总执行时间相同
+    ZTS_CHECK_EQ(none.scheduling.total_time, 14);
+    ZTS_CHECK_EQ(inheritance.scheduling.total_time, 14);
+    ZTS_CHECK_EQ(ceiling.scheduling.total_time, 14);
+}
+
+} // namespace
+
+int main() {
+    testWithoutScriptsMatchesOnline();
+    testLockOrderDeadlock();
+    testPriorityInversionProtocols();
+    return ZTS_TEST_RESULT();
+}
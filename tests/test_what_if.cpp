@@ -0,0 +1,129 @@
+#include "../include/algorithms/WhatIfAnalyzer.h"
+#include "test_common.h"
+#include <random>
+#include <stdexcept>
+
+/**
+ * @file test_what_if.cpp
+ * @brief 假设分析器的单元测试
+ * @author ZTS Operating System Design Team
+ * @date 2025
+ */
+
+using namespace ZTS_OS;
+
+namespace {
+
+struct Config {
+    SchedulerFactory::SchedulerType type;
+    bool preemptive;
+};
+
+const Config kConfigs[] = {
+    {SchedulerFactory::SchedulerType::FCFS, false},
+    {SchedulerFactory::SchedulerType::ROUND_ROBIN, false},
+    {SchedulerFactory::SchedulerType::SJF, false},
+    {SchedulerFactory::SchedulerType::SJF, true},
+    {SchedulerFactory::SchedulerType::PRIORITY, false},
+    {SchedulerFactory::SchedulerType::PRIORITY, true}
+};
+
+// 随机生成进程序列
+ProcessList randomTrace(std::mt19937& rng, int count) {
+    ProcessList processes;
+    int arrival = 0;
+    for (int i = 0; i < count; ++i) {
+        arrival += static_cast<int>(rng() % 6);
+        processes.emplace_back(i + 1, "P" + std::to_string(i + 1), arrival,
+                               1 + static_cast<int>(rng() % 12),
+                               static_cast<ProcessPriority>(rng() % 5));
+    }
+    return processes;
+}
+
+// 查询结果与修改后序列的完整重新模拟逐进程一致
+void checkMatchesFullRun(const WhatIfResult& what_if, const Config& config, const ProcessList& trace) {
+    OnlineScheduler full(config.type, config.preemptive, 3);
+    SchedulingResult expected = full.schedule(trace);
+
+    ZTS_CHECK_EQ(what_if.result.processes.size(), expected.processes.size());
+    if (what_if.result.processes.size() != expected.processes.size()) {
+        return;
+    }
+    for (size_t i = 0; i < expected.processes.size(); ++i) {
+        const Process& actual = what_if.result.processes[i];
+        ZTS_CHECK_EQ(actual.getCompletionTime(), expected.processes[i].getCompletionTime());
+        ZTS_CHECK_EQ(actual.getStartTime(), expected.processes[i].getStartTime());
+        ZTS_CHECK_EQ(actual.getWaitingTime(), expected.processes[i].getWaitingTime());
+    }
+    ZTS_CHECK_EQ(what_if.result.total_time, expected.total_time);
+    ZTS_CHECK_EQ(what_if.result.scheduling_decisions, expected.scheduling_decisions);
+}
+
+// 随机修改作业，增量结果与完整重新模拟一致；同一分析器连续查询互不影响
+void testQueriesMatchFullRun() {
+    std::mt19937 rng(7);
+    for (const auto& config : kConfigs) {
+        for (int round = 0; round < 4; ++round) {
+            ProcessList trace = randomTrace(rng, 120);
+            WhatIfAnalyzer analyzer(config.type, config.preemptive, 3, 1 + static_cast<int>(rng() % 20));
+            analyzer.runBaseline(trace);
+
+            for (int query = 0; query < 30; ++query) {
+                size_t job = rng() % trace.size();
+                const Process& original = trace[job];
+                int arrival = std::max(0, original.getArrivalTime() + static_cast<int>(rng() % 41) - 20);
+                Process modified(original.getPID(), original.getName(), arrival,
+                                 1 + static_cast<int>(rng() % 12),
+                                 static_cast<ProcessPriority>(rng() % 5));
+
+                WhatIfResult what_if = analyzer.query(job, modified);
+                ProcessList changed = trace;
+                changed[job] = modified;
+                checkMatchesFullRun(what_if, config, changed);
+            }
+        }
+    }
+}
+
+// 到达时间为负、执行时间不为正的修改以invalid_argument拒绝，之后分析器仍可继续使用
+void testQueryRejectsInvalidJob() {
+    ProcessList trace;
+    trace.emplace_back(1, "P1", 0, 5);
+    trace.emplace_back(2, "P2", 3, 4);
+    trace.emplace_back(3, "P3", 8, 2);
+
+    WhatIfAnalyzer analyzer(SchedulerFactory::SchedulerType::FCFS, false, 2, 2);
+    analyzer.runBaseline(trace);
+
+    ZTS_CHECK_THROWS(analyzer.query(0, Process(1, "P1", -1, 5)), std::invalid_argument);
+    ZTS_CHECK_THROWS(analyzer.query(1, Process(2, "P2", -100, 4)), std::invalid_argument);
+    ZTS_CHECK_THROWS(analyzer.query(1, Process(2, "P2", 3, 0)), std::invalid_argument);
+    ZTS_CHECK_THROWS(analyzer.query(2, Process(3, "P3", 8, -3)), std::invalid_argument);
+    ZTS_CHECK_THROWS(analyzer.query(3, Process(4, "P4", 0, 1)), std::out_of_range);
+
+    // 提前到时刻0：只有初始检查点早于它，从初始检查点恢复
+    WhatIfResult what_if = analyzer.query(2, Process(3, "P3", 0, 2));
+    ZTS_CHECK_EQ(what_if.restored_from, 0);
+    ProcessList changed = trace;
+    changed[2] = Process(3, "P3", 0, 2);
+    checkMatchesFullRun(what_if, {SchedulerFactory::SchedulerType::FCFS, false}, changed);
+}
+
+// 基线输入同样要校验，执行时间为0的进程会让模拟永远不结束
+void testBaselineRejectsInvalidTrace() {
+    WhatIfAnalyzer analyzer(SchedulerFactory::SchedulerType::ROUND_ROBIN, false, 2, 5);
+    ZTS_CHECK_THROWS(analyzer.runBaseline(ProcessList{}), std::invalid_argument);
+    ZTS_CHECK_THROWS(analyzer.runBaseline(ProcessList{Process(1, "P1", 0, 0)}), std::invalid_argument);
+    ZTS_CHECK_THROWS(analyzer.runBaseline(ProcessList{Process(1, "P1", -2, 3)}), std::invalid_argument);
+    ZTS_CHECK_THROWS(analyzer.query(0, Process(1, "P1", 0, 3)), std::logic_error);
+}
+
+} // namespace
+
+int main() {
+    testQueriesMatchFullRun();
+    testQueryRejectsInvalidJob();
+    testBaselineRejectsInvalidTrace();
+    return ZTS_TEST_RESULT();
+}